@@ -0,0 +1,102 @@
+// -----------------------------------------------------------------------------
+// This file is part of Moira - A Motorola 68k emulator
+//
+// Copyright (C) Dirk W. Hoffmann. www.dirkwhoffmann.de
+// Licensed under the GNU General Public License v3
+//
+// See https://www.gnu.org for license information
+// -----------------------------------------------------------------------------
+
+#include "testrunner.h"
+#include "Coverage.h"
+
+// Scrambles the bits of a 32-bit value
+static u32 mix(u32 x)
+{
+    x ^= x >> 16; x *= 0x7feb352d;
+    x ^= x >> 15; x *= 0x846ca68b;
+    x ^= x >> 16;
+    return x;
+}
+
+Coverage::Coverage()
+{
+    seen.resize((1 << 20) / 64);
+}
+
+int
+Coverage::record(Result &r, int accesses)
+{
+    moira::InstrInfo info = moiracpu->getInfo(r.opcode);
+
+    u32 handler = (u32)info.I << 16 | (u32)info.M << 8 | (u32)info.S;
+    bool jumped = r.pc != (u32)(r.oldpc + r.dasmCnt);
+
+    // Tag each observation with a unique number in the upper byte
+    u32 observations[] = {
+
+        0,
+        1u << 24 | (u32)(vector + 1),
+        2u << 24 | (r.sr & 0xA71F),
+        3u << 24 | (u32)r.cycles,
+        4u << 24 | (u32)accesses,
+        5u << 24 | (u32)jumped
+    };
+
+    int result = 0;
+    for (auto o : observations) {
+
+        u32 bit = mix(mix(handler) ^ o) & ((1 << 20) - 1);
+        u64 mask = 1ULL << (bit & 63);
+
+        if (!(seen[bit >> 6] & mask)) { seen[bit >> 6] |= mask; result++; }
+    }
+
+    features += result;
+    return result;
+}
+
+bool
+Coverage::load(const char *path)
+{
+    CorpusEntry entry;
+
+    corpus.clear();
+
+    FILE *file = fopen(path, "rb");
+    if (!file) return false;
+
+    while (fread(&entry, sizeof(entry), 1, file) == 1) corpus.push_back(entry);
+    fclose(file);
+
+    return true;
+}
+
+void
+Coverage::add(const CorpusEntry &entry)
+{
+    corpus.push_back(entry);
+    save(entry);
+}
+
+void
+Coverage::saveCurrent()
+{
+    if (!path) return;
+
+    save(current);
+    printf("The test case has been added to %s\n\n", path);
+}
+
+void
+Coverage::save(const CorpusEntry &entry)
+{
+    if (!path) return;
+
+    // The corpus file is a plain sequence of entries which is appended to
+    if (FILE *file = fopen(path, "ab")) {
+
+        fwrite(&entry, sizeof(entry), 1, file);
+        fclose(file);
+    }
+}
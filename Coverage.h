@@ -0,0 +1,101 @@
+// -----------------------------------------------------------------------------
+// This file is part of Moira - A Motorola 68k emulator
+//
+// Copyright (C) Dirk W. Hoffmann. www.dirkwhoffmann.de
+// Licensed under the GNU General Public License v3
+//
+// See https://www.gnu.org for license information
+// -----------------------------------------------------------------------------
+
+#ifndef COVERAGE_H
+#define COVERAGE_H
+
+#include "MoiraTypes.h"
+#include <vector>
+
+using moira::u8;
+using moira::u16;
+using moira::u32;
+using moira::u64;
+
+struct Result;
+
+// Number of memory images a corpus entry can choose from
+#define MEM_IMAGES 16
+
+// A compact test setup (the memory contents are derived from an image number)
+struct CorpusEntry {
+
+    u16 opcode;
+    u16 ext1;
+    u16 ext2;
+    u8  ccr;
+    u8  supervisor;
+    u32 d[8];
+    u32 a[8];
+    u32 image;
+};
+
+/* Keeps track of the code paths the tested instructions have taken in Moira.
+ *
+ * A code path is characterized by a couple of features, each of which
+ * combines the instruction handler (instruction, addressing mode, and size)
+ * with a single observation: the exception vector taken, the condition codes,
+ * the number of elapsed cycles, the number of memory accesses, and whether
+ * the instruction has modified the program flow. All features are hashed
+ * into a bitmap. A test case is interesting if it sets a bit that hasn't been
+ * set before.
+ */
+class Coverage {
+
+    // Bitmap storing all features seen so far
+    std::vector<u64> seen;
+
+    // Number of bits set in the bitmap
+    long features = 0;
+
+    // First exception vector taken by the current instruction (-1 = none)
+    int vector = -1;
+
+    // Corpus file new entries are appended to (nullptr = don't save entries)
+    const char *path = nullptr;
+
+public:
+
+    // Test cases that have discovered new features
+    std::vector<CorpusEntry> corpus;
+
+    // Test case that is currently executed
+    CorpusEntry current;
+
+    Coverage();
+    long getFeatures() { return features; }
+
+    // Prepares the recording of the next instruction
+    void prepare() { vector = -1; }
+
+    // Called by Moira whenever an exception vector is taken
+    void recordVector(int nr) { if (vector < 0) vector = nr; }
+
+    // Records the features of an executed instruction and returns the number
+    // of features that haven't been seen before
+    int record(Result &r, int accesses);
+
+    // Reads all entries from a corpus file
+    bool load(const char *path);
+
+    // Appends all entries added from now on to a corpus file
+    void attach(const char *path) { this->path = path; }
+
+    // Adds an entry to the corpus
+    void add(const CorpusEntry &entry);
+
+    // Saves the test case that is currently executed (called on failure)
+    void saveCurrent();
+
+private:
+
+    void save(const CorpusEntry &entry);
+};
+
+#endif
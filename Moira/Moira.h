@@ -12,9 +12,20 @@
 #include "MoiraConfig.h"
 #include "MoiraTypes.h"
 #include "MoiraDebugger.h"
+#include "MoiraAnalyzer.h"
+#include "MoiraScheduler.h"
+#include "MoiraJit.h"
 #include "StrWriter.h"
 
+#include <algorithm>
+#include <atomic>
+#include <bit>
 #include <cassert>
+#include <cstdio>
+#include <functional>
+#include <memory>
+#include <unordered_map>
+#include <vector>
 
 namespace moira {
 
@@ -25,40 +36,22 @@ namespace moira {
 #endif
 #define fatalError     assert(false); unreachable
 
-class Moira {
+/* Configuration independent part of a CPU core
+ *
+ * This class holds the CPU state that is shared by all configurations of
+ * MoiraT. It enables the debugger to operate on all cores alike. Because it
+ * forms the beginning of each core, it also holds all variables accessed by
+ * the execution of an ordinary instruction. Together with the vtable pointer,
+ * these variables occupy the first two cache lines of the object. All other
+ * members are rarely touched and placed behind them.
+ */
+class alignas(64) MoiraBase {
 
     friend class Debugger;
     friend class Breakpoints;
     friend class Watchpoints;
     friend class Catchpoints;
 
-protected:
-
-    // Emulated CPU model (68000 is the only supported model yet)
-    CPUModel model = M68000;
-
-    // Interrupt mode of this CPU
-    IrqMode irqMode = IRQ_AUTO;
-
-    // Number format used by the disassembler (hex or decimal)
-    bool hex = true;
-
-    // Text formatting style used by the disassembler (upper case or lower case)
-    bool upper = false;
-
-    // Tab spacing used by the disassembler
-    Align tab{8};
-
-
-    //
-    // Internals
-    //
-
-public:
-
-    // Breakpoints, watchpoints, catchpoints, instruction tracing
-    Debugger debugger = Debugger(*this);
-
 protected:
 
     /* State flags
@@ -92,6 +85,15 @@ protected:
      *
      * CPU_CHECK_WP:
      *    This flag indicates whether the CPU should check fo watchpoints.
+     *
+     * CPU_CHECK_MAILBOX:
+     *    This flag is set if the interrupt mailbox is enabled. If set, the
+     *    CPU reads the interrupt levels posted by other threads before
+     *    executing the next instruction.
+     *
+     * CPU_TRACK_IDLE:
+     *    This flag is set while the idle loop detector observes a loop
+     *    iteration. If set, the CPU records all memory accesses.
      */
     int flags;
     static const int CPU_IS_HALTED         = (1 << 8);
@@ -103,6 +105,20 @@ protected:
     static const int CPU_CHECK_BP          = (1 << 14);
     static const int CPU_CHECK_WP          = (1 << 15);
     static const int CPU_CHECK_CP          = (1 << 16);
+    static const int CPU_CHECK_MAILBOX     = (1 << 17);
+    static const int CPU_TRACK_IDLE        = (1 << 18);
+
+    // Current value on the IPL pins (Interrupt Priority Level)
+    u8 ipl;
+
+    // Value on the lower two function code pins (FC1|FC0)
+    u8 fcl;
+
+    // Indicates whether the clock is advanced bus cycle by bus cycle
+    bool preciseTiming = true;
+
+    // Indicates whether idle loops are detected and skipped
+    bool detectIdle = false;
 
     // Number of elapsed cycles since powerup
     i64 clock;
@@ -113,27 +129,167 @@ protected:
     // The prefetch queue
     PrefetchQueue queue;
 
-    // Current value on the IPL pins (Interrupt Priority Level)
-    u8 ipl;
+    // Pages containing a PC hook (one bit per 4 KB page, null if none is set)
+    std::unique_ptr<u64[]> hookPages;
+
+public:
+
+    virtual ~MoiraBase() { }
+
+protected:
+
+    // Disassembles a single instruction and returns the instruction size
+    virtual int disassemble(u32 addr, char *str) = 0;
+
+    // Continues program execution at the specified address
+    virtual void jump(u32 addr) = 0;
+};
+
+/* The CPU core
+ *
+ * The core is connected to its environment via static polymorphism. The first
+ * template parameter is the host class, which derives from MoiraT and provides
+ * the memory interface and the delegates (see "Interfacing with other
+ * components"). Because all of these functions are resolved at compile time,
+ * the compiler can inline them into the instruction handlers. The second
+ * template parameter is a policy class defining the configuration of the core
+ * (see MoiraConfig.h).
+ */
+template <class H, class C = DefaultConfig> class MoiraT : public MoiraBase {
+
+    friend class Debugger;
+    friend class Breakpoints;
+    friend class Watchpoints;
+    friend class Catchpoints;
+    friend class Analyzer;
+
+
+    //
+    // Internals
+    //
+
+public:
+
+    // Clock value indicating that no event is scheduled
+    static const i64 NEVER = INT64_MAX;
+
+protected:
+
+    // Clock of the next host event that may raise an interrupt
+    i64 nextEvent = NEVER;
+
+    // Indicates whether instruction pairs are fused
+    bool fusion = false;
+
+    // Number of instructions dispatched by a fused handler
+    i64 fusedPairs = 0;
+
+    // Jump table holding the instruction handlers (shared by all instances)
+    typedef void (MoiraT::*ExecPtr)(u16);
+    static ExecPtr exec[65536];
+
+    /* Table holding the disassembler handlers (shared by all instances)
+     *
+     * The table is indexed by the instruction, the addressing mode, and the
+     * size attribute of an opcode, which are looked up in the info table.
+     * This keeps the table small, because all opcodes with the same info
+     * table entry share a single disassembler handler (see dasmIndex()).
+     */
+    typedef void (MoiraT::*DasmPtr)(StrWriter&, u32&, u16);
+    static DasmPtr *dasm;
+
+    // Number of entries in the disassembler table (13 modes, 3 sizes)
+    static constexpr int dasmEntries = (UNLK + 1) * 13 * 3;
+
+    // Returns the dasm table entry of an instruction
+    static constexpr int dasmIndex(Instr I, Mode M, Size S) {
+        return (I * 13 + M) * 3 + (S == Long ? 2 : S == Word ? 1 : 0); }
+
+    // A recently executed instruction sequence with resolved handlers
+    struct CodeBlock {
+
+        int count;
+        u32 pc[16];
+        u16 op[16];
+        ExecPtr handler[16];
+
+        // Program counter after the last instruction
+        u32 next;
+
+        // Number of times the block has been entered since it was recorded
+        int runs;
+
+        // Translated machine code (nullptr if not translated yet)
+        JitCode native;
+    };
+
+    // Cache holding recently executed blocks (empty if disabled)
+    std::vector<CodeBlock> blocks;
+
+    // Executable memory holding translated blocks (null if disabled)
+    std::unique_ptr<JitBuffer> jit;
+
+    // Software TLB (empty if disabled)
+    std::vector<TLBEntry> tlb;
+
+    // Cache holding recently disassembled instructions (empty if disabled)
+    std::vector<DasmCacheEntry> dasmCache;
+
+    // Bitmap marking all pages written to (empty if disabled)
+    std::vector<u64> dirty;
+
+    // Page size of the dirty page tracker (log2)
+    int dirtyBits = 0;
+
+    // Memory areas the CPU may access directly
+    std::vector<RamRegion> ram;
+
+    // Native handlers for TRAP, LINE-A, and LINE-F (empty if none is set)
+    std::vector<std::function<int(u16)>> natives;
+
+    // PC hooks indexed by address
+    std::unordered_map<u32, std::function<int(u32)>> hooks;
+
+    // The loop currently observed by the idle loop detector
+    IdleLoop idle;
+
+    // The loop currently observed by the loop kernels
+    KernelLoop loop { UINT32_MAX, 0, 0 };
+
+    // Interrupt levels asserted by other threads (bit n = level n)
+    std::atomic<u8> mailbox = 0;
+
+    // Indicates whether the CPU observes the mailbox
+    bool useMailbox = false;
 
-    // Value on the lower two function code pins (FC1|FC0)
-    u8 fcl;
-            
     // Remembers the number of the last processed exception
     int exception;
 
-    // Jump table holding the instruction handlers
-    typedef void (Moira::*ExecPtr)(u16);
-    ExecPtr exec[65536];
+    // Emulated CPU model (68000 is the only supported model yet)
+    CPUModel model = M68000;
+
+    // Interrupt mode of this CPU
+    IrqMode irqMode = IRQ_AUTO;
+
+    // Number format used by the disassembler (hex or decimal)
+    bool hex = true;
+
+    // Text formatting style used by the disassembler (upper case or lower case)
+    bool upper = false;
+
+    // Tab spacing used by the disassembler
+    Align tab{8};
+
+public:
+
+    // Breakpoints, watchpoints, catchpoints, instruction tracing
+    [[no_unique_address]]
+    std::conditional_t<C::enableDebugger, Debugger, NoDebugger> debugger{*this};
 
-    // Jump table holding the disassebler handlers
-    typedef void (Moira::*DasmPtr)(StrWriter&, u32&, u16);
-    DasmPtr *dasm = nullptr;
-    
 private:
     
-    // Table holding instruction infos
-    InstrInfo *info = nullptr;
+    // Table holding instruction infos (shared by all instances)
+    static InstrInfo *info;
 
 
     //
@@ -142,13 +298,21 @@ private:
 
 public:
 
-    Moira();
-    virtual ~Moira();
+    MoiraT();
+    virtual ~MoiraT();
 
-    void createJumpTables();
+    // Sets up the jump tables (called once by the first constructed instance)
+    static void createJumpTables();
+
+    /* Registers the instructions of a single group (0 to 7). Each group
+     * instantiates its own share of the instruction handlers. The default
+     * core instantiates each group in a separate translation unit
+     * (MoiraGroup0.cpp to MoiraGroup7.cpp), which enables parallel builds.
+     */
+    template <int G> static void bindGroup();
 
     // Configures the output format of the disassembler
-    void configDasm(bool h, bool u) { hex = h; upper = u; }
+    void configDasm(bool h, bool u) { hex = h; upper = u; flushDasmCache(); }
 
 
     //
@@ -162,17 +326,46 @@ public:
 
     // Executes the next instruction
     void execute();
+
+    /* Selects the timing mode. In precise mode (the default), the CPU calls
+     * sync() in front of and behind each bus access, which allows the host to
+     * emulate other components cycle by cycle. In approximate mode, the CPU
+     * advances its clock internally and calls sync() once per instruction
+     * with the total number of cycles taken.
+     *
+     * All instructions take the same number of cycles and perform the same
+     * bus accesses in both modes. However, in approximate mode, memory
+     * accesses are no longer aligned to the clock of the host, i.e., other
+     * components have not caught up yet when the CPU reads or writes memory.
+     * Changes of the IPL pins are recognized at the next instruction
+     * boundary. For hosts that don't emulate bus contention or other timing
+     * dependent side effects, approximate mode is significantly faster since
+     * it avoids several calls to sync() per instruction. Combine it
+     * with a configuration that disables emulateFC to omit function code
+     * updates as well.
+     */
+    void setPreciseTiming(bool value) { preciseTiming = value; }
+    bool hasPreciseTiming() const { return preciseTiming; }
     
     // Returns true if the CPU is in HALT state
     bool isHalted() const { return flags & CPU_IS_HALTED; }
     
 private:
 
+    // Executes the next instruction (called by execute())
+    void executeNext();
+
+    // Reports the cycles elapsed since the specified clock value via sync()
+    void chargeCycles(i64 start);
+
     // Invoked inside execute() to check for a pending interrupt
     bool checkForIrq();
 
     // Puts the CPU into HALT state
     void halt();
+
+    // Continues program execution at the specified address
+    void jump(u32 addr) override;
     
 
     //
@@ -182,7 +375,37 @@ private:
 public:
 
     // Disassembles a single instruction and returns the instruction size
-    int disassemble(u32 addr, char *str);
+    int disassemble(u32 addr, char *str) override;
+
+    // Number of entries of the disassembler cache
+    static constexpr int DASM_CACHE_SIZE = 256;
+
+    /* Enables or disables the disassembler cache. If enabled, disassemble()
+     * remembers its results, keyed by the address and the words of the
+     * instruction. When an address is disassembled again, the instruction
+     * words are read via read16Dasm() and compared with the cached ones. If
+     * they match, the cached string is returned without decoding and
+     * formatting the instruction again. Hence, the cache never returns stale
+     * results when memory is modified, no matter if the CPU or another
+     * component writes to it. The cache is direct mapped and holds up to
+     * DASM_CACHE_SIZE consecutive instructions without conflicts, which makes
+     * it suitable for debuggers that redraw the code around the PC
+     * repeatedly. It is flushed automatically when the output format changes.
+     */
+    void enableDasmCache(bool value);
+
+    // Invalidates all cached disassembler results
+    void flushDasmCache();
+
+private:
+
+    // Returns the cached result for addr if it is still valid
+    const DasmCacheEntry *lookupDasmCache(u32 addr);
+
+    // Stores a result in the disassembler cache
+    void updateDasmCache(u32 addr, int size, const char *str);
+
+public:
 
     // Returns a textual representation for a single word
     void disassembleWord(u32 value, char *str);
@@ -201,63 +424,94 @@ public:
     // Return an info struct for a certain opcode
     InstrInfo getInfo(u16 op); 
 
+
+    //
+    // Analyzing instruction timing
+    //
+
+public:
+
+    /* Returns the timing information for a certain opcode. The timing table
+     * is derived once, on first use, by probing the handlers of the default
+     * core (see MoiraTiming.cpp). It is shared by all cores. Configurations
+     * that disable mimicMusashi differ in a few instructions (e.g., BCHG,
+     * BCLR, and CHK).
+     */
+    InstrTiming getTiming(u16 op);
+
+    // Estimates the execution time of the instructions in range [addr; end)
+    CycleEstimate estimateCycles(u32 addr, u32 end);
+
+    // Writes the timing table in CSV format
+    void exportTimings(FILE *file);
+
         
     //
     // Interfacing with other components
     //
 
+    /* The core calls the following functions on the host class. The host
+     * hides the ones it wants to customize by functions with the same
+     * signature. The memory accessors read8(), read16(), write8(), and
+     * write16() have no default implementation and must be provided by every
+     * host. If the host declares them protected or private, it needs to
+     * befriend MoiraT.
+     */
+
 protected:
 
-    // Reads a byte or a word from memory
-    virtual u8 read8(u32 addr) = 0;
-    virtual u16 read16(u32 addr) = 0;
+    // Returns the host this core is part of
+    H &host() { return *static_cast<H *>(this); }
+    const H &host() const { return *static_cast<const H *>(this); }
 
     // Special variants used by the reset routine and the disassembler
-    virtual u16 read16OnReset(u32 addr) { return read16(addr); }
-    virtual u16 read16Dasm(u32 addr) { return read16(addr); }
-
-    // Writes a byte or word into memory
-    virtual void write8  (u32 addr, u8  val) = 0;
-    virtual void write16 (u32 addr, u16 val) = 0;
+    u16 read16OnReset(u32 addr) { return host().read16(addr); }
+    u16 read16Dasm(u32 addr) { return host().read16(addr); }
 
     // Provides the interrupt level in IRQ_USER mode
-    virtual u16 readIrqUserVector(u8 level) const { return 0; }
+    u16 readIrqUserVector(u8 level) const { return 0; }
+
+    // Returns the host memory backing a page or nullptr (see enableTLB)
+    u8 *translate(u32 addr, FunctionCode fc, bool write) { return nullptr; }
 
     // Instrution delegates
-    virtual void signalResetInstr() { };
-    virtual void signalStopInstr(u16 op) { };
-    virtual void signalTasInstr() { };
-    virtual void signalJsrBsrInstr(u16 opcode, u32 oldPC, u32 newPC) { };
-    virtual void signalRtsInstr() { };
+    void signalResetInstr() { };
+    void signalStopInstr(u16 op) { };
+    void signalTasInstr() { };
+    void signalJsrBsrInstr(u16 opcode, u32 oldPC, u32 newPC) { };
+    void signalRtsInstr() { };
 
     // State delegates
-    virtual void signalHardReset() { };
-    virtual void signalHalt() { };
+    void signalHardReset() { };
+    void signalHalt() { };
 
     // Exception delegates
-    virtual void signalAddressError(AEStackFrame &frame) { };
-    virtual void signalLineAException(u16 opcode) { };
-    virtual void signalLineFException(u16 opcode) { };
-    virtual void signalIllegalOpcodeException(u16 opcode) { };
-    virtual void signalTraceException() { };
-    virtual void signalTrapException() { };
-    virtual void signalPrivilegeViolation() { };
-    virtual void signalInterrupt(u8 level) { };
-    virtual void signalJumpToVector(int nr, u32 addr) { };
-    virtual void signalSoftwareTrap(u16 opcode, SoftwareTrap trap) { };
+    void signalAddressError(AEStackFrame &frame) { };
+    void signalLineAException(u16 opcode) { };
+    void signalLineFException(u16 opcode) { };
+    void signalIllegalOpcodeException(u16 opcode) { };
+    void signalTraceException() { };
+    void signalTrapException() { };
+    void signalPrivilegeViolation() { };
+    void signalInterrupt(u8 level) { };
+    void signalJumpToVector(int nr, u32 addr) { };
+    void signalSoftwareTrap(u16 opcode, SoftwareTrap trap) { };
 
     // Exception delegates
-    virtual void addressErrorHandler() { };
+    void addressErrorHandler() { };
     
 	// Called when a debug point is reached
-	virtual void softstopReached(u32 addr) { };
-	virtual void breakpointReached(u32 addr) { };
-	virtual void watchpointReached(u32 addr) { };
-	virtual void catchpointReached(u8 vector) { };
-	virtual void swTrapReached(u32 addr) { };
+	void softstopReached(u32 addr) { };
+	void breakpointReached(u32 addr) { };
+	void watchpointReached(u32 addr) { };
+	void catchpointReached(u8 vector) { };
+	void swTrapReached(u32 addr) { };
+
+    // Called by the idle loop detector to check if a location can be polled
+    bool isPollingAddress(u32 addr) { return false; }
 
     // Called at the beginning of each instruction handler (see EXEC_DEBUG)
-    virtual void execDebug(const char *cmd) { };
+    void execDebug(const char *cmd) { };
     
 
     //
@@ -272,7 +526,12 @@ public:
 protected:
 
     // Advances the clock (called before each memory access)
-    virtual void sync(int cycles) { clock += cycles; }
+    void sync(int cycles) { clock += cycles; }
+
+private:
+
+    // Advances the clock by calling sync() or internally (see setPreciseTiming)
+    void advance(int cycles) { if (preciseTiming) host().sync(cycles); else clock += cycles; }
 
 
     //
@@ -359,6 +618,19 @@ public:
 
     u8 getIPL() const { return ipl; }
     void setIPL(u8 val);
+
+    // Enables or disables the interrupt mailbox (must be called on the CPU thread)
+    void enableMailbox(bool value);
+
+    /* Asserts or releases an interrupt level. Other than setIPL(), these
+     * functions are safe to call from any thread. If the mailbox is enabled,
+     * the CPU takes over the highest asserted level at the next instruction
+     * boundary, as if setIPL() had been called right before the instruction
+     * starts. Hence, a posted level is seen after at most the execution time
+     * of the currently running instruction.
+     */
+    void assertIrq(u8 level) { mailbox.fetch_or((u8)(1 << level)); }
+    void releaseIrq(u8 level) { mailbox.fetch_and((u8)~(1 << level)); }
     
 private:
     
@@ -367,6 +639,420 @@ private:
     
     // Selects the IRQ vector to branch to
     u16 getIrqVector(u8 level) const;
+
+
+    //
+    // Skipping idle periods
+    //
+
+public:
+
+    /* Informs the CPU about the clock of the next host event (or NEVER). The
+     * host guarantees that the IPL pins don't change before this event. A
+     * stopped CPU uses this information to advance the clock to the event in
+     * a single call to execute().
+     */
+    i64 getNextEventClock() const { return nextEvent; }
+    void setNextEventClock(i64 cycle) { nextEvent = cycle; }
+
+    /* Enables or disables the idle loop detector. If enabled, the CPU observes
+     * all loops closed by a backward branch (Bcc, BRA, DBcc). If an iteration
+     * leaves all registers unchanged (except the loop counter of a DBcc
+     * instruction) and has no side effects, all subsequent iterations will be
+     * identical up to the next host event. In this case, the CPU skips as many
+     * iterations as possible by advancing the clock in one step. The last
+     * iteration before the event is always executed, which guarantees that
+     * interrupts are accepted at exactly the same cycle as before.
+     *
+     * An iteration has no side effects if it performs no write accesses and
+     * reads data from polling addresses only (see isPollingAddress()). The
+     * host confirms that the values stored at these addresses don't change
+     * before the next event. Reads from program space (instruction fetches
+     * and PC relative operands) are assumed to be stable. Loops are never
+     * skipped if no event is scheduled, if the debugger is active, or if the
+     * interrupt mailbox is enabled.
+     */
+    void enableIdleDetection(bool value);
+
+private:
+
+    // Called by the branch instructions when a backward branch is taken
+    void detectIdleLoop(int counter = -1);
+
+
+    //
+    // Accelerating memory loops
+    //
+
+public:
+
+    /* Registers a memory area that the CPU may access directly. The host
+     * confirms that reading or writing this area has no side effects and
+     * doesn't require wait states. Memory must be stored in 68000 byte order.
+     *
+     * If RAM has been registered and the host has announced its next event,
+     * the CPU executes the following DBcc loops as bulk memory operations:
+     *
+     *     MOVE.x (Ay)+,(Ax)+ / DBF     (memmove)
+     *     CLR.x  (Ax)+       / DBF     (memset)
+     *     CMPM.x (Ay)+,(Ax)+ / DBNE    (memcmp)
+     *
+     * A loop is executed in bulk once a full iteration has been observed in
+     * the interpreter. The clock is advanced by the duration of this iteration
+     * for each skipped one. As for idle loops, the last iteration before the
+     * next event is always executed.
+     */
+    void mapRam(u32 addr, u32 size, u8 *mem);
+    void unmapRam() { ram.clear(); }
+
+private:
+
+    // Returns a pointer to the specified memory range if it is mapped
+    u8 *ramPtr(u32 addr, u32 size);
+
+    // Called by DBcc when a branch to the preceding instruction is taken
+    template <Instr I> void execLoopKernel(int dn);
+
+
+    //
+    // Fusing instructions
+    //
+
+public:
+
+    /* Enables or disables instruction fusion. If enabled, the handlers of
+     * some frequently used instructions dispatch the next instruction right
+     * away instead of returning to execute(). Fusion is applied to the
+     * following instruction pairs:
+     *
+     *     CMP, CMPA, CMPI, TST  +  Bcc, BRA, BSR
+     *     MOVEQ                 +  Any instruction in lines 8, 9, B, C, D, E
+     *     LEA                   +  MOVE
+     *
+     * The second instruction is only dispatched if no CPU flag is set and
+     * the next host event has not been reached. Both instructions are
+     * executed by their ordinary handlers. Hence, the bus accesses and the
+     * cycle counts are the same as in unfused execution. Fusion is only
+     * available in configurations that enable it (see ENABLE_FUSION). In all
+     * other configurations, the instructions above are bound to their plain
+     * handlers.
+     */
+    void enableFusion(bool value);
+
+    // Returns the number of instructions dispatched by a fused handler
+    i64 getFusedPairs() const { return fusedPairs; }
+
+private:
+
+    // Returns the lines (bit n = line n) of all instructions fusable with I
+    static constexpr u16 fusableLines(Instr I) {
+
+        switch (I) {
+            case CMP: case CMPA: case CMPI: case TST: return 1 << 0x6;
+            case MOVEQ: return 1 << 0x8 | 1 << 0x9 | 0xF << 0xB;
+            case LEA: return 1 << 0x1 | 1 << 0x2 | 1 << 0x3;
+            default: return 0;
+        }
+    }
+
+    // Returns the jump table entry for an instruction handler
+    template <Instr I, ExecPtr F> static constexpr ExecPtr fuse() {
+
+        if constexpr (C::fusion && fusableLines(I) != 0) {
+            return &MoiraT::execPair<I, F>;
+        } else {
+            return F;
+        }
+    }
+
+    // Executes an instruction and, if possible, the next one
+    template <Instr I, ExecPtr F> void execPair(u16 opcode);
+
+    // Returns the instruction whose handler executes I (see COMPACT_HANDLERS)
+    static constexpr Instr shared(Instr I) {
+
+        if constexpr (C::compactHandlers) {
+
+            switch (I) {
+
+                case BRA: case BHI: case BLS: case BCC: case BCS: case BNE:
+                case BEQ: case BVC: case BVS: case BPL: case BMI: case BGE:
+                case BLT: case BGT: case BLE:
+                    return BRA;
+
+                case DBT: case DBF: case DBHI: case DBLS: case DBCC: case DBCS:
+                case DBNE: case DBEQ: case DBVC: case DBVS: case DBPL: case DBMI:
+                case DBGE: case DBLT: case DBGT: case DBLE:
+                    return DBT;
+
+                case ST: case SF: case SHI: case SLS: case SCC: case SCS:
+                case SNE: case SEQ: case SVC: case SVS: case SPL: case SMI:
+                case SGE: case SLT: case SGT: case SLE:
+                    return ST;
+
+                default:
+                    return I;
+            }
+        }
+        return I;
+    }
+
+
+    //
+    // Executing cached blocks
+    //
+
+public:
+
+    /* Enables or disables the block cache. If enabled, executeUntil() records
+     * the executed instruction stream in blocks of up to 16 instructions,
+     * together with the resolved handler of each instruction. When a block is
+     * entered again, its instructions are executed in a tight loop without
+     * returning to the host and without decoding the opcodes again.
+     *
+     * Each instruction of a cached block is guarded by its address and its
+     * opcode. The opcode is compared against the prefetched value in IRD,
+     * which means that self-modifying code is always detected. If a guard
+     * fails, e.g., because a branch is taken differently or because an
+     * exception has been triggered, the block is left and execution continues
+     * in the interpreter. The same happens if any CPU flag is set, i.e., in
+     * trace mode, while the debugger is active, or if an interrupt is pending.
+     * Since all instructions are executed by their ordinary handlers, all
+     * bus accesses and calls to sync() are exactly the same as in execute().
+     */
+    void enableBlockCache(bool value);
+
+    // Executes instructions until the clock has reached the specified cycle
+    void executeUntil(i64 cycle);
+
+private:
+
+    // Executes the instructions of a cached block for as long as they match
+    void runBlock(CodeBlock &block, i64 cycle);
+
+    // Executes instructions and records them in a block
+    void recordBlock(CodeBlock &block, i64 cycle);
+
+
+    //
+    // Translating cached blocks
+    //
+
+public:
+
+    // Size of the executable memory region in bytes
+    static constexpr size_t JIT_SIZE = 4 << 20;
+
+    // Number of runs after which a block is translated
+    static constexpr int JIT_THRESHOLD = 2;
+
+    /* Enables or disables the translator. If enabled, blocks of the block
+     * cache (which is enabled, too) are translated into x86-64 machine code
+     * once they have been entered JIT_THRESHOLD times. The translator emits
+     * the same guards as runBlock(). If one of them fails, the block is left
+     * and execution continues in the interpreter. Hence, self-modifying code,
+     * trace mode, the debugger, pending interrupts, and exceptions like
+     * address errors are always handled by the ordinary handlers.
+     *
+     * Register-to-register instructions such as MOVEQ, MOVE, ADD, SUB, AND,
+     * OR, EOR, CMP, ADDQ, SUBQ, TST, NEG, NOT, CLR, SWAP, EXT, and EXG are
+     * translated into native code. All other instructions are compiled into a
+     * direct call of their handler. The native code computes the result and
+     * the condition codes only. It performs bus accesses and advances the
+     * clock by calling the same functions as the handlers, in the same order.
+     * Hence, sync() is called exactly as in execute(). Blocks that end where
+     * they started are translated into a loop that only returns to
+     * executeUntil() if a guard fails or the cycle limit is reached. In
+     * approximate timing mode, each pass returns, which means that the cycles
+     * are charged block by block as with the block cache alone.
+     *
+     * Enabling the translator empties the block cache. Disabling the block
+     * cache disables the translator, too.
+     *
+     * The translator is only available in configurations that enable it (see
+     * ENABLE_JIT) and on x86-64 hosts with a System V ABI (see JIT_AVAILABLE).
+     * On all other hosts, the block cache is used alone. Host callbacks must
+     * not throw exceptions while translated code is executed, because the
+     * generated code carries no unwind information.
+     */
+    void enableJit(bool value);
+
+    // Discards all translated blocks
+    void flushJit();
+
+private:
+
+    // Translates a cached block into machine code
+    void translateBlock(CodeBlock &block);
+
+    // Emits native code for a single instruction (returns false if unsupported)
+    bool translateInstr(JitBuffer &x, u32 pc, u16 op);
+
+    // Functions called by the translated code
+    static void jitPrefetch(void *cpu);
+    static void jitAdvance(void *cpu, int cycles);
+    static void jitExec(void *cpu, u16 opcode);
+
+    // Returns the offset of a member in bytes
+    i32 offset(const void *member) const {
+        return (i32)((const u8 *)member - (const u8 *)this); }
+
+
+    //
+    // Translating addresses
+    //
+
+public:
+
+    // Size of a page and number of entries of the software TLB
+    static constexpr int TLB_PAGE_BITS = 12;
+    static constexpr int TLB_SIZE = 256;
+
+    /* Enables or disables the software TLB. If enabled, the CPU remembers the
+     * host memory backing recently accessed pages, keyed by the function code
+     * and the page number. On a hit, the memory access is carried out inline
+     * without calling read8(), read16(), write8(), or write16(). On a miss,
+     * the CPU asks the host for the page via translate() and caches the
+     * result. Pages for which translate() returns nullptr are cached as well
+     * and accessed via the memory interface, i.e., they don't cause another
+     * call to translate() until the TLB is flushed. The TLB only affects the
+     * way memory is accessed. Bus cycles, sync() calls, and function codes are
+     * the same as without it.
+     *
+     * The host has to flush the TLB whenever a translation becomes invalid,
+     * e.g., if the MMU is reprogrammed or memory is remapped. The TLB is only
+     * available in configurations that enable softwareTLB (see ENABLE_TLB).
+     */
+    void enableTLB(bool value);
+
+    // Invalidates all cached translations
+    void flushTLB();
+
+    // Invalidates all cached translations of the page containing addr
+    void flushTLB(u32 addr);
+
+private:
+
+    // Returns a pointer to the host memory backing an access (if any)
+    template <MemSpace MS, bool write, Size S> u8 *lookupTLB(u32 addr);
+
+    // Asks the host for a page that is not cached yet
+    void refillTLB(TLBEntry &entry, u32 tag, bool write);
+
+
+    //
+    // Tracking dirty pages
+    //
+
+public:
+
+    /* Enables or disables dirty page tracking. If enabled, the CPU sets a bit
+     * in a bitmap for each page it writes to. The page size is 2^pageBits
+     * bytes (valid range: 4 to 24). A value of 0 disables the tracker. Only
+     * writes performed by the CPU are recorded, including those carried out
+     * by the loop kernels. Memory modified by the host or by other bus
+     * masters is not. The tracker is only available in configurations that
+     * enable dirtyTracking (see TRACK_DIRTY_PAGES).
+     */
+    void trackDirtyPages(int pageBits);
+
+    // Calls func(addr, size) for each dirty page in ascending order
+    template <typename F> void collectDirty(F func) const {
+
+        u32 size = 1 << dirtyBits;
+
+        for (size_t i = 0; i < dirty.size(); i++) {
+            for (u64 bits = dirty[i]; bits; bits &= bits - 1) {
+                func((u32)(i * 64 + std::countr_zero(bits)) * size, size);
+            }
+        }
+    }
+
+    // Marks all pages as clean
+    void clearDirty() { std::fill(dirty.begin(), dirty.end(), 0); }
+
+private:
+
+    // Records a write access to the specified memory range
+    void markDirty(u32 addr, u32 size);
+
+
+    //
+    // Emulating traps natively
+    //
+
+public:
+
+    /* A native handler replaces the exception triggered by a TRAP #n, a
+     * LINE-A, or a LINE-F instruction. It is called with the opcode of the
+     * instruction while PC0 still points to it. It returns the number of
+     * cycles to charge for the call or -1 to trigger the exception as usual.
+     * Afterwards, execution continues with the next instruction, unless the
+     * handler has changed the program counter. In this case, execution
+     * continues at the new location.
+     */
+    typedef std::function<int(u16 opcode)> NativeHandler;
+
+    /* Installs a native handler. The opcode must be a TRAP instruction
+     * (4E40 - 4E4F), a LINE-A instruction (Axxx), or a LINE-F instruction
+     * (Fxxx). Installing an empty handler removes it. Software traps set up
+     * by the debugger take precedence over native handlers.
+     */
+    void setNativeHandler(u16 opcode, NativeHandler handler);
+
+    // Removes all native handlers
+    void clearNativeHandlers() { natives.clear(); }
+
+private:
+
+    // Returns the table index of a handler (TRAP, then LINE-A, then LINE-F)
+    static int nativeIndex(u16 opcode) {
+        return (opcode & 0xF000) == 0x4000 ? opcode & 0xF : 16 + (opcode & 0x1FFF); }
+
+    // Calls the native handler for an opcode (returns false if there is none)
+    bool execNative(u16 opcode);
+
+
+    //
+    // Replacing guest routines natively
+    //
+
+public:
+
+    /* A PC hook is called whenever the CPU is about to execute the instruction
+     * at a specific address. It is called with this address while PC and PC0
+     * still point to it. The hook has full access to the registers and to
+     * memory. It returns the number of cycles to charge for the call or -1 to
+     * execute the instruction as usual. If the hook has changed the program
+     * counter, e.g., by calling returnFromHook(), execution continues at the
+     * new location. Otherwise, the instruction at the hooked address is
+     * executed afterwards. The bus cycles of returnFromHook() and of refilling
+     * the prefetch queue are charged in addition. Hooks are looked up through
+     * a page bitmap, which means that code on pages without hooks runs at full
+     * speed. A hook must not install or remove PC hooks itself.
+     */
+    typedef std::function<int(u32 addr)> PCHook;
+
+    // Installs a PC hook (installing an empty hook removes it)
+    void setPCHook(u32 addr, PCHook hook);
+
+    // Removes a PC hook
+    void removePCHook(u32 addr) { setPCHook(addr, nullptr); }
+
+    // Removes all PC hooks
+    void clearPCHooks() { hooks.clear(); hookPages.reset(); }
+
+    // Performs the equivalent of an RTS instruction (to be called by a hook)
+    void returnFromHook();
+
+private:
+
+    // Checks if the page containing addr carries a PC hook
+    bool hooked(u32 addr) const {
+        return hookPages && ((hookPages[(addr >> 18) & 63] >> ((addr >> 12) & 63)) & 1); }
+
+    // Calls the PC hook at the current PC (returns true if the PC has changed)
+    bool execHook();
     
 #include "MoiraInit.h"
 #include "MoiraALU.h"
@@ -375,4 +1061,83 @@ private:
 #include "MoiraDasm.h"
 };
 
+/* The CPU core in its default configuration
+ *
+ * This class connects the core to the host via virtual functions. Subclass it
+ * and override the functions you need. Hosts that want the compiler to inline
+ * their memory accessors derive from MoiraT directly instead.
+ */
+class Moira : public MoiraT<Moira> {
+
+    friend class MoiraT<Moira>;
+    friend class Analyzer;
+
+protected:
+
+    // Reads a byte or a word from memory
+    virtual u8 read8(u32 addr) = 0;
+    virtual u16 read16(u32 addr) = 0;
+
+    // Special variants used by the reset routine and the disassembler
+    virtual u16 read16OnReset(u32 addr) { return read16(addr); }
+    virtual u16 read16Dasm(u32 addr) { return read16(addr); }
+
+    // Writes a byte or word into memory
+    virtual void write8  (u32 addr, u8  val) = 0;
+    virtual void write16 (u32 addr, u16 val) = 0;
+
+    // Provides the interrupt level in IRQ_USER mode
+    virtual u16 readIrqUserVector(u8 level) const { return 0; }
+
+    // Returns the host memory backing a page or nullptr (see enableTLB)
+    virtual u8 *translate(u32 addr, FunctionCode fc, bool write) { return nullptr; }
+
+    // Instrution delegates
+    virtual void signalResetInstr() { };
+    virtual void signalStopInstr(u16 op) { };
+    virtual void signalTasInstr() { };
+    virtual void signalJsrBsrInstr(u16 opcode, u32 oldPC, u32 newPC) { };
+    virtual void signalRtsInstr() { };
+
+    // State delegates
+    virtual void signalHardReset() { };
+    virtual void signalHalt() { };
+
+    // Exception delegates
+    virtual void signalAddressError(AEStackFrame &frame) { };
+    virtual void signalLineAException(u16 opcode) { };
+    virtual void signalLineFException(u16 opcode) { };
+    virtual void signalIllegalOpcodeException(u16 opcode) { };
+    virtual void signalTraceException() { };
+    virtual void signalTrapException() { };
+    virtual void signalPrivilegeViolation() { };
+    virtual void signalInterrupt(u8 level) { };
+    virtual void signalJumpToVector(int nr, u32 addr) { };
+    virtual void signalSoftwareTrap(u16 opcode, SoftwareTrap trap) { };
+
+    // Exception delegates
+    virtual void addressErrorHandler() { };
+    
+	// Called when a debug point is reached
+	virtual void softstopReached(u32 addr) { };
+	virtual void breakpointReached(u32 addr) { };
+	virtual void watchpointReached(u32 addr) { };
+	virtual void catchpointReached(u8 vector) { };
+	virtual void swTrapReached(u32 addr) { };
+
+    // Called by the idle loop detector to check if a location can be polled
+    virtual bool isPollingAddress(u32 addr) { return false; }
+
+    // Called at the beginning of each instruction handler (see EXEC_DEBUG)
+    virtual void execDebug(const char *cmd) { };
+
+    // Advances the clock (called before each memory access)
+    virtual void sync(int cycles) { clock += cycles; }
+};
+
+extern template class MoiraT<Moira>;
+
+// Returns the timing table of the default core (see MoiraTiming.cpp)
+const InstrTiming *timingTable();
+
 }
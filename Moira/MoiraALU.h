@@ -15,7 +15,8 @@
  *         cmp : CMPx
  *       logic : NOT, NEG, NEGX, ANDx, ORx, EORx
  *         bit : BCHG, BSET, BCLR, BTST
- *        cond : Bxx, DBxx, Sx
+ *        cond : Bxx, DBxx, Sx (the opcode variant reads the condition code
+ *               from the opcode if the handlers are shared, see shared())
  */
 
 template <Instr I, Size S> u32  shift(int cnt, u64 data);
@@ -28,6 +29,8 @@ template <Instr I, Size S> u32  logic(u32 op1);
 template <Instr I, Size S> u32  logic(u32 op1, u32 op2);
 template <Instr I>         u32    bit(u32 op,  u8 nr);
 template <Instr I>         bool  cond();
+template <Instr I>         bool  cond(u16 opcode);
+                           bool  cond(u8 cc);
 
 template <Instr I>         int  cyclesBit(u8 nr);
 template <Instr I>         int  cyclesMul(u16 data);
@@ -68,48 +68,39 @@ template<Size S> u32 WRITE(u32 d1, u32 d2) {
     if constexpr (S == Long) return d2;
 }
 
-template<Instr I, Size S> u32
-Moira::shift(int cnt, u64 data) {
+template <class H, class C> template<Instr I, Size S> u32
+MoiraT<H, C>::shift(int cnt, u64 data) {
+
+    // All flags are computed in closed form (cnt ranges from 0 to 63)
+    constexpr int bits = 8 * S;
 
     switch(I) {
 
         case ASL:
         {
-            bool carry = false;
-            u32 changed = 0;
-            for (int i = 0; i < cnt; i++) {
-                carry = NBIT<S>(data);
-                u64 shifted = data << 1;
-                changed |= (u32)(data ^ shifted);
-                data = shifted;
-            }
+            // V is set if the MSB changes, i.e., if the top cnt + 1 bits differ
+            bool carry = cnt && cnt <= bits && ((data >> (bits - cnt)) & 1);
+            u64 mask = cnt < bits ? ((2ULL << cnt) - 1) << (bits - 1 - cnt) : CLIP<S>(~0ULL);
+            u64 top = data & mask;
+            data <<= cnt;
             if (cnt) reg.sr.x = carry;
             reg.sr.c = carry;
-            reg.sr.v = NBIT<S>(changed);
+            reg.sr.v = top != 0 && (top != mask || cnt >= bits);
             break;
         }
         case ASR:
         {
-            bool carry = false;
-            u32 changed = 0;
-            for (int i = 0; i < cnt; i++) {
-                carry = data & 1;
-                u64 shifted = SEXT<S>(data) >> 1;
-                changed |= (u32)(data ^ shifted);
-                data = shifted;
-            }
+            bool carry = cnt && ((data >> (cnt <= bits ? cnt - 1 : bits - 1)) & 1);
+            data = (u64)(i64)(SEXT<S>(data) >> (cnt < bits ? cnt : bits - 1));
             if (cnt) reg.sr.x = carry;
             reg.sr.c = carry;
-            reg.sr.v = NBIT<S>(changed);
+            reg.sr.v = 0;
             break;
         }
         case LSL:
         {
-            bool carry = false;
-            for (int i = 0; i < cnt; i++) {
-                carry = NBIT<S>(data);
-                data = data << 1;
-            }
+            bool carry = cnt && cnt <= bits && ((data >> (bits - cnt)) & 1);
+            data <<= cnt;
             if (cnt) reg.sr.x = carry;
             reg.sr.c = carry;
             reg.sr.v = 0;
@@ -117,11 +108,8 @@ Moira::shift(int cnt, u64 data) {
         }
         case LSR:
         {
-            bool carry = false;
-            for (int i = 0; i < cnt; i++) {
-                carry = data & 1;
-                data = data >> 1;
-            }
+            bool carry = cnt && cnt <= bits && ((data >> (cnt - 1)) & 1);
+            data >>= cnt;
             if (cnt) reg.sr.x = carry;
             reg.sr.c = carry;
             reg.sr.v = 0;
@@ -129,53 +117,43 @@ Moira::shift(int cnt, u64 data) {
         }
         case ROL:
         {
-            bool carry = false;
-            for (int i = 0; i < cnt; i++) {
-                carry = NBIT<S>(data);
-                data = data << 1 | (carry ? 1 : 0);
-            }
-            reg.sr.c = carry;
+            int n = cnt % bits;
+            if (n) data = data << n | data >> (bits - n);
+            reg.sr.c = cnt && (data & 1);
             reg.sr.v = 0;
             break;
         }
         case ROR:
         {
-            bool carry = false;
-            for (int i = 0; i < cnt; i++) {
-                carry = data & 1;
-                data >>= 1;
-                if (carry) data |= MSBIT<S>();
-            }
-            reg.sr.c = carry;
+            int n = cnt % bits;
+            if (n) data = data >> n | data << (bits - n);
+            reg.sr.c = cnt && NBIT<S>(data);
             reg.sr.v = 0;
             break;
         }
         case ROXL:
         {
-            bool carry = reg.sr.x;
-            for (int i = 0; i < cnt; i++) {
-                bool extend = carry;
-                carry = NBIT<S>(data);
-                data = data << 1 | (extend ? 1 : 0);
-            }
+            // Rotate through a (bits + 1) wide value with X on top
+            u64 ext = (u64)reg.sr.x << bits | data;
+            int n = cnt % (bits + 1);
+            if (n) ext = ext << n | ext >> (bits + 1 - n);
+            data = ext;
 
-            reg.sr.x = carry;
-            reg.sr.c = carry;
+            reg.sr.x = (ext >> bits) & 1;
+            reg.sr.c = reg.sr.x;
             reg.sr.v = 0;
             break;
         }
         case ROXR:
         {
-            bool carry = reg.sr.x;
-            for (int i = 0; i < cnt; i++) {
-                bool extend = carry;
-                carry = data & 1;
-                data >>= 1;
-                if (extend) data |= MSBIT<S>();
-            }
+            // Rotate through a (bits + 1) wide value with X on top
+            u64 ext = (u64)reg.sr.x << bits | data;
+            int n = cnt % (bits + 1);
+            if (n) ext = ext >> n | ext << (bits + 1 - n);
+            data = ext;
 
-            reg.sr.x = carry;
-            reg.sr.c = carry;
+            reg.sr.x = (ext >> bits) & 1;
+            reg.sr.c = reg.sr.x;
             reg.sr.v = 0;
             break;
         }
@@ -188,8 +166,8 @@ Moira::shift(int cnt, u64 data) {
     return CLIP<S>(data);
 }
 
-template<Instr I, Size S> u32
-Moira::addsub(u32 op1, u32 op2)
+template <class H, class C> template<Instr I, Size S> u32
+MoiraT<H, C>::addsub(u32 op1, u32 op2)
 {
     u64 result;
 
@@ -244,8 +222,8 @@ Moira::addsub(u32 op1, u32 op2)
     return (u32)result;
 }
 
-template <Instr I> u32
-Moira::mul(u32 op1, u32 op2)
+template <class H, class C> template <Instr I> u32
+MoiraT<H, C>::mul(u32 op1, u32 op2)
 {
     u32 result;
 
@@ -270,12 +248,12 @@ Moira::mul(u32 op1, u32 op2)
     reg.sr.v = 0;
     reg.sr.c = 0;
 
-    sync(cyclesMul<I>((u16)op1));
+    advance(cyclesMul<I>((u16)op1));
     return result;
 }
 
-template <Instr I> u32
-Moira::div(u32 op1, u32 op2)
+template <class H, class C> template <Instr I> u32
+MoiraT<H, C>::div(u32 op1, u32 op2)
 {
     u32 result;
     bool overflow;
@@ -313,12 +291,12 @@ Moira::div(u32 op1, u32 op2)
     reg.sr.n = overflow ? 1        : NBIT<Word>(result);
     reg.sr.z = overflow ? reg.sr.z : ZERO<Word>(result);
 
-    sync(cyclesDiv<I>(op1, (u16)op2) - 4);
+    advance(cyclesDiv<I>(op1, (u16)op2) - 4);
     return overflow ? op1 : result;
 }
 
-template<Instr I, Size S> u32
-Moira::bcd(u32 op1, u32 op2)
+template <class H, class C> template<Instr I, Size S> u32
+MoiraT<H, C>::bcd(u32 op1, u32 op2)
 {
     u64 result;
 
@@ -326,45 +304,31 @@ Moira::bcd(u32 op1, u32 op2)
 
         case ABCD:
         {
-            // Extract nibbles
-            u16 op1_hi = op1 & 0xF0, op1_lo = op1 & 0x0F;
-            u16 op2_hi = op2 & 0xF0, op2_lo = op2 & 0x0F;
-
-            // From portable68000
-            u16 resLo = op1_lo + op2_lo + reg.sr.x;
-            u16 resHi = op1_hi + op2_hi;
-            u64 tmp_result;
-            result = tmp_result = resHi + resLo;
-            if (resLo > 9) result += 6;
-            reg.sr.x = reg.sr.c = (result & 0x3F0) > 0x90;
-            if (reg.sr.c) result += 0x60;
-            if (CLIP<Byte>(result)) reg.sr.z = 0;
-            reg.sr.n = NBIT<Byte>(result);
-            reg.sr.v = ((tmp_result & 0x80) == 0) && ((result & 0x80) == 0x80);
+            // From portable68000 (with the decimal corrections computed branch-free)
+            u16 resLo = (op1 & 0x0F) + (op2 & 0x0F) + reg.sr.x;
+            u16 resHi = (op1 & 0xF0) + (op2 & 0xF0);
+            u64 tmp_result = resHi + resLo;
+            result = tmp_result + 6 * (resLo > 9);
+            bool carry = (result & 0x3F0) > 0x90;
+            result += 0x60 * carry;
+
+            reg.sr.x = reg.sr.c = carry;
+            reg.sr.z &= !CLIP<Byte>(result);
+            reg.sr.v = (~tmp_result & result & 0x80) != 0;
             break;
         }
         case SBCD:
         {
-            // Extract nibbles
-            u16 op1_hi = op1 & 0xF0, op1_lo = op1 & 0x0F;
-            u16 op2_hi = op2 & 0xF0, op2_lo = op2 & 0x0F;
-
-            // From portable68000
-            u16 resLo = op2_lo - op1_lo - reg.sr.x;
-            u16 resHi = op2_hi - op1_hi;
-            u64 tmp_result;
-            result = tmp_result = resHi + resLo;
-            int bcd = 0;
-            if (resLo & 0xf0) {
-                bcd = 6;
-                result -= 6;
-            }
-            if (((op2 - op1 - reg.sr.x) & 0x100) > 0xff) result -= 0x60;
-            reg.sr.c = reg.sr.x = ((op2 - op1 - bcd - reg.sr.x) & 0x300) > 0xff;
+            // From portable68000 (with the decimal corrections computed branch-free)
+            u16 resLo = (op2 & 0x0F) - (op1 & 0x0F) - reg.sr.x;
+            u16 resHi = (op2 & 0xF0) - (op1 & 0xF0);
+            u64 tmp_result = resHi + resLo;
+            int bcd = 6 * ((resLo & 0xF0) != 0);
+            result = tmp_result - bcd - 0x60 * (((op2 - op1 - reg.sr.x) & 0x100) != 0);
 
-            if (CLIP<Byte>(result)) reg.sr.z = 0;
-            reg.sr.n = NBIT<Byte>(result);
-            reg.sr.v = ((tmp_result & 0x80) == 0x80) && ((result & 0x80) == 0);
+            reg.sr.c = reg.sr.x = ((op2 - op1 - bcd - reg.sr.x) & 0x300) != 0;
+            reg.sr.z &= !CLIP<Byte>(result);
+            reg.sr.v = (tmp_result & ~result & 0x80) != 0;
             break;
         }
         default:
@@ -376,8 +340,8 @@ Moira::bcd(u32 op1, u32 op2)
     return (u32)result;
 }
 
-template <Size S> void
-Moira::cmp(u32 op1, u32 op2)
+template <class H, class C> template <Size S> void
+MoiraT<H, C>::cmp(u32 op1, u32 op2)
 {
     u64 result = U64_SUB(op2, op1);
     
@@ -387,8 +351,8 @@ Moira::cmp(u32 op1, u32 op2)
     reg.sr.n = NBIT<S>(result);
 }
 
-template<Instr I, Size S> u32
-Moira::logic(u32 op)
+template <class H, class C> template<Instr I, Size S> u32
+MoiraT<H, C>::logic(u32 op)
 {
     u32 result;
 
@@ -419,8 +383,8 @@ Moira::logic(u32 op)
     return result;
 }
 
-template<Instr I, Size S> u32
-Moira::logic(u32 op1, u32 op2)
+template <class H, class C> template<Instr I, Size S> u32
+MoiraT<H, C>::logic(u32 op1, u32 op2)
 {
     u32 result;
 
@@ -454,8 +418,8 @@ Moira::logic(u32 op1, u32 op2)
     return result;
 }
 
-template <Instr I> u32
-Moira::bit(u32 op, u8 bit)
+template <class H, class C> template <Instr I> u32
+MoiraT<H, C>::bit(u32 op, u8 bit)
 {
     switch (I) {
         case BCHG:
@@ -489,8 +453,8 @@ Moira::bit(u32 op, u8 bit)
     return op;
 }
 
-template <Instr I> bool
-Moira::cond() {
+template <class H, class C> template <Instr I> bool
+MoiraT<H, C>::cond() {
 
     switch(I) {
 
@@ -515,45 +479,68 @@ Moira::cond() {
     fatalError;
 }
 
-template <Instr I> int
-Moira::cyclesBit(u8 bit)
+template <class H, class C> template <Instr I> bool
+MoiraT<H, C>::cond(u16 opcode) {
+
+    if constexpr (C::compactHandlers) {
+        return cond((u8)((opcode >> 8) & 0b1111));
+    } else {
+        return cond<I>();
+    }
+}
+
+template <class H, class C> bool
+MoiraT<H, C>::cond(u8 cc) {
+
+    // Bit NZVC of entry cc is set if condition cc holds for these flags
+    static constexpr u16 table[16] = {
+
+        0xFFFF, 0x0000, 0x0505, 0xFAFA,     // T   F   HI  LS
+        0x5555, 0xAAAA, 0x0F0F, 0xF0F0,     // CC  CS  NE  EQ
+        0x3333, 0xCCCC, 0x00FF, 0xFF00,     // VC  VS  PL  MI
+        0xCC33, 0x33CC, 0x0C03, 0xF3FC      // GE  LT  GT  LE
+    };
+
+    int nzvc = reg.sr.n << 3 | reg.sr.z << 2 | reg.sr.v << 1 | reg.sr.c;
+    return (table[cc] >> nzvc) & 1;
+}
+
+template <class H, class C> template <Instr I> int
+MoiraT<H, C>::cyclesBit(u8 bit)
 {
     switch (I)
     {
         case BTST: return 2;
-        case BCLR: return MIMIC_MUSASHI ? 6 : (bit > 15 ? 6 : 4);
+        case BCLR: return C::mimicMusashi ? 6 : (bit > 15 ? 6 : 4);
         case BSET:
-        case BCHG: return MIMIC_MUSASHI ? 4 : (bit > 15 ? 4 : 2);
+        case BCHG: return C::mimicMusashi ? 4 : (bit > 15 ? 4 : 2);
     }
 
     fatalError;
 }
 
-template <Instr I> int
-Moira::cyclesMul(u16 data)
+template <class H, class C> template <Instr I> int
+MoiraT<H, C>::cyclesMul(u16 data)
 {
-    int mcycles = 17;
-
     switch (I)
     {
         case MULU:
         {
-            for (; data; data >>= 1) if (data & 1) mcycles++;
-            return 2 * mcycles;
+            // Two cycles for each set bit
+            return 2 * (17 + std::popcount(data));
         }
         case MULS:
         {
-            data = ((data << 1) ^ data) & 0xFFFF;
-            for (; data; data >>= 1) if (data & 1) mcycles++;
-            return 2 * mcycles;
+            // Two cycles for each 01 or 10 bit pattern
+            return 2 * (17 + std::popcount((u16)((data << 1) ^ data)));
         }
     }
 
     fatalError;
 }
 
-template <Instr I> int
-Moira::cyclesDiv(u32 op1, u16 op2)
+template <class H, class C> template <Instr I> int
+MoiraT<H, C>::cyclesDiv(u32 op1, u16 op2)
 {
     switch (I)
     {
@@ -567,21 +554,14 @@ Moira::cyclesDiv(u32 op1, u16 op2)
             if ((dividend >> 16) >= divisor) return 10;
             u32 hdivisor = divisor << 16;
 
+            // Each step takes 0 (MSB set), 1 (subtracted), or 2 extra cycles
             for (int i = 0; i < 15; i++) {
-                if ((i32)dividend < 0) {
-                    // dividend <<= 1;
-                    dividend = (u32)((u64)dividend << 1);
-                    dividend = U32_SUB(dividend, hdivisor);
-                } else {
-                    // dividend <<= 1;
-                    dividend = (u32)((u64)dividend << 1);
-                    if (dividend >= hdivisor) {
-                        dividend = U32_SUB(dividend, hdivisor);
-                        mcycles += 1;
-                    } else {
-                        mcycles += 2;
-                    }
-                }
+
+                u32 msb = dividend >> 31;
+                dividend = (u32)((u64)dividend << 1);
+                u32 sub = msb | (dividend >= hdivisor);
+                dividend = U32_SUB(dividend, hdivisor & (0 - sub));
+                mcycles += (int)((2 - sub) * (1 - msb));
             }
             return 2 * mcycles;
         }
@@ -601,20 +581,17 @@ Moira::cyclesDiv(u32 op1, u16 op2)
                 mcycles += (dividend < 0) ? 1 : -1;
             }
 
+            // One extra cycle for each cleared bit in bits 15 to 1 of the quotient
             u32 aquot = abs(dividend) / abs(divisor);
-            for (int i = 0; i < 15; i++) {
-                if ( (i16)aquot >= 0) mcycles++;
-                aquot <<= 1;
-            }
-            return 2 * mcycles;
+            return 2 * (mcycles + 15 - std::popcount(aquot & 0xFFFE));
         }
     }
 
     fatalError;
 }
 
-template <Instr I> u32
-Moira::mulMusashi(u32 op1, u32 op2)
+template <class H, class C> template <Instr I> u32
+MoiraT<H, C>::mulMusashi(u32 op1, u32 op2)
 {
     u32 result;
 
@@ -642,8 +619,8 @@ Moira::mulMusashi(u32 op1, u32 op2)
     return result;
 }
 
-template <Instr I> u32
-Moira::divMusashi(u32 op1, u32 op2)
+template <class H, class C> template <Instr I> u32
+MoiraT<H, C>::divMusashi(u32 op1, u32 op2)
 {
     u32 result;
 
@@ -651,7 +628,7 @@ Moira::divMusashi(u32 op1, u32 op2)
 
         case DIVS:
         {
-            sync(154);
+            advance(154);
 
             if (op1 == 0x80000000 && (i32)op2 == -1) {
 
@@ -683,7 +660,7 @@ Moira::divMusashi(u32 op1, u32 op2)
         }
         case DIVU:
         {
-            sync(136);
+            advance(136);
 
             i64 quotient  = op1 / op2;
             u16 remainder = (u16)(op1 % op2);
@@ -0,0 +1,427 @@
+// -----------------------------------------------------------------------------
+// This file is part of Moira - A Motorola 68k emulator
+//
+// Copyright (C) Dirk W. Hoffmann. www.dirkwhoffmann.de
+// Licensed under the GNU General Public License v3
+//
+// See https://www.gnu.org for license information
+// -----------------------------------------------------------------------------
+
+#include "Moira.h"
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+namespace moira {
+
+void
+Analyzer::addVectors(u32 base)
+{
+    // Vector 0 holds the initial stack pointer and is skipped
+    for (u32 nr = 1; nr < 256; nr++) {
+
+        u32 addr = base + 4 * nr;
+        u32 vec = (moira.read16Dasm(addr) << 16 | moira.read16Dasm(addr + 2)) & 0xFFFFFF;
+
+        // Skip all vectors that obviously don't point to code
+        if (vec && !(vec & 1) && inRange(vec)) addEntry(vec);
+    }
+}
+
+void
+Analyzer::analyze(int threads)
+{
+    blocks.clear();
+    edges.clear();
+    functions.clear();
+    xrefs.clear();
+    indirect.clear();
+
+    if (threads <= 0) threads = std::max(1, (int)std::thread::hardware_concurrency());
+
+    // Bitmap marking all visited instruction addresses (one bit per word)
+    std::vector<std::atomic<u64>> visited((((upper - lower) >> 1) + 64) / 64);
+
+    // Entry points and call targets that are waiting to be processed
+    std::vector<u32> pending = entries;
+
+    // Number of threads currently processing an entry point
+    int busy = 0;
+
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::vector<std::vector<Instruction>> results(threads);
+
+    // Marks an address as visited and returns true if it hasn't been before
+    auto claim = [&](u32 addr) {
+
+        u32 bit = (addr - lower) >> 1;
+        u64 mask = 1ULL << (bit & 63);
+        return !(visited[bit >> 6].fetch_or(mask) & mask);
+    };
+
+    auto worker = [&](std::vector<Instruction> &out) {
+
+        std::vector<u32> stack;
+
+        while (true) {
+
+            // Grab the next entry point or terminate if all work is done
+            {   std::unique_lock<std::mutex> lock(mutex);
+                cv.wait(lock, [&]() { return !pending.empty() || busy == 0; });
+                if (pending.empty()) return;
+                stack.push_back(pending.back());
+                pending.pop_back();
+                busy++;
+            }
+
+            while (!stack.empty()) {
+
+                u32 addr = stack.back();
+                stack.pop_back();
+
+                // Follow the instruction stream until the control flow changes
+                while (inRange(addr) && !(addr & 1) && claim(addr)) {
+
+                    auto instr = decode(addr);
+                    out.push_back(instr);
+
+                    if (instr.target && inRange(*instr.target)) {
+
+                        if (instr.calls) {
+
+                            // Hand over subroutines to other threads
+                            { std::lock_guard<std::mutex> lock(mutex); pending.push_back(*instr.target); }
+                            cv.notify_one();
+
+                        } else if (instr.branches) {
+
+                            stack.push_back(*instr.target);
+                        }
+                    }
+                    if (!instr.fallthrough) break;
+                    addr = (addr + instr.len) & 0xFFFFFF;
+                }
+            }
+
+            { std::lock_guard<std::mutex> lock(mutex); busy--; }
+            cv.notify_all();
+        }
+    };
+
+    if (threads == 1) {
+
+        worker(results[0]);
+
+    } else {
+
+        std::vector<std::thread> pool;
+        for (int i = 0; i < threads; i++) pool.emplace_back(worker, std::ref(results[i]));
+        for (auto &t : pool) t.join();
+    }
+
+    std::vector<u64> decoded(visited.size());
+    for (size_t i = 0; i < visited.size(); i++) decoded[i] = visited[i].load();
+
+    build(results, decoded);
+}
+
+const BasicBlock *
+Analyzer::blockAt(u32 addr) const
+{
+    auto it = blocks.upper_bound(addr);
+    if (it == blocks.begin()) return nullptr;
+
+    it--;
+    return addr < it->second.end ? &it->second : nullptr;
+}
+
+Analyzer::Instruction
+Analyzer::decode(u32 addr) const
+{
+    char str[128];
+
+    u16 op = moira.read16Dasm(addr);
+    auto info = moira.getInfo(op);
+
+    Instruction result;
+    result.addr = addr;
+    result.len = (u8)moira.disassemble(addr, str);
+    result.I = (u8)info.I;
+    result.fallthrough = true;
+    result.branches = false;
+    result.calls = false;
+
+    // Computes the target of a PC relative branch
+    auto relative = [&]() {
+
+        i32 disp;
+        switch (info.S) {
+
+            case Byte: disp = (i8)op; break;
+            case Word: disp = (i16)moira.read16Dasm(addr + 2); break;
+            default:   disp = (i32)(moira.read16Dasm(addr + 2) << 16 | moira.read16Dasm(addr + 4));
+        }
+        u32 target = (addr + 2 + disp) & 0xFFFFFF;
+        return (target & 1) ? std::optional<u32>() : std::optional<u32>(target);
+    };
+
+    switch (info.I) {
+
+        case BRA:
+
+            result.branches = true;
+            result.fallthrough = false;
+            result.target = relative();
+            break;
+
+        case BSR:
+
+            result.calls = true;
+            result.target = relative();
+            break;
+
+        case BCC: case BCS: case BEQ: case BGE: case BGT: case BHI: case BLE:
+        case BLS: case BLT: case BMI: case BNE: case BPL: case BVC: case BVS:
+
+            result.branches = true;
+            result.target = relative();
+            break;
+
+        case DBCC: case DBCS: case DBEQ: case DBGE: case DBGT: case DBHI:
+        case DBLE: case DBLS: case DBLT: case DBMI: case DBNE: case DBPL:
+        case DBVC: case DBVS: case DBF:
+
+            result.branches = true;
+            result.target = (addr + 2 + (i16)moira.read16Dasm(addr + 2)) & 0xFFFFFF;
+            break;
+
+        case JMP:
+
+            result.branches = true;
+            result.fallthrough = false;
+            result.target = resolve(addr, op, info.I, info.M, info.S);
+            break;
+
+        case JSR:
+
+            result.calls = true;
+            result.target = resolve(addr, op, info.I, info.M, info.S);
+            break;
+
+        case RTS:
+        case RTE:
+        case RTR:
+        case ILLEGAL:
+
+            result.fallthrough = false;
+            break;
+
+        default:
+
+            result.data = resolve(addr, op, info.I, info.M, info.S);
+            break;
+    }
+
+    return result;
+}
+
+std::optional<u32>
+Analyzer::resolve(u32 addr, u16 op, Instr I, Mode M, Size S) const
+{
+    // Determine the location of the first extension word of the operand
+    u32 ext = addr + 2;
+
+    switch (I) {
+
+        case ADDI: case ANDI: case CMPI: case EORI: case ORI: case SUBI:
+
+            ext += S == Long ? 4 : 2;
+            break;
+
+        case BCHG: case BCLR: case BSET: case BTST:
+
+            if (!(op & 0x100)) ext += 2;
+            break;
+
+        case MOVEM:
+
+            ext += 2;
+            break;
+
+        default:
+            break;
+    }
+
+    switch (M) {
+
+        case MODE_AW:
+
+            return (u32)(i16)moira.read16Dasm(ext) & 0xFFFFFF;
+
+        case MODE_AL:
+
+            return (moira.read16Dasm(ext) << 16 | moira.read16Dasm(ext + 2)) & 0xFFFFFF;
+
+        case MODE_DIPC:
+
+            return (ext + (i16)moira.read16Dasm(ext)) & 0xFFFFFF;
+
+        default:
+
+            return { };
+    }
+}
+
+void
+Analyzer::build(std::vector<std::vector<Instruction>> &results, const std::vector<u64> &decoded)
+{
+    auto words = decoded.size();
+
+    // Helper functions for accessing bitmaps
+    auto bit = [&](u32 addr) { return (addr - lower) >> 1; };
+    auto test = [&](const std::vector<u64> &map, u32 addr) {
+        return inRange(addr) && !(addr & 1) && ((map[bit(addr) >> 6] >> (bit(addr) & 63)) & 1);
+    };
+    auto set = [&](std::vector<u64> &map, u32 addr) {
+        if (inRange(addr) && !(addr & 1)) map[bit(addr) >> 6] |= 1ULL << (bit(addr) & 63);
+    };
+
+    // Merge and sort the decoded instructions by ranking their addresses
+    std::vector<u32> rank(words);
+    for (size_t i = 0, sum = 0; i < words; sum += std::popcount(decoded[i++])) rank[i] = (u32)sum;
+
+    auto position = [&](u32 addr) {
+        u32 b = bit(addr);
+        return rank[b >> 6] + std::popcount(decoded[b >> 6] & ((1ULL << (b & 63)) - 1));
+    };
+
+    size_t count = 0;
+    for (auto &r : results) count += r.size();
+
+    std::vector<Instruction> instrs(count);
+    for (auto &r : results) {
+        for (auto &in : r) instrs[position(in.addr)] = in;
+        r = { };
+    }
+
+    // Collect all addresses starting a new block and all cross references
+    std::vector<u64> leaders(words);
+    std::vector<XRef> refs;
+
+    for (auto &e : entries) set(leaders, e);
+    for (auto &in : instrs) {
+
+        if (in.target && (in.branches || in.calls)) {
+
+            set(leaders, *in.target);
+            refs.push_back(XRef { in.addr, *in.target,
+                in.calls ? XREF_CALL : in.I == JMP ? XREF_JUMP : XREF_BRANCH });
+
+        } else if (in.branches || in.calls) {
+
+            indirect.push_back(in.addr);
+        }
+        if (in.data) {
+
+            refs.push_back(XRef { in.addr, *in.data, XREF_DATA });
+        }
+    }
+    std::stable_sort(refs.begin(), refs.end(),
+                     [](const XRef &a, const XRef &b) { return a.to < b.to; });
+    for (auto &r : refs) xrefs.emplace_hint(xrefs.end(), r.to, r);
+
+    // Split the instruction stream into basic blocks
+    BasicBlock *block = nullptr;
+    for (size_t i = 0; i < instrs.size(); i++) {
+
+        auto &in = instrs[i];
+
+        bool split = block == nullptr;
+        if (!split) {
+
+            auto &prev = instrs[i - 1];
+            split =
+            prev.branches || prev.calls || !prev.fallthrough ||
+            prev.addr + prev.len != in.addr || test(leaders, in.addr);
+        }
+        if (split) {
+
+            block = &blocks.emplace_hint(blocks.end(), in.addr, BasicBlock { })->second;
+            block->start = in.addr;
+            block->count = 0;
+        }
+        block->last = in.addr;
+        block->end = in.addr + in.len;
+        block->count++;
+    }
+
+    // Connect the blocks
+    for (auto it = blocks.begin(); it != blocks.end(); it++) {
+
+        auto &b = it->second;
+        auto &in = instrs[position(b.last)];
+        auto next = std::next(it);
+
+        if (in.fallthrough && next != blocks.end() && next->first == b.end) {
+
+            edges.push_back(Edge { in.addr, b.end, EDGE_FALLTHROUGH });
+            b.successors.push_back(b.end);
+        }
+        if (in.target && test(decoded, *in.target)) {
+
+            if (in.calls) {
+
+                edges.push_back(Edge { in.addr, *in.target, EDGE_CALL });
+
+            } else if (in.branches) {
+
+                edges.push_back(Edge { in.addr, *in.target, EDGE_BRANCH });
+                if (*in.target != b.end) b.successors.push_back(*in.target);
+            }
+        }
+    }
+
+    // Every entry point and every call target starts a function
+    std::vector<u32> heads;
+    for (auto &e : entries) if (blocks.contains(e)) heads.push_back(e);
+    for (auto &e : edges) if (e.type == EDGE_CALL) heads.push_back(e.to);
+
+    // Index all blocks to speed up the reachability analysis below
+    std::vector<BasicBlock *> index;
+    std::vector<u32> starts;
+    for (auto &it : blocks) { index.push_back(&it.second); starts.push_back(it.first); }
+    auto indexOf = [&](u32 addr) {
+        return std::lower_bound(starts.begin(), starts.end(), addr) - starts.begin();
+    };
+    std::vector<long> stamp(index.size(), -1);
+
+    for (long nr = 0; nr < (long)heads.size(); nr++) {
+
+        if (functions.contains(heads[nr])) continue;
+
+        // Collect all blocks reachable without following calls
+        auto &f = functions[heads[nr]];
+        f.entry = heads[nr];
+
+        std::vector<long> stack = { indexOf(heads[nr]) };
+        while (!stack.empty()) {
+
+            long i = stack.back();
+            stack.pop_back();
+
+            if (stamp[i] == nr) continue;
+            stamp[i] = nr;
+            f.blocks.push_back(index[i]->start);
+
+            for (auto &s : index[i]->successors) stack.push_back(indexOf(s));
+        }
+        std::sort(f.blocks.begin(), f.blocks.end());
+    }
+}
+
+}
@@ -0,0 +1,197 @@
+// -----------------------------------------------------------------------------
+// This file is part of Moira - A Motorola 68k emulator
+//
+// Copyright (C) Dirk W. Hoffmann. www.dirkwhoffmann.de
+// Licensed under the GNU General Public License v3
+//
+// See https://www.gnu.org for license information
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+#include "MoiraConfig.h"
+#include "MoiraTypes.h"
+#include <map>
+#include <vector>
+
+namespace moira {
+
+//
+// Elements of a control-flow graph
+//
+
+typedef enum
+{
+    EDGE_FALLTHROUGH,   // Execution continues with the next instruction
+    EDGE_BRANCH,        // Taken branch (Bcc, DBcc, BRA, JMP)
+    EDGE_CALL           // Subroutine call (BSR, JSR)
+}
+EdgeType;
+
+typedef enum
+{
+    XREF_BRANCH,        // Referenced by Bcc, DBcc, or BRA
+    XREF_JUMP,          // Referenced by JMP
+    XREF_CALL,          // Referenced by BSR or JSR
+    XREF_DATA           // Referenced by a memory operand or by LEA, PEA
+}
+XRefType;
+
+struct Edge {
+
+    // Address of the branching instruction
+    u32 from;
+
+    // Start address of the target block
+    u32 to;
+
+    EdgeType type;
+};
+
+struct XRef {
+
+    // Address of the referencing instruction
+    u32 from;
+
+    // Referenced address
+    u32 to;
+
+    XRefType type;
+};
+
+struct BasicBlock {
+
+    // Address of the first instruction
+    u32 start;
+
+    // Address of the last instruction
+    u32 last;
+
+    // Address following the last instruction
+    u32 end;
+
+    // Number of instructions
+    int count;
+
+    // Start addresses of all successor blocks (calls are not included)
+    std::vector<u32> successors;
+};
+
+struct Function {
+
+    // Entry address
+    u32 entry;
+
+    // Start addresses of all blocks reachable from the entry (sorted)
+    std::vector<u32> blocks;
+};
+
+
+//
+// Static control-flow graph recovery
+//
+
+class Analyzer {
+
+    // A decoded instruction
+    struct Instruction {
+
+        u32 addr;
+        u8  len;
+        u8  I;
+
+        // Flow control properties
+        bool fallthrough;
+        bool branches;
+        bool calls;
+
+        // Target address of a branch, jump, or subroutine call (if known)
+        std::optional<u32> target;
+
+        // Address referenced by a memory operand (if known)
+        std::optional<u32> data;
+    };
+
+    // Reference to the connected CPU
+    class Moira &moira;
+
+    // Address range to analyze (instructions outside are not followed)
+    u32 lower = 0;
+    u32 upper = 0xFFFFFF;
+
+    // Addresses to start the analysis at
+    std::vector<u32> entries;
+
+public:
+
+    // Basic blocks, indexed by their start address
+    std::map<u32, BasicBlock> blocks;
+
+    // Edges between basic blocks
+    std::vector<Edge> edges;
+
+    // Functions, indexed by their entry address
+    std::map<u32, Function> functions;
+
+    // Cross references, indexed by the referenced address
+    std::multimap<u32, XRef> xrefs;
+
+    // Addresses of jumps and calls with an unknown target, e.g., JMP (A0)
+    std::vector<u32> indirect;
+
+
+    //
+    // Constructing
+    //
+
+public:
+
+    Analyzer(Moira& ref) : moira(ref) { }
+
+    // Restricts the analysis to the specified address range
+    void setRange(u32 first, u32 last) { lower = first; upper = last; }
+
+
+    //
+    // Adding entry points
+    //
+
+    // Adds a single entry point
+    void addEntry(u32 addr) { entries.push_back(addr & 0xFFFFFF); }
+
+    // Adds the reset vector and all exception vectors of a vector table
+    void addVectors(u32 base = 0);
+
+
+    //
+    // Analyzing
+    //
+
+    /* Recursively disassembles the code reachable from all entry points and
+     * builds the control-flow graph. The entry points are distributed among
+     * the specified number of threads (0 = number of hardware threads).
+     * Instructions are read with read16Dasm() which must be side-effect free
+     * and safe to call from multiple threads. The analysis requires the
+     * disassembler (ENABLE_DASM) and the info table (BUILD_INSTR_INFO_TABLE).
+     */
+    void analyze(int threads = 0);
+
+    // Returns the block containing the specified address (if any)
+    const BasicBlock *blockAt(u32 addr) const;
+
+private:
+
+    // Checks if an address is inside the analyzed range
+    bool inRange(u32 addr) const { return addr >= lower && addr <= upper; }
+
+    // Decodes a single instruction
+    Instruction decode(u32 addr) const;
+
+    // Computes the address referenced by the first effective address operand
+    std::optional<u32> resolve(u32 addr, u16 op, Instr I, Mode M, Size S) const;
+
+    // Assembles the control-flow graph from the decoded instructions
+    void build(std::vector<std::vector<Instruction>> &results, const std::vector<u64> &decoded);
+};
+
+}
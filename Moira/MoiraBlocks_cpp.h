@@ -0,0 +1,92 @@
+// -----------------------------------------------------------------------------
+// This file is part of Moira - A Motorola 68k emulator
+//
+// Copyright (C) Dirk W. Hoffmann. www.dirkwhoffmann.de
+// Licensed under the GNU General Public License v3
+//
+// See https://www.gnu.org for license information
+// -----------------------------------------------------------------------------
+
+template <class H, class C> void
+MoiraT<H, C>::enableBlockCache(bool value)
+{
+    blocks.clear();
+    if (value) blocks.resize(1024, CodeBlock { });
+}
+
+template <class H, class C> void
+MoiraT<H, C>::executeUntil(i64 cycle)
+{
+    while (clock < cycle) {
+
+        // Process flags and PC hooks in the interpreter
+        if (flags || blocks.empty() || hooked(reg.pc)) {
+            execute();
+            continue;
+        }
+
+        auto &block = blocks[(reg.pc >> 1) & (blocks.size() - 1)];
+        i64 start = clock;
+
+        if (block.count && block.pc[0] == reg.pc && block.op[0] == queue.ird) {
+
+            if constexpr (C::enableJit) {
+
+                if (block.native) {
+                    block.native(this, cycle);
+                } else {
+                    runBlock(block, cycle);
+                    if (jit && ++block.runs == JIT_THRESHOLD) translateBlock(block);
+                }
+
+            } else {
+
+                runBlock(block, cycle);
+            }
+
+        } else {
+            recordBlock(block, cycle);
+        }
+
+        if (!preciseTiming) chargeCycles(start);
+    }
+}
+
+template <class H, class C> void
+MoiraT<H, C>::runBlock(CodeBlock &block, i64 cycle)
+{
+    for (int i = 0; i < block.count; i++) {
+
+        // Leave the block if the instruction stream has changed
+        if (flags || clock >= cycle) return;
+        if (reg.pc != block.pc[i] || queue.ird != block.op[i]) return;
+        if (i && hooked(reg.pc)) return;
+
+        reg.pc += 2;
+        (this->*block.handler[i])(block.op[i]);
+    }
+}
+
+template <class H, class C> void
+MoiraT<H, C>::recordBlock(CodeBlock &block, i64 cycle)
+{
+    block.count = 0;
+    block.runs = 0;
+    block.native = nullptr;
+
+    do {
+
+        int i = block.count++;
+
+        block.pc[i] = reg.pc;
+        block.op[i] = queue.ird;
+        block.handler[i] = exec[queue.ird];
+
+        reg.pc += 2;
+        (this->*block.handler[i])(block.op[i]);
+
+    } while (block.count < 16 && !flags && clock < cycle && !hooked(reg.pc) &&
+             reg.pc != block.pc[0]);
+
+    block.next = reg.pc;
+}
@@ -30,11 +30,21 @@
 
 /* Set to true to enable the disassembler.
  *
- * The disassembler requires a jump table which consumes about 1MB of memory.
- * By disabling the disassembler, you can save this amount of memory.
+ * The disassembler looks up the instruction, the addressing mode, and the size
+ * attribute of an opcode in the info table, which is therefore built whenever
+ * the disassembler is enabled (see BUILD_INSTR_INFO_TABLE). By disabling both,
+ * you can save about 850 KB of memory.
  */
 #define ENABLE_DASM true
 
+/* Set to true to enable the debugger.
+ *
+ * The debugger provides breakpoints, watchpoints, catchpoints, software traps,
+ * and instruction logging. If disabled, the debugger is replaced by an empty
+ * placeholder and all checks for debug events are removed from the core.
+ */
+#define ENABLE_DEBUGGER true
+
 /* Set to true to build the InstrInfo lookup table.
  *
  * The info table stores information about the instruction (Instr I), the
@@ -45,6 +55,49 @@
  */
 #define BUILD_INSTR_INFO_TABLE true
 
+/* Set to true to build the software TLB.
+ *
+ * The software TLB accelerates hosts that translate addresses with an MMU
+ * (see enableTLB()). Because it adds a check to each memory access, it is
+ * compiled in on request only.
+ */
+#define ENABLE_TLB false
+
+/* Set to true to build the dirty page tracker.
+ *
+ * The tracker records the memory pages written by the CPU (see
+ * trackDirtyPages()). Because it adds a check to each write access, it is
+ * compiled in on request only.
+ */
+#define TRACK_DIRTY_PAGES false
+
+/* Set to true to build the block translator.
+ *
+ * The translator compiles blocks of the block cache into x86-64 machine code
+ * (see enableJit()). It only takes effect on x86-64 hosts. On all other hosts,
+ * enabling it falls back to the block cache.
+ */
+#define ENABLE_JIT false
+
+/* Set to true to build the fused instruction handlers.
+ *
+ * If enabled, the jump table entries of CMP, CMPA, CMPI, TST, MOVEQ, and LEA
+ * point to wrappers that dispatch the next instruction right away (see
+ * enableFusion()). If disabled, these instructions are bound to their plain
+ * handlers and fusion is not available.
+ */
+#define ENABLE_FUSION false
+
+/* Set to true to share instruction handlers among condition codes.
+ *
+ * By default, each condition code of Bcc, DBcc, and Scc gets its own handler,
+ * which evaluates the condition at compile time. If enabled, all condition
+ * codes share a single handler per addressing mode, which evaluates the
+ * condition via a small lookup table. This removes about 170 handlers from
+ * the binary, which reduces the instruction cache footprint of the core.
+ */
+#define COMPACT_HANDLERS false
+
 /* Set to true to run Moira in a special Musashi compatibility mode.
  *
  * The compatibility mode is used by the test runner application to compare
@@ -54,6 +107,50 @@
  */
 #define MIMIC_MUSASHI true
 
+/* Configuration policies
+ *
+ * The macros above define the default configuration, which is used by class
+ * Moira. All other cores are instances of the MoiraT class template that
+ * receive their configuration as a policy class. A policy provides the
+ * following compile-time constants, each of which replaces the corresponding
+ * macro. Since all of them are evaluated at compile time, disabled features
+ * don't cost anything. Differently configured cores can coexist in the same
+ * process (see MoiraImpl.h).
+ */
+namespace moira {
+
+struct DefaultConfig {
+
+    static constexpr bool emulateAddressError = EMULATE_ADDRESS_ERROR;
+    static constexpr bool emulateFC = EMULATE_FC;
+    static constexpr bool enableDasm = ENABLE_DASM;
+    static constexpr bool enableDebugger = ENABLE_DEBUGGER;
+    static constexpr bool buildInstrInfoTable = BUILD_INSTR_INFO_TABLE;
+    static constexpr bool softwareTLB = ENABLE_TLB;
+    static constexpr bool dirtyTracking = TRACK_DIRTY_PAGES;
+    static constexpr bool enableJit = ENABLE_JIT;
+    static constexpr bool fusion = ENABLE_FUSION;
+    static constexpr bool compactHandlers = COMPACT_HANDLERS;
+    static constexpr bool mimicMusashi = MIMIC_MUSASHI;
+};
+
+/* Minimal footprint configuration
+ *
+ * This profile is intended for embedded hosts and hosts running many CPU
+ * instances side by side. It compiles out the debugger, the disassembler,
+ * and the InstrInfo table. What remains is the shared instruction jump table
+ * and less than 1 KB of mutable state per instance.
+ */
+struct MinimalConfig : DefaultConfig {
+
+    static constexpr bool enableDasm = false;
+    static constexpr bool enableDebugger = false;
+    static constexpr bool buildInstrInfoTable = false;
+    static constexpr bool mimicMusashi = false;
+};
+
+}
+
 /* Execution debugging
  *
  * This macro is evaluated at the beginning of the execution handlers of all
@@ -20,3 +20,19 @@ int outerDispWords(u16 ext);
 
 // Assembles an operand
 template <Mode M, Size S> Ea<M,S> Op(u16 reg, u32 &pc);
+
+// Registers a disassembler handler in the dasm table
+template <Instr I, Mode M, Size S> static void bindDasm(DasmPtr handler);
+
+/* Handlers for instructions whose variants share an info table entry. They
+ * select the variant by inspecting the opcode.
+ */
+template <Instr I, Mode M, Size S> void dasmAdd(StrWriter &str, u32 &addr, u16 op);
+template <Instr I, Mode M, Size S> void dasmAnd(StrWriter &str, u32 &addr, u16 op);
+template <Instr I, Mode M, Size S> void dasmBit(StrWriter &str, u32 &addr, u16 op);
+template <Instr I, Mode M, Size S> void dasmExg(StrWriter &str, u32 &addr, u16 op);
+template <Instr I, Mode M, Size S> void dasmMove(StrWriter &str, u32 &addr, u16 op);
+template <Instr I, Mode M, Size S> void dasmMovem(StrWriter &str, u32 &addr, u16 op);
+template <Instr I, Mode M, Size S> void dasmMovep(StrWriter &str, u32 &addr, u16 op);
+template <Instr I, Mode M, Size S> void dasmMoveTo(StrWriter &str, u32 &addr, u16 op);
+template <Instr I, Mode M, Size S> void dasmMoveUsp(StrWriter &str, u32 &addr, u16 op);
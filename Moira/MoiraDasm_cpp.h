@@ -7,30 +7,22 @@
 // See https://www.gnu.org for license information
 // -----------------------------------------------------------------------------
 
-template <> u32
-Moira::dasmRead<Byte>(u32 &addr)
+template <class H, class C> template <Size S> u32
+MoiraT<H, C>::dasmRead(u32 &addr)
 {
-    U32_INC(addr, 2);
-    return read16Dasm(addr) & 0xFF;
-}
+    if constexpr (S == Long) {
 
-template <> u32
-Moira::dasmRead<Word>(u32 &addr)
-{
-    U32_INC(addr, 2);
-    return read16Dasm(addr);
-}
+        u32 result = dasmRead<Word>(addr) << 16;
+        result |= dasmRead<Word>(addr);
+        return result;
+    }
 
-template <> u32
-Moira::dasmRead<Long>(u32 &addr)
-{
-    u32 result = dasmRead<Word>(addr) << 16;
-    result |= dasmRead<Word>(addr);
-    return result;
+    U32_INC(addr, 2);
+    return S == Byte ? host().read16Dasm(addr) & 0xFF : host().read16Dasm(addr);
 }
 
-int
-Moira::baseDispWords(u16 ext)
+template <class H, class C> int
+MoiraT<H, C>::baseDispWords(u16 ext)
 {
     u16 xx = __________xx____ (ext);
 
@@ -40,8 +32,8 @@ Moira::baseDispWords(u16 ext)
     return base_disp ? (base_disp_long ? 2 : 1) : 0;
 }
 
-int
-Moira::outerDispWords(u16 ext)
+template <class H, class C> int
+MoiraT<H, C>::outerDispWords(u16 ext)
 {
     u16 xx = ______________xx (ext);
 
@@ -51,8 +43,8 @@ Moira::outerDispWords(u16 ext)
     return outer_disp ? (outer_disp_long ? 2 : 1) : 0;
 }
 
-template <Mode M, Size S> Ea<M,S>
-Moira::Op(u16 reg, u32 &pc)
+template <class H, class C> template <Mode M, Size S> Ea<M,S>
+MoiraT<H, C>::Op(u16 reg, u32 &pc)
 {
     Ea<M,S> result;
     result.reg = reg;
@@ -107,26 +99,46 @@ Moira::Op(u16 reg, u32 &pc)
     return result;
 }
 
-void
-Moira::dasmIllegal(StrWriter &str, u32 &addr, u16 op)
+template <class H, class C> template <Instr I, Mode M, Size S> void
+MoiraT<H, C>::bindDasm(DasmPtr handler)
+{
+    // Instructions whose variants share an info table entry select the variant
+    if constexpr (I == ADD || I == SUB) handler = &MoiraT::dasmAdd<I, M, S>;
+    if constexpr (I == AND || I == OR)  handler = &MoiraT::dasmAnd<I, M, S>;
+    if constexpr (I == BTST)            handler = &MoiraT::dasmBit<I, M, S>;
+    if constexpr (I == EXG)             handler = &MoiraT::dasmExg<I, M, S>;
+    if constexpr (I == MOVE)            handler = &MoiraT::dasmMove<I, M, S>;
+    if constexpr (I == MOVEM)           handler = &MoiraT::dasmMovem<I, M, S>;
+    if constexpr (I == MOVEP)           handler = &MoiraT::dasmMovep<I, M, S>;
+    if constexpr (I == MOVETSR)         handler = &MoiraT::dasmMoveTo<I, M, S>;
+    if constexpr (I == MOVEUSP)         handler = &MoiraT::dasmMoveUsp<I, M, S>;
+
+    // Each entry must be served by a single handler
+    auto &entry = dasm[dasmIndex(I, M, S)];
+    assert(entry == &MoiraT::dasmIllegal || entry == handler);
+    entry = handler;
+}
+
+template <class H, class C> void
+MoiraT<H, C>::dasmIllegal(StrWriter &str, u32 &addr, u16 op)
 {
     str << "dc.w " << UInt16{op} << "; ILLEGAL";
 }
 
-void
-Moira::dasmLineA(StrWriter &str, u32 &addr, u16 op)
+template <class H, class C> void
+MoiraT<H, C>::dasmLineA(StrWriter &str, u32 &addr, u16 op)
 {
     str << "dc.w " << tab << UInt16{op} << "; opcode 1010";
 }
 
-void
-Moira::dasmLineF(StrWriter &str, u32 &addr, u16 op)
+template <class H, class C> void
+MoiraT<H, C>::dasmLineF(StrWriter &str, u32 &addr, u16 op)
 {
     str << "dc.w " << tab << UInt16{op} << "; opcode 1111";
 }
 
-template<Instr I, Mode M, Size S> void
-Moira::dasmShiftRg(StrWriter &str, u32 &addr, u16 op)
+template <class H, class C> template<Instr I, Mode M, Size S> void
+MoiraT<H, C>::dasmShiftRg(StrWriter &str, u32 &addr, u16 op)
 {
     auto dst = Dn ( _____________xxx(op) );
     auto src = Dn ( ____xxx_________(op) );
@@ -134,8 +146,8 @@ Moira::dasmShiftRg(StrWriter &str, u32 &addr, u16 op)
     str << Ins<I>{} << Sz<S>{} << tab << src << ", " << dst;
 }
 
-template<Instr I, Mode M, Size S> void
-Moira::dasmShiftIm(StrWriter &str, u32 &addr, u16 op)
+template <class H, class C> template<Instr I, Mode M, Size S> void
+MoiraT<H, C>::dasmShiftIm(StrWriter &str, u32 &addr, u16 op)
 {
     auto src = Imd ( ____xxx_________(op) );
     auto dst = Dn  ( _____________xxx(op) );
@@ -144,16 +156,16 @@ Moira::dasmShiftIm(StrWriter &str, u32 &addr, u16 op)
     str << Ins<I>{} << Sz<S>{} << tab << src << ", " << dst;
 }
 
-template<Instr I, Mode M, Size S> void
-Moira::dasmShiftEa(StrWriter &str, u32 &addr, u16 op)
+template <class H, class C> template<Instr I, Mode M, Size S> void
+MoiraT<H, C>::dasmShiftEa(StrWriter &str, u32 &addr, u16 op)
 {
     auto src = Op <M,S> ( _____________xxx(op), addr );
 
     str << Ins<I>{} << Sz<S>{} << tab << src;
 }
 
-template<Instr I, Mode M, Size S> void
-Moira::dasmAbcd(StrWriter &str, u32 &addr, u16 op)
+template <class H, class C> template<Instr I, Mode M, Size S> void
+MoiraT<H, C>::dasmAbcd(StrWriter &str, u32 &addr, u16 op)
 {
     auto src = Op <M,S> ( _____________xxx(op), addr );
     auto dst = Op <M,S> ( ____xxx_________(op), addr );
@@ -161,8 +173,18 @@ Moira::dasmAbcd(StrWriter &str, u32 &addr, u16 op)
     str << Ins<I>{} << tab << src << ", " << dst;
 }
 
-template<Instr I, Mode M, Size S> void
-Moira::dasmAddEaRg(StrWriter &str, u32 &addr, u16 op)
+template <class H, class C> template<Instr I, Mode M, Size S> void
+MoiraT<H, C>::dasmAdd(StrWriter &str, u32 &addr, u16 op)
+{
+    if (_______x________(op)) {
+        dasmAddRgEa<I, M, S>(str, addr, op);
+    } else {
+        dasmAddEaRg<I, M, S>(str, addr, op);
+    }
+}
+
+template <class H, class C> template<Instr I, Mode M, Size S> void
+MoiraT<H, C>::dasmAddEaRg(StrWriter &str, u32 &addr, u16 op)
 {
     auto src = Op <M,S> ( _____________xxx(op), addr );
     auto dst = Dn       ( ____xxx_________(op)       );
@@ -170,8 +192,8 @@ Moira::dasmAddEaRg(StrWriter &str, u32 &addr, u16 op)
     str << Ins<I>{} << Sz<S>{} << tab << src << ", " << dst;
 }
 
-template<Instr I, Mode M, Size S> void
-Moira::dasmAddRgEa(StrWriter &str, u32 &addr, u16 op)
+template <class H, class C> template<Instr I, Mode M, Size S> void
+MoiraT<H, C>::dasmAddRgEa(StrWriter &str, u32 &addr, u16 op)
 {
     auto src = Dn       ( ____xxx_________(op)       );
     auto dst = Op <M,S> ( _____________xxx(op), addr );
@@ -179,8 +201,8 @@ Moira::dasmAddRgEa(StrWriter &str, u32 &addr, u16 op)
     str << Ins<I>{} << Sz<S>{} << tab << src << ", " << dst;
 }
 
-template<Instr I, Mode M, Size S> void
-Moira::dasmAdda(StrWriter &str, u32 &addr, u16 op)
+template <class H, class C> template<Instr I, Mode M, Size S> void
+MoiraT<H, C>::dasmAdda(StrWriter &str, u32 &addr, u16 op)
 {
     auto src = Op <M,S> ( _____________xxx(op), addr );
     auto dst = An       ( ____xxx_________(op)       );
@@ -188,8 +210,8 @@ Moira::dasmAdda(StrWriter &str, u32 &addr, u16 op)
     str << Ins<I>{} << Sz<S>{} << tab << src << ", " << dst;
 }
 
-template<Instr I, Mode M, Size S> void
-Moira::dasmAddiRg(StrWriter &str, u32 &addr, u16 op)
+template <class H, class C> template<Instr I, Mode M, Size S> void
+MoiraT<H, C>::dasmAddiRg(StrWriter &str, u32 &addr, u16 op)
 {
     auto src = Ims ( SEXT<S>(dasmRead<S>(addr)) );
     auto dst = Dn  ( _____________xxx(op)       );
@@ -197,8 +219,8 @@ Moira::dasmAddiRg(StrWriter &str, u32 &addr, u16 op)
     str << Ins<I>{} << Sz<S>{} << tab << src << ", " << dst;
 }
 
-template<Instr I, Mode M, Size S> void
-Moira::dasmAddiEa(StrWriter &str, u32 &addr, u16 op)
+template <class H, class C> template<Instr I, Mode M, Size S> void
+MoiraT<H, C>::dasmAddiEa(StrWriter &str, u32 &addr, u16 op)
 {
     auto src = Ims      ( SEXT<S>(dasmRead<S>(addr)) );
     auto dst = Op <M,S> ( _____________xxx(op), addr );
@@ -206,8 +228,8 @@ Moira::dasmAddiEa(StrWriter &str, u32 &addr, u16 op)
     str << Ins<I>{} << Sz<S>{} << tab << src << ", " << dst;
 }
 
-template<Instr I, Mode M, Size S> void
-Moira::dasmAddqDn(StrWriter &str, u32 &addr, u16 op)
+template <class H, class C> template<Instr I, Mode M, Size S> void
+MoiraT<H, C>::dasmAddqDn(StrWriter &str, u32 &addr, u16 op)
 {
     auto src = Imd ( ____xxx_________(op) );
     auto dst = Dn  ( _____________xxx(op) );
@@ -216,8 +238,8 @@ Moira::dasmAddqDn(StrWriter &str, u32 &addr, u16 op)
     str << Ins<I>{} << Sz<S>{} << tab << src << ", " << dst;
 }
 
-template<Instr I, Mode M, Size S> void
-Moira::dasmAddqAn(StrWriter &str, u32 &addr, u16 op)
+template <class H, class C> template<Instr I, Mode M, Size S> void
+MoiraT<H, C>::dasmAddqAn(StrWriter &str, u32 &addr, u16 op)
 {
     auto src = Imd ( ____xxx_________(op) );
     auto dst = An  ( _____________xxx(op) );
@@ -226,8 +248,8 @@ Moira::dasmAddqAn(StrWriter &str, u32 &addr, u16 op)
     str << Ins<I>{} << Sz<S>{} << tab << src << ", " << dst;
 }
 
-template<Instr I, Mode M, Size S> void
-Moira::dasmAddqEa(StrWriter &str, u32 &addr, u16 op)
+template <class H, class C> template<Instr I, Mode M, Size S> void
+MoiraT<H, C>::dasmAddqEa(StrWriter &str, u32 &addr, u16 op)
 {
     auto src = Imd      ( ____xxx_________(op)       );
     auto dst = Op <M,S> ( _____________xxx(op), addr );
@@ -236,8 +258,8 @@ Moira::dasmAddqEa(StrWriter &str, u32 &addr, u16 op)
     str << Ins<I>{} << Sz<S>{} << tab << src << ", " << dst;
 }
 
-template<Instr I, Mode M, Size S> void
-Moira::dasmAddxRg(StrWriter &str, u32 &addr, u16 op)
+template <class H, class C> template<Instr I, Mode M, Size S> void
+MoiraT<H, C>::dasmAddxRg(StrWriter &str, u32 &addr, u16 op)
 {
     auto src = Op <M,S> ( _____________xxx(op), addr );
     auto dst = Op <M,S> ( ____xxx_________(op), addr );
@@ -245,8 +267,8 @@ Moira::dasmAddxRg(StrWriter &str, u32 &addr, u16 op)
     str << Ins<I>{} << Sz<S>{} << tab << src << ", " << dst;
 }
 
-template<Instr I, Mode M, Size S> void
-Moira::dasmAddxEa(StrWriter &str, u32 &addr, u16 op)
+template <class H, class C> template<Instr I, Mode M, Size S> void
+MoiraT<H, C>::dasmAddxEa(StrWriter &str, u32 &addr, u16 op)
 {
     auto src = Op <M,S> ( _____________xxx(op), addr );
     auto dst = Op <M,S> ( ____xxx_________(op), addr );
@@ -254,8 +276,18 @@ Moira::dasmAddxEa(StrWriter &str, u32 &addr, u16 op)
     str << Ins<I>{} << Sz<S>{} << tab << src << ", " << dst;
 }
 
-template<Instr I, Mode M, Size S> void
-Moira::dasmAndEaRg(StrWriter &str, u32 &addr, u16 op)
+template <class H, class C> template<Instr I, Mode M, Size S> void
+MoiraT<H, C>::dasmAnd(StrWriter &str, u32 &addr, u16 op)
+{
+    if (_______x________(op)) {
+        dasmAndRgEa<I, M, S>(str, addr, op);
+    } else {
+        dasmAndEaRg<I, M, S>(str, addr, op);
+    }
+}
+
+template <class H, class C> template<Instr I, Mode M, Size S> void
+MoiraT<H, C>::dasmAndEaRg(StrWriter &str, u32 &addr, u16 op)
 {
     auto src = Op <M,S> ( _____________xxx(op), addr );
     auto dst = Dn       ( ____xxx_________(op)       );
@@ -263,8 +295,8 @@ Moira::dasmAndEaRg(StrWriter &str, u32 &addr, u16 op)
     str << Ins<I>{} << Sz<S>{} << tab << src << ", " << dst;
 }
 
-template<Instr I, Mode M, Size S> void
-Moira::dasmAndRgEa(StrWriter &str, u32 &addr, u16 op)
+template <class H, class C> template<Instr I, Mode M, Size S> void
+MoiraT<H, C>::dasmAndRgEa(StrWriter &str, u32 &addr, u16 op)
 {
     auto src = Dn       ( ____xxx_________(op)       );
     auto dst = Op <M,S> ( _____________xxx(op), addr );
@@ -272,8 +304,8 @@ Moira::dasmAndRgEa(StrWriter &str, u32 &addr, u16 op)
     str << Ins<I>{} << Sz<S>{} << tab << src << ", " << dst;
 }
 
-template<Instr I, Mode M, Size S> void
-Moira::dasmAndiRg(StrWriter &str, u32 &addr, u16 op)
+template <class H, class C> template<Instr I, Mode M, Size S> void
+MoiraT<H, C>::dasmAndiRg(StrWriter &str, u32 &addr, u16 op)
 {
     auto src = Imu ( dasmRead<S>(addr)    );
     auto dst = Dn  ( _____________xxx(op) );
@@ -281,8 +313,8 @@ Moira::dasmAndiRg(StrWriter &str, u32 &addr, u16 op)
     str << Ins<I>{} << Sz<S>{} << tab << src << ", " << dst;
 }
 
-template<Instr I, Mode M, Size S> void
-Moira::dasmAndiEa(StrWriter &str, u32 &addr, u16 op)
+template <class H, class C> template<Instr I, Mode M, Size S> void
+MoiraT<H, C>::dasmAndiEa(StrWriter &str, u32 &addr, u16 op)
 {
     auto src = Imu      ( dasmRead<S>(addr)          );
     auto dst = Op <M,S> ( _____________xxx(op), addr );
@@ -290,26 +322,26 @@ Moira::dasmAndiEa(StrWriter &str, u32 &addr, u16 op)
     str << Ins<I>{} << Sz<S>{} << tab << src << ", " << dst;
 }
 
-template<Instr I, Mode M, Size S> void
-Moira::dasmAndiccr(StrWriter &str, u32 &addr, u16 op)
+template <class H, class C> template<Instr I, Mode M, Size S> void
+MoiraT<H, C>::dasmAndiccr(StrWriter &str, u32 &addr, u16 op)
 {
     auto src = Imu ( dasmRead<S>(addr)         );
 
     str << Ins<I>{} << tab << src << ", CCR";
 }
 
-template<Instr I, Mode M, Size S> void
-Moira::dasmAndisr(StrWriter &str, u32 &addr, u16 op)
+template <class H, class C> template<Instr I, Mode M, Size S> void
+MoiraT<H, C>::dasmAndisr(StrWriter &str, u32 &addr, u16 op)
 {
     auto src = Imu ( dasmRead<S>(addr) );
 
     str << Ins<I>{} << tab << src << ", SR";
 }
 
-template<Instr I, Mode M, Size S> void
-Moira::dasmBsr(StrWriter &str, u32 &addr, u16 op)
+template <class H, class C> template<Instr I, Mode M, Size S> void
+MoiraT<H, C>::dasmBsr(StrWriter &str, u32 &addr, u16 op)
 {
-    if constexpr (MIMIC_MUSASHI && S == Byte) {
+    if constexpr (C::mimicMusashi && S == Byte) {
         if ((u8)op == 0xFF) {
             dasmIllegal(str, addr, op);
             return;
@@ -325,8 +357,8 @@ Moira::dasmBsr(StrWriter &str, u32 &addr, u16 op)
     str << Ins<I>{} << tab << UInt(dst);
 }
 
-template<Instr I, Mode M, Size S> void
-Moira::dasmChk(StrWriter &str, u32 &addr, u16 op)
+template <class H, class C> template<Instr I, Mode M, Size S> void
+MoiraT<H, C>::dasmChk(StrWriter &str, u32 &addr, u16 op)
 {
     auto src = Op <M,S> ( _____________xxx(op), addr );
     auto dst = Dn       ( ____xxx_________(op)       );
@@ -334,16 +366,16 @@ Moira::dasmChk(StrWriter &str, u32 &addr, u16 op)
     str << Ins<I>{} << Sz<S>{} << tab << src << ", " << dst;
 }
 
-template<Instr I, Mode M, Size S> void
-Moira::dasmClr(StrWriter &str, u32 &addr, u16 op)
+template <class H, class C> template<Instr I, Mode M, Size S> void
+MoiraT<H, C>::dasmClr(StrWriter &str, u32 &addr, u16 op)
 {
     auto dst = Op <M,S> ( _____________xxx(op), addr );
 
     str << Ins<I>{} << Sz<S>{} << tab << dst;
 }
 
-template<Instr I, Mode M, Size S> void
-Moira::dasmCmp(StrWriter &str, u32 &addr, u16 op)
+template <class H, class C> template<Instr I, Mode M, Size S> void
+MoiraT<H, C>::dasmCmp(StrWriter &str, u32 &addr, u16 op)
 {
     Ea<M,S> src = Op <M,S> ( _____________xxx(op), addr );
     Dn      dst = Dn       ( ____xxx_________(op)       );
@@ -351,8 +383,8 @@ Moira::dasmCmp(StrWriter &str, u32 &addr, u16 op)
     str << Ins<I>{} << Sz<S>{} << tab << src << ", " << dst;
 }
 
-template<Instr I, Mode M, Size S> void
-Moira::dasmCmpa(StrWriter &str, u32 &addr, u16 op)
+template <class H, class C> template<Instr I, Mode M, Size S> void
+MoiraT<H, C>::dasmCmpa(StrWriter &str, u32 &addr, u16 op)
 {
     auto src = Op <M,S> ( _____________xxx(op), addr );
     auto dst = An       ( ____xxx_________(op)       );
@@ -360,8 +392,8 @@ Moira::dasmCmpa(StrWriter &str, u32 &addr, u16 op)
     str << Ins<I>{} << Sz<S>{} << tab << src << ", " << dst;
 }
 
-template<Instr I, Mode M, Size S> void
-Moira::dasmCmpiRg(StrWriter &str, u32 &addr, u16 op)
+template <class H, class C> template<Instr I, Mode M, Size S> void
+MoiraT<H, C>::dasmCmpiRg(StrWriter &str, u32 &addr, u16 op)
 {
     auto src = Ims ( SEXT<S>(dasmRead<S>(addr)) );
     auto dst = Dn  ( _____________xxx(op)       );
@@ -369,8 +401,8 @@ Moira::dasmCmpiRg(StrWriter &str, u32 &addr, u16 op)
     str << Ins<I>{} << Sz<S>{} << tab << src << ", " << dst;
 }
 
-template<Instr I, Mode M, Size S> void
-Moira::dasmCmpiEa(StrWriter &str, u32 &addr, u16 op)
+template <class H, class C> template<Instr I, Mode M, Size S> void
+MoiraT<H, C>::dasmCmpiEa(StrWriter &str, u32 &addr, u16 op)
 {
     auto src = Ims      ( SEXT<S>(dasmRead<S>(addr)) );
     auto dst = Op <M,S> ( _____________xxx(op), addr );
@@ -378,8 +410,8 @@ Moira::dasmCmpiEa(StrWriter &str, u32 &addr, u16 op)
     str << Ins<I>{} << Sz<S>{} << tab << src << ", " << dst;
 }
 
-template<Instr I, Mode M, Size S> void
-Moira::dasmCmpm(StrWriter &str, u32 &addr, u16 op)
+template <class H, class C> template<Instr I, Mode M, Size S> void
+MoiraT<H, C>::dasmCmpm(StrWriter &str, u32 &addr, u16 op)
 {
     auto src = Op <M,S> ( _____________xxx(op), addr );
     auto dst = Op <M,S> ( ____xxx_________(op), addr );
@@ -387,10 +419,10 @@ Moira::dasmCmpm(StrWriter &str, u32 &addr, u16 op)
     str << Ins<I>{} << Sz<S>{} << tab << src << ", " << dst;
 }
 
-template<Instr I, Mode M, Size S> void
-Moira::dasmBcc(StrWriter &str, u32 &addr, u16 op)
+template <class H, class C> template<Instr I, Mode M, Size S> void
+MoiraT<H, C>::dasmBcc(StrWriter &str, u32 &addr, u16 op)
 {
-    if constexpr (MIMIC_MUSASHI && S == Byte) {
+    if constexpr (C::mimicMusashi && S == Byte) {
         if ((u8)op == 0xFF) {
             dasmIllegal(str, addr, op);
             return;
@@ -406,8 +438,8 @@ Moira::dasmBcc(StrWriter &str, u32 &addr, u16 op)
     str << Ins<I>{} << tab << UInt(dst);
 }
 
-template<Instr I, Mode M, Size S> void
-Moira::dasmBitDxEa(StrWriter &str, u32 &addr, u16 op)
+template <class H, class C> template<Instr I, Mode M, Size S> void
+MoiraT<H, C>::dasmBitDxEa(StrWriter &str, u32 &addr, u16 op)
 {
     auto src = Dn       ( ____xxx_________(op)       );
     auto dst = Op <M,S> ( _____________xxx(op), addr );
@@ -415,8 +447,8 @@ Moira::dasmBitDxEa(StrWriter &str, u32 &addr, u16 op)
     str << Ins<I>{} << tab << src << ", " << dst;
 }
 
-template<Instr I, Mode M, Size S> void
-Moira::dasmBitImEa(StrWriter &str, u32 &addr, u16 op)
+template <class H, class C> template<Instr I, Mode M, Size S> void
+MoiraT<H, C>::dasmBitImEa(StrWriter &str, u32 &addr, u16 op)
 {
     auto src = dasmRead<S>(addr);
     auto dst = Op <M,S> ( _____________xxx(op), addr );
@@ -424,8 +456,18 @@ Moira::dasmBitImEa(StrWriter &str, u32 &addr, u16 op)
     str << Ins<I>{} << tab << "#" << UInt(src) << ", " << dst;
 }
 
-template<Instr I, Mode M, Size S> void
-Moira::dasmDbcc(StrWriter &str, u32 &addr, u16 op)
+template <class H, class C> template<Instr I, Mode M, Size S> void
+MoiraT<H, C>::dasmBit(StrWriter &str, u32 &addr, u16 op)
+{
+    if (_______x________(op)) {
+        dasmBitDxEa<I, M, S>(str, addr, op);
+    } else {
+        dasmBitImEa<I, M, S>(str, addr, op);
+    }
+}
+
+template <class H, class C> template<Instr I, Mode M, Size S> void
+MoiraT<H, C>::dasmDbcc(StrWriter &str, u32 &addr, u16 op)
 {
     auto src = Dn ( _____________xxx(op) );
     auto dst = addr + 2;
@@ -435,8 +477,8 @@ Moira::dasmDbcc(StrWriter &str, u32 &addr, u16 op)
     str << Ins<I>{} << tab << src << ", " << UInt(dst);
 }
 
-template<Instr I, Mode M, Size S> void
-Moira::dasmExgDxDy(StrWriter &str, u32 &addr, u16 op)
+template <class H, class C> template<Instr I, Mode M, Size S> void
+MoiraT<H, C>::dasmExgDxDy(StrWriter &str, u32 &addr, u16 op)
 {
     auto src = Dn ( ____xxx_________(op) );
     auto dst = Dn ( _____________xxx(op) );
@@ -444,8 +486,8 @@ Moira::dasmExgDxDy(StrWriter &str, u32 &addr, u16 op)
     str << Ins<I>{} << tab << src << ", " << dst;
 }
 
-template<Instr I, Mode M, Size S> void
-Moira::dasmExgAxDy(StrWriter &str, u32 &addr, u16 op)
+template <class H, class C> template<Instr I, Mode M, Size S> void
+MoiraT<H, C>::dasmExgAxDy(StrWriter &str, u32 &addr, u16 op)
 {
     auto src = Dn ( ____xxx_________(op) );
     auto dst = An ( _____________xxx(op) );
@@ -453,8 +495,8 @@ Moira::dasmExgAxDy(StrWriter &str, u32 &addr, u16 op)
     str << Ins<I>{} << tab << src << ", " << dst;
 }
 
-template<Instr I, Mode M, Size S> void
-Moira::dasmExgAxAy(StrWriter &str, u32 &addr, u16 op)
+template <class H, class C> template<Instr I, Mode M, Size S> void
+MoiraT<H, C>::dasmExgAxAy(StrWriter &str, u32 &addr, u16 op)
 {
     auto src = An ( ____xxx_________(op) );
     auto dst = An ( _____________xxx(op) );
@@ -462,32 +504,43 @@ Moira::dasmExgAxAy(StrWriter &str, u32 &addr, u16 op)
     str << Ins<I>{} << tab << src << ", " << dst;
 }
 
-template<Instr I, Mode M, Size S> void
-Moira::dasmExt(StrWriter &str, u32 &addr, u16 op)
+template <class H, class C> template<Instr I, Mode M, Size S> void
+MoiraT<H, C>::dasmExg(StrWriter &str, u32 &addr, u16 op)
+{
+    switch ((op >> 3) & 0b11111) {
+
+        case 0b01000: dasmExgDxDy<I, M, S>(str, addr, op); break;
+        case 0b10001: dasmExgAxDy<I, M, S>(str, addr, op); break;
+        default:      dasmExgAxAy<I, M, S>(str, addr, op); break;
+    }
+}
+
+template <class H, class C> template<Instr I, Mode M, Size S> void
+MoiraT<H, C>::dasmExt(StrWriter &str, u32 &addr, u16 op)
 {
     auto src = Dn ( _____________xxx(op) );
 
     str << Ins<I>{} << Sz<S>{} << tab << Dn{src};
 }
 
-template <Instr I, Mode M, Size S> void
-Moira::dasmJmp(StrWriter &str, u32 &addr, u16 op)
+template <class H, class C> template <Instr I, Mode M, Size S> void
+MoiraT<H, C>::dasmJmp(StrWriter &str, u32 &addr, u16 op)
 {
     auto src = Op <M,S> ( _____________xxx(op), addr );
 
     str << Ins<I>{} << tab << src;
 }
 
-template <Instr I, Mode M, Size S> void
-Moira::dasmJsr(StrWriter &str, u32 &addr, u16 op)
+template <class H, class C> template <Instr I, Mode M, Size S> void
+MoiraT<H, C>::dasmJsr(StrWriter &str, u32 &addr, u16 op)
 {
     auto src = Op <M,S> (_____________xxx(op), addr);
 
     str << Ins<I>{} << tab << src;
 }
 
-template <Instr I, Mode M, Size S> void
-Moira::dasmLea(StrWriter &str, u32 &addr, u16 op)
+template <class H, class C> template <Instr I, Mode M, Size S> void
+MoiraT<H, C>::dasmLea(StrWriter &str, u32 &addr, u16 op)
 {
     auto src = Op <M,S> ( _____________xxx(op), addr );
     auto dst = An       ( ____xxx_________(op)       );
@@ -495,8 +548,8 @@ Moira::dasmLea(StrWriter &str, u32 &addr, u16 op)
     str << Ins<I>{} << tab << src << ", " << dst;
 }
 
-template <Instr I, Mode M, Size S> void
-Moira::dasmLink(StrWriter &str, u32 &addr, u16 op)
+template <class H, class C> template <Instr I, Mode M, Size S> void
+MoiraT<H, C>::dasmLink(StrWriter &str, u32 &addr, u16 op)
 {
     auto src = An  ( _____________xxx(op)          );
     auto dsp = Ims ( SEXT<S>(dasmRead<Word>(addr)) );
@@ -504,8 +557,30 @@ Moira::dasmLink(StrWriter &str, u32 &addr, u16 op)
     str << Ins<I>{} << tab << src << ", " << dsp;
 }
 
-template<Instr I, Mode M, Size S> void
-Moira::dasmMove0(StrWriter &str, u32 &addr, u16 op)
+template <class H, class C> template<Instr I, Mode M, Size S> void
+MoiraT<H, C>::dasmMove(StrWriter &str, u32 &addr, u16 op)
+{
+    switch (_______xxx______(op)) {
+
+        case 0:  dasmMove0<I, M, S>(str, addr, op); break;
+        case 2:  dasmMove2<I, M, S>(str, addr, op); break;
+        case 3:  dasmMove3<I, M, S>(str, addr, op); break;
+        case 4:  dasmMove4<I, M, S>(str, addr, op); break;
+        case 5:  dasmMove5<I, M, S>(str, addr, op); break;
+        case 6:  dasmMove6<I, M, S>(str, addr, op); break;
+
+        default:
+
+            if (____xxx_________(op) == 0) {
+                dasmMove7<I, M, S>(str, addr, op);
+            } else {
+                dasmMove8<I, M, S>(str, addr, op);
+            }
+    }
+}
+
+template <class H, class C> template<Instr I, Mode M, Size S> void
+MoiraT<H, C>::dasmMove0(StrWriter &str, u32 &addr, u16 op)
 {
     auto src = Op <M,S> ( _____________xxx(op), addr );
     auto dst = Dn       ( ____xxx_________(op)       );
@@ -513,8 +588,8 @@ Moira::dasmMove0(StrWriter &str, u32 &addr, u16 op)
     str << Ins<I>{} << Sz<S>{} << tab << src << ", " << dst;
 }
 
-template<Instr I, Mode M, Size S> void
-Moira::dasmMove2(StrWriter &str, u32 &addr, u16 op)
+template <class H, class C> template<Instr I, Mode M, Size S> void
+MoiraT<H, C>::dasmMove2(StrWriter &str, u32 &addr, u16 op)
 {
     auto src = Op <M,S>       ( _____________xxx(op), addr );
     auto dst = Op <MODE_AI,S> ( ____xxx_________(op), addr );
@@ -522,8 +597,8 @@ Moira::dasmMove2(StrWriter &str, u32 &addr, u16 op)
     str << Ins<I>{} << Sz<S>{} << tab << src << ", " << dst;
 }
 
-template<Instr I, Mode M, Size S> void
-Moira::dasmMove3(StrWriter &str, u32 &addr, u16 op)
+template <class H, class C> template<Instr I, Mode M, Size S> void
+MoiraT<H, C>::dasmMove3(StrWriter &str, u32 &addr, u16 op)
 {
     auto src = Op <M,S>       ( _____________xxx(op), addr );
     auto dst = Op <MODE_PI,S> ( ____xxx_________(op), addr );
@@ -531,8 +606,8 @@ Moira::dasmMove3(StrWriter &str, u32 &addr, u16 op)
     str << Ins<I>{} << Sz<S>{} << tab << src << ", " << dst;
 }
 
-template<Instr I, Mode M, Size S> void
-Moira::dasmMove4(StrWriter &str, u32 &addr, u16 op)
+template <class H, class C> template<Instr I, Mode M, Size S> void
+MoiraT<H, C>::dasmMove4(StrWriter &str, u32 &addr, u16 op)
 {
     auto src = Op <M,S>       ( _____________xxx(op), addr );
     auto dst = Op <MODE_PD,S> ( ____xxx_________(op), addr );
@@ -540,8 +615,8 @@ Moira::dasmMove4(StrWriter &str, u32 &addr, u16 op)
     str << Ins<I>{} << Sz<S>{} << tab << src << ", " << dst;
 }
 
-template<Instr I, Mode M, Size S> void
-Moira::dasmMove5(StrWriter &str, u32 &addr, u16 op)
+template <class H, class C> template<Instr I, Mode M, Size S> void
+MoiraT<H, C>::dasmMove5(StrWriter &str, u32 &addr, u16 op)
 {
     auto src = Op <M,S>       ( _____________xxx(op), addr );
     auto dst = Op <MODE_DI,S> ( ____xxx_________(op), addr );
@@ -549,8 +624,8 @@ Moira::dasmMove5(StrWriter &str, u32 &addr, u16 op)
     str << Ins<I>{} << Sz<S>{} << tab << src << ", " << dst;
 }
 
-template<Instr I, Mode M, Size S> void
-Moira::dasmMove6(StrWriter &str, u32 &addr, u16 op)
+template <class H, class C> template<Instr I, Mode M, Size S> void
+MoiraT<H, C>::dasmMove6(StrWriter &str, u32 &addr, u16 op)
 {
     auto src = Op <M,S>       ( _____________xxx(op), addr );
     auto dst = Op <MODE_IX,S> ( ____xxx_________(op), addr );
@@ -558,8 +633,8 @@ Moira::dasmMove6(StrWriter &str, u32 &addr, u16 op)
     str << Ins<I>{} << Sz<S>{} << tab << src << ", " << dst;
 }
 
-template<Instr I, Mode M, Size S> void
-Moira::dasmMove7(StrWriter &str, u32 &addr, u16 op)
+template <class H, class C> template<Instr I, Mode M, Size S> void
+MoiraT<H, C>::dasmMove7(StrWriter &str, u32 &addr, u16 op)
 {
     auto src = Op <M,S>       ( _____________xxx(op), addr );
     auto dst = Op <MODE_AW,S> ( ____xxx_________(op), addr );
@@ -567,8 +642,8 @@ Moira::dasmMove7(StrWriter &str, u32 &addr, u16 op)
     str << Ins<I>{} << Sz<S>{} << tab << src << ", " << dst;
 }
 
-template<Instr I, Mode M, Size S> void
-Moira::dasmMove8(StrWriter &str, u32 &addr, u16 op)
+template <class H, class C> template<Instr I, Mode M, Size S> void
+MoiraT<H, C>::dasmMove8(StrWriter &str, u32 &addr, u16 op)
 {
     auto src = Op <M,S>       ( _____________xxx(op), addr );
     auto dst = Op <MODE_AL,S> ( ____xxx_________(op), addr );
@@ -576,8 +651,8 @@ Moira::dasmMove8(StrWriter &str, u32 &addr, u16 op)
     str << Ins<I>{} << Sz<S>{} << tab << src << ", " << dst;
 }
 
-template<Instr I, Mode M, Size S> void
-Moira::dasmMovea(StrWriter &str, u32 &addr, u16 op)
+template <class H, class C> template<Instr I, Mode M, Size S> void
+MoiraT<H, C>::dasmMovea(StrWriter &str, u32 &addr, u16 op)
 {
     auto src = Op <M,S> ( _____________xxx(op), addr );
     auto dst = An       ( ____xxx_________(op)       );
@@ -585,8 +660,18 @@ Moira::dasmMovea(StrWriter &str, u32 &addr, u16 op)
     str << Ins<I>{} << Sz<S>{} << tab << src << ", " << dst;
 }
 
-template<Instr I, Mode M, Size S> void
-Moira::dasmMovemEaRg(StrWriter &str, u32 &addr, u16 op)
+template <class H, class C> template<Instr I, Mode M, Size S> void
+MoiraT<H, C>::dasmMovem(StrWriter &str, u32 &addr, u16 op)
+{
+    if ((op >> 10) & 1) {
+        dasmMovemEaRg<I, M, S>(str, addr, op);
+    } else {
+        dasmMovemRgEa<I, M, S>(str, addr, op);
+    }
+}
+
+template <class H, class C> template<Instr I, Mode M, Size S> void
+MoiraT<H, C>::dasmMovemEaRg(StrWriter &str, u32 &addr, u16 op)
 {
     auto dst = RegRegList ( (u16)dasmRead<Word>(addr)  );
     auto src = Op <M,S>   ( _____________xxx(op), addr );
@@ -594,8 +679,8 @@ Moira::dasmMovemEaRg(StrWriter &str, u32 &addr, u16 op)
     str << Ins<I>{} << Sz<S>{} << tab << src << ", " << dst;
 }
 
-template<Instr I, Mode M, Size S> void
-Moira::dasmMovemRgEa(StrWriter &str, u32 &addr, u16 op)
+template <class H, class C> template<Instr I, Mode M, Size S> void
+MoiraT<H, C>::dasmMovemRgEa(StrWriter &str, u32 &addr, u16 op)
 {
     auto src = RegRegList ( (u16)dasmRead<Word>(addr)  );
     auto dst = Op <M,S>   ( _____________xxx(op), addr );
@@ -604,8 +689,18 @@ Moira::dasmMovemRgEa(StrWriter &str, u32 &addr, u16 op)
     str << Ins<I>{} << Sz<S>{} << tab << src << ", " << dst;
 }
 
-template<Instr I, Mode M, Size S> void
-Moira::dasmMovepDxEa(StrWriter &str, u32 &addr, u16 op)
+template <class H, class C> template<Instr I, Mode M, Size S> void
+MoiraT<H, C>::dasmMovep(StrWriter &str, u32 &addr, u16 op)
+{
+    if (________x_______(op)) {
+        dasmMovepDxEa<I, M, S>(str, addr, op);
+    } else {
+        dasmMovepEaDx<I, M, S>(str, addr, op);
+    }
+}
+
+template <class H, class C> template<Instr I, Mode M, Size S> void
+MoiraT<H, C>::dasmMovepDxEa(StrWriter &str, u32 &addr, u16 op)
 {
     auto src = Dn             ( ____xxx_________(op)       );
     auto dst = Op <MODE_DI,S> ( _____________xxx(op), addr );
@@ -614,8 +709,8 @@ Moira::dasmMovepDxEa(StrWriter &str, u32 &addr, u16 op)
     str << src << ", (" << UInt(dst.ext1) << "," << An{dst.reg} << ")";
 }
 
-template<Instr I, Mode M, Size S> void
-Moira::dasmMovepEaDx(StrWriter &str, u32 &addr, u16 op)
+template <class H, class C> template<Instr I, Mode M, Size S> void
+MoiraT<H, C>::dasmMovepEaDx(StrWriter &str, u32 &addr, u16 op)
 {
     auto src = Op <MODE_DI,S> ( _____________xxx(op), addr );
     auto dst = Dn             ( ____xxx_________(op)       );
@@ -624,8 +719,8 @@ Moira::dasmMovepEaDx(StrWriter &str, u32 &addr, u16 op)
     str << "(" << UInt(src.ext1) << "," << An{src.reg} << "), " << dst;
 }
 
-template<Instr I, Mode M, Size S> void
-Moira::dasmMoveq(StrWriter &str, u32 &addr, u16 op)
+template <class H, class C> template<Instr I, Mode M, Size S> void
+MoiraT<H, C>::dasmMoveq(StrWriter &str, u32 &addr, u16 op)
 {
     auto src = Ims ( (i8)op               );
     auto dst = Dn  ( ____xxx_________(op) );
@@ -633,56 +728,76 @@ Moira::dasmMoveq(StrWriter &str, u32 &addr, u16 op)
     str << Ins<I>{} << tab << src << ", " << dst;
 }
 
-template<Instr I, Mode M, Size S> void
-Moira::dasmMoveToCcr(StrWriter &str, u32 &addr, u16 op)
+template <class H, class C> template<Instr I, Mode M, Size S> void
+MoiraT<H, C>::dasmMoveTo(StrWriter &str, u32 &addr, u16 op)
+{
+    if (_____xx_________(op) & 1) {
+        dasmMoveToSr<I, M, S>(str, addr, op);
+    } else {
+        dasmMoveToCcr<I, M, S>(str, addr, op);
+    }
+}
+
+template <class H, class C> template<Instr I, Mode M, Size S> void
+MoiraT<H, C>::dasmMoveToCcr(StrWriter &str, u32 &addr, u16 op)
 {
     auto src = Op <M,Byte> ( _____________xxx(op), addr );
 
     str << Ins<I>{} << tab << src << ", CCR";
 }
 
-template<Instr I, Mode M, Size S> void
-Moira::dasmMoveFromSrRg(StrWriter &str, u32 &addr, u16 op)
+template <class H, class C> template<Instr I, Mode M, Size S> void
+MoiraT<H, C>::dasmMoveFromSrRg(StrWriter &str, u32 &addr, u16 op)
 {
     auto dst = Dn ( _____________xxx(op) );
 
     str << Ins<I>{} << tab << "SR, " << dst;
 }
 
-template<Instr I, Mode M, Size S> void
-Moira::dasmMoveFromSrEa(StrWriter &str, u32 &addr, u16 op)
+template <class H, class C> template<Instr I, Mode M, Size S> void
+MoiraT<H, C>::dasmMoveFromSrEa(StrWriter &str, u32 &addr, u16 op)
 {
     auto dst = Op <M,S> ( _____________xxx(op), addr );
 
     str << Ins<I>{} << tab << "SR, " << dst;
 }
 
-template<Instr I, Mode M, Size S> void
-Moira::dasmMoveToSr(StrWriter &str, u32 &addr, u16 op)
+template <class H, class C> template<Instr I, Mode M, Size S> void
+MoiraT<H, C>::dasmMoveToSr(StrWriter &str, u32 &addr, u16 op)
 {
     auto src = Op <M,S> ( _____________xxx(op), addr );
 
     str << Ins<I>{} << tab << src << ", SR";
 }
 
-template<Instr I, Mode M, Size S> void
-Moira::dasmMoveUspAn(StrWriter &str, u32 &addr, u16 op)
+template <class H, class C> template<Instr I, Mode M, Size S> void
+MoiraT<H, C>::dasmMoveUsp(StrWriter &str, u32 &addr, u16 op)
+{
+    if (__________xxx___(op) & 1) {
+        dasmMoveUspAn<I, M, S>(str, addr, op);
+    } else {
+        dasmMoveAnUsp<I, M, S>(str, addr, op);
+    }
+}
+
+template <class H, class C> template<Instr I, Mode M, Size S> void
+MoiraT<H, C>::dasmMoveUspAn(StrWriter &str, u32 &addr, u16 op)
 {
     auto dst = An ( _____________xxx(op) );
 
     str << Ins<I>{} << tab << "USP, " << dst;
 }
 
-template<Instr I, Mode M, Size S> void
-Moira::dasmMoveAnUsp(StrWriter &str, u32 &addr, u16 op)
+template <class H, class C> template<Instr I, Mode M, Size S> void
+MoiraT<H, C>::dasmMoveAnUsp(StrWriter &str, u32 &addr, u16 op)
 {
     auto src = An ( _____________xxx(op) );
 
     str << Ins<I>{} << tab << src << ", USP";
 }
 
-template<Instr I, Mode M, Size S> void
-Moira::dasmMul(StrWriter &str, u32 &addr, u16 op)
+template <class H, class C> template<Instr I, Mode M, Size S> void
+MoiraT<H, C>::dasmMul(StrWriter &str, u32 &addr, u16 op)
 {
     auto src = Op <M,S> ( _____________xxx(op), addr );
     auto dst = Dn       ( ____xxx_________(op)       );
@@ -690,8 +805,8 @@ Moira::dasmMul(StrWriter &str, u32 &addr, u16 op)
     str << Ins<I>{} << Sz<S>{} << tab << src << ", " << dst;
 }
 
-template<Instr I, Mode M, Size S> void
-Moira::dasmDiv(StrWriter &str, u32 &addr, u16 op)
+template <class H, class C> template<Instr I, Mode M, Size S> void
+MoiraT<H, C>::dasmDiv(StrWriter &str, u32 &addr, u16 op)
 {
     auto src = Op <M,S> ( _____________xxx(op), addr );
     auto dst = Dn       ( ____xxx_________(op)       );
@@ -699,140 +814,140 @@ Moira::dasmDiv(StrWriter &str, u32 &addr, u16 op)
     str << Ins<I>{} << Sz<S>{} << tab << src << ", " << dst;
 }
 
-template <Instr I, Mode M, Size S> void
-Moira::dasmNbcd(StrWriter &str, u32 &addr, u16 op)
+template <class H, class C> template <Instr I, Mode M, Size S> void
+MoiraT<H, C>::dasmNbcd(StrWriter &str, u32 &addr, u16 op)
 {
     auto dst = Op <M,S> ( _____________xxx(op), addr );
 
     str << Ins<NBCD>{} << tab << dst;
 }
 
-template<Instr I, Mode M, Size S> void
-Moira::dasmNop(StrWriter &str, u32 &addr, u16 op)
+template <class H, class C> template<Instr I, Mode M, Size S> void
+MoiraT<H, C>::dasmNop(StrWriter &str, u32 &addr, u16 op)
 {
     str << Ins<I>{};
 }
 
-template <Instr I, Mode M, Size S> void
-Moira::dasmPea(StrWriter &str, u32 &addr, u16 op)
+template <class H, class C> template <Instr I, Mode M, Size S> void
+MoiraT<H, C>::dasmPea(StrWriter &str, u32 &addr, u16 op)
 {
     auto src = Op <M,S> ( _____________xxx(op), addr );
 
     str << Ins<I>{} << tab << src;
 }
 
-template <Instr I, Mode M, Size S> void
-Moira::dasmReset(StrWriter &str, u32 &addr, u16 op)
+template <class H, class C> template <Instr I, Mode M, Size S> void
+MoiraT<H, C>::dasmReset(StrWriter &str, u32 &addr, u16 op)
 {
     str << Ins<I>{};
 }
 
-template <Instr I, Mode M, Size S> void
-Moira::dasmRte(StrWriter &str, u32 &addr, u16 op)
+template <class H, class C> template <Instr I, Mode M, Size S> void
+MoiraT<H, C>::dasmRte(StrWriter &str, u32 &addr, u16 op)
 {
     str << Ins<I>{};
 }
 
-template <Instr I, Mode M, Size S> void
-Moira::dasmRtr(StrWriter &str, u32 &addr, u16 op)
+template <class H, class C> template <Instr I, Mode M, Size S> void
+MoiraT<H, C>::dasmRtr(StrWriter &str, u32 &addr, u16 op)
 {
     str << Ins<I>{};
 }
 
-template <Instr I, Mode M, Size S> void
-Moira::dasmRts(StrWriter &str, u32 &addr, u16 op)
+template <class H, class C> template <Instr I, Mode M, Size S> void
+MoiraT<H, C>::dasmRts(StrWriter &str, u32 &addr, u16 op)
 {
     str << Ins<I>{};
 }
 
-template<Instr I, Mode M, Size S> void
-Moira::dasmSccRg(StrWriter &str, u32 &addr, u16 op)
+template <class H, class C> template<Instr I, Mode M, Size S> void
+MoiraT<H, C>::dasmSccRg(StrWriter &str, u32 &addr, u16 op)
 {
     auto src = Dn ( _____________xxx(op) );
 
     str << Ins<I>{} << tab << src;
 }
 
-template<Instr I, Mode M, Size S> void
-Moira::dasmSccEa(StrWriter &str, u32 &addr, u16 op)
+template <class H, class C> template<Instr I, Mode M, Size S> void
+MoiraT<H, C>::dasmSccEa(StrWriter &str, u32 &addr, u16 op)
 {
     auto src = Op <M,S> ( _____________xxx(op), addr );
 
     str << Ins<I>{} << tab << src;
 }
 
-template<Instr I, Mode M, Size S> void
-Moira::dasmStop(StrWriter &str, u32 &addr, u16 op)
+template <class H, class C> template<Instr I, Mode M, Size S> void
+MoiraT<H, C>::dasmStop(StrWriter &str, u32 &addr, u16 op)
 {
     auto src = Ims ( SEXT<S>(dasmRead<S>(addr)) );
 
     str << Ins<I>{} << tab << src;
 }
 
-template<Instr I, Mode M, Size S> void
-Moira::dasmNegRg(StrWriter &str, u32 &addr, u16 op)
+template <class H, class C> template<Instr I, Mode M, Size S> void
+MoiraT<H, C>::dasmNegRg(StrWriter &str, u32 &addr, u16 op)
 {
     auto dst = Dn ( _____________xxx(op) );
 
     str << Ins<I>{} << Sz<S>{} << tab << dst;
 }
 
-template<Instr I, Mode M, Size S> void
-Moira::dasmNegEa(StrWriter &str, u32 &addr, u16 op)
+template <class H, class C> template<Instr I, Mode M, Size S> void
+MoiraT<H, C>::dasmNegEa(StrWriter &str, u32 &addr, u16 op)
 {
     auto dst = Op <M,S> ( _____________xxx(op), addr );
 
     str << Ins<I>{} << Sz<S>{} << tab << dst;
 }
 
-template<Instr I, Mode M, Size S> void
-Moira::dasmSwap(StrWriter &str, u32 &addr, u16 op)
+template <class H, class C> template<Instr I, Mode M, Size S> void
+MoiraT<H, C>::dasmSwap(StrWriter &str, u32 &addr, u16 op)
 {
     Dn reg = Dn ( _____________xxx(op) );
 
     str << Ins<I>{} << tab << reg;
 }
 
-template<Instr I, Mode M, Size S> void
-Moira::dasmTasRg(StrWriter &str, u32 &addr, u16 op)
+template <class H, class C> template<Instr I, Mode M, Size S> void
+MoiraT<H, C>::dasmTasRg(StrWriter &str, u32 &addr, u16 op)
 {
     auto dst = Dn ( _____________xxx(op) );
 
     str << Ins<I>{} << tab << dst;
 }
 
-template<Instr I, Mode M, Size S> void
-Moira::dasmTasEa(StrWriter &str, u32 &addr, u16 op)
+template <class H, class C> template<Instr I, Mode M, Size S> void
+MoiraT<H, C>::dasmTasEa(StrWriter &str, u32 &addr, u16 op)
 {
     auto dst = Op <M,S> ( _____________xxx(op), addr );
 
     str << Ins<I>{} << tab << dst;
 }
 
-template<Instr I, Mode M, Size S> void
-Moira::dasmTrap(StrWriter &str, u32 &addr, u16 op)
+template <class H, class C> template<Instr I, Mode M, Size S> void
+MoiraT<H, C>::dasmTrap(StrWriter &str, u32 &addr, u16 op)
 {
     auto nr = Imu ( ____________xxxx(op) );
 
     str << Ins<I>{} << tab << nr;
 }
 
-template<Instr I, Mode M, Size S> void
-Moira::dasmTrapv(StrWriter &str, u32 &addr, u16 op)
+template <class H, class C> template<Instr I, Mode M, Size S> void
+MoiraT<H, C>::dasmTrapv(StrWriter &str, u32 &addr, u16 op)
 {
     str << Ins<I>{};
 }
 
-template<Instr I, Mode M, Size S> void
-Moira::dasmTst(StrWriter &str, u32 &addr, u16 op)
+template <class H, class C> template<Instr I, Mode M, Size S> void
+MoiraT<H, C>::dasmTst(StrWriter &str, u32 &addr, u16 op)
 {
     auto ea = Op <M,S> ( _____________xxx(op), addr );
 
     str << Ins<I>{} << Sz<S>{} << tab << ea;
 }
 
-template <Instr I, Mode M, Size S> void
-Moira::dasmUnlk(StrWriter &str, u32 &addr, u16 op)
+template <class H, class C> template <Instr I, Mode M, Size S> void
+MoiraT<H, C>::dasmUnlk(StrWriter &str, u32 &addr, u16 op)
 {
     auto reg = An ( _____________xxx(op) );
 
@@ -7,8 +7,8 @@
 // See https://www.gnu.org for license information
 // -----------------------------------------------------------------------------
 
-template<Mode M, Size S, Flags F> bool
-Moira::readOp(int n, u32 &ea, u32 &result)
+template <class H, class C> template<Mode M, Size S, Flags F> bool
+MoiraT<H, C>::readOp(int n, u32 &ea, u32 &result)
 {
     switch (M) {
             
@@ -38,8 +38,8 @@ Moira::readOp(int n, u32 &ea, u32 &result)
     }
 }
 
-template<Mode M, Size S, Flags F> bool
-Moira::writeOp(int n, u32 val)
+template <class H, class C> template<Mode M, Size S, Flags F> bool
+MoiraT<H, C>::writeOp(int n, u32 val)
 {
     switch (M) {
             
@@ -69,8 +69,8 @@ Moira::writeOp(int n, u32 val)
     }
 }
 
-template<Mode M, Size S, Flags F> void
-Moira::writeOp(int n, u32 ea, u32 val)
+template <class H, class C> template<Mode M, Size S, Flags F> void
+MoiraT<H, C>::writeOp(int n, u32 ea, u32 val)
 {
     switch (M) {
             
@@ -84,8 +84,8 @@ Moira::writeOp(int n, u32 ea, u32 val)
     }
 }
 
-template<Mode M, Size S, Flags F> u32
-Moira::computeEA(u32 n) {
+template <class H, class C> template<Mode M, Size S, Flags F> u32
+MoiraT<H, C>::computeEA(u32 n) {
 
     assert(n < 8);
 
@@ -111,7 +111,7 @@ Moira::computeEA(u32 n) {
         }
         case 4:  // -(An)
         {
-            if ((F & IMPLICIT_DECR) == 0) sync(2);
+            if ((F & IMPLICIT_DECR) == 0) advance(2);
             result = readA(n) - ((n == 7 && S == Byte) ? 2 : S);
             break;
         }
@@ -132,7 +132,7 @@ Moira::computeEA(u32 n) {
 
             result = U32_ADD3(an, d, ((queue.irc & 0x800) ? xi : SEXT<Word>(xi)));
 
-            sync(2);
+            advance(2);
             if ((F & SKIP_LAST_READ) == 0) readExt();
             break;
         }
@@ -164,7 +164,7 @@ Moira::computeEA(u32 n) {
             u32 xi = readR((queue.irc >> 12) & 0b1111);
             
             result = U32_ADD3(reg.pc, d, ((queue.irc & 0x800) ? xi : SEXT<Word>(xi)));
-            sync(2);
+            advance(2);
             if ((F & SKIP_LAST_READ) == 0) readExt();
             break;
         }
@@ -181,30 +181,30 @@ Moira::computeEA(u32 n) {
     return result;
 }
 
-template<Mode M, Size S> void
-Moira::updateAnPD(int n)
+template <class H, class C> template<Mode M, Size S> void
+MoiraT<H, C>::updateAnPD(int n)
 {
     // -(An)
     if constexpr (M == 4) reg.a[n] -= (n == 7 && S == Byte) ? 2 : S;
 }
 
-template<Mode M, Size S> void
-Moira::undoAnPD(int n)
+template <class H, class C> template<Mode M, Size S> void
+MoiraT<H, C>::undoAnPD(int n)
 {
     // -(An)
     if constexpr (M == 4) reg.a[n] += (n == 7 && S == Byte) ? 2 : S;
 }
 
-template<Mode M, Size S> void
-Moira::updateAnPI(int n)
+template <class H, class C> template<Mode M, Size S> void
+MoiraT<H, C>::updateAnPI(int n)
 {
     // (An)+
     if constexpr (M == 3) reg.a[n] += (n == 7 && S == Byte) ? 2 : S;
 
 }
 
-template<Mode M, Size S> void
-Moira::updateAn(int n)
+template <class H, class C> template<Mode M, Size S> void
+MoiraT<H, C>::updateAn(int n)
 {
     // (An)+
     if constexpr (M == 3) reg.a[n] += (n == 7 && S == Byte) ? 2 : S;
@@ -213,8 +213,8 @@ Moira::updateAn(int n)
     if constexpr (M == 4) reg.a[n] -= (n == 7 && S == Byte) ? 2 : S;
 }
 
-template<Mode M, Size S, Flags F> u32
-Moira::readM(u32 addr, bool &error)
+template <class H, class C> template<Mode M, Size S, Flags F> u32
+MoiraT<H, C>::readM(u32 addr, bool &error)
 {
     if (isPrgMode(M)) {
         return readMS <MEM_PROG, S, F> (addr, error);
@@ -223,8 +223,8 @@ Moira::readM(u32 addr, bool &error)
     }
 }
 
-template<Mode M, Size S, Flags F> u32
-Moira::readM(u32 addr)
+template <class H, class C> template<Mode M, Size S, Flags F> u32
+MoiraT<H, C>::readM(u32 addr)
 {
     if (isPrgMode(M)) {
         return readMS <MEM_PROG, S, F> (addr);
@@ -233,8 +233,8 @@ Moira::readM(u32 addr)
     }
 }
 
-template<MemSpace MS, Size S, Flags F> u32
-Moira::readMS(u32 addr, bool &error)
+template <class H, class C> template<MemSpace MS, Size S, Flags F> u32
+MoiraT<H, C>::readMS(u32 addr, bool &error)
 {
     // Check for address errors
     if ((error = misaligned<S>(addr)) == true) {
@@ -247,8 +247,8 @@ Moira::readMS(u32 addr, bool &error)
     return readMS <MS,S,F> (addr);
 }
 
-template<MemSpace MS, Size S, Flags F> u32
-Moira::readMS(u32 addr)
+template <class H, class C> template<MemSpace MS, Size S, Flags F> u32
+MoiraT<H, C>::readMS(u32 addr)
 {
     u32 result;
         
@@ -263,23 +263,36 @@ Moira::readMS(u32 addr)
         // Update function code pins
         setFC(MS == MEM_DATA ? FC_USER_DATA : FC_USER_PROG);
         
-        // Check if a watchpoint is being accessed
-        if ((flags & CPU_CHECK_WP) && debugger.watchpointMatches(addr, S)) {
-            watchpointReached(addr);
+        // Check if a watchpoint is being accessed or an idle loop is observed
+        if (flags & (CPU_CHECK_WP | CPU_TRACK_IDLE)) {
+
+            if constexpr (C::enableDebugger) {
+                if ((flags & CPU_CHECK_WP) && debugger.watchpointMatches(addr, S)) {
+                    host().watchpointReached(addr);
+                }
+            }
+            if ((flags & CPU_TRACK_IDLE) && MS == MEM_DATA) {
+                idle.reads++;
+                if (!host().isPollingAddress(addr & 0xFFFFFF)) idle.clean = false;
+            }
         }
         
         // Perform the read operation
-        sync(2);
+        advance(2);
         if (F & POLLIPL) pollIpl();
-        result = (S == Byte) ? read8(addr & 0xFFFFFF) : read16(addr & 0xFFFFFF);
-        sync(2);
+        if (u8 *p = lookupTLB<MS, false, S>(addr); p) {
+            result = (S == Byte) ? p[0] : (p[0] << 8 | p[1]);
+        } else {
+            result = (S == Byte) ? host().read8(addr & 0xFFFFFF) : host().read16(addr & 0xFFFFFF);
+        }
+        advance(2);
     }
     
     return result;
 }
 
-template<Mode M, Size S, Flags F> void
-Moira::writeM(u32 addr, u32 val, bool &error)
+template <class H, class C> template<Mode M, Size S, Flags F> void
+MoiraT<H, C>::writeM(u32 addr, u32 val, bool &error)
 {
     if (isPrgMode(M)) {
         writeMS <MEM_PROG, S, F> (addr, val, error);
@@ -288,8 +301,8 @@ Moira::writeM(u32 addr, u32 val, bool &error)
     }
 }
 
-template<Mode M, Size S, Flags F> void
-Moira::writeM(u32 addr, u32 val)
+template <class H, class C> template<Mode M, Size S, Flags F> void
+MoiraT<H, C>::writeM(u32 addr, u32 val)
 {
     if (isPrgMode(M)) {
         writeMS <MEM_PROG, S, F> (addr, val);
@@ -298,8 +311,8 @@ Moira::writeM(u32 addr, u32 val)
     }
 }
 
-template<MemSpace MS, Size S, Flags F> void
-Moira::writeMS(u32 addr, u32 val, bool &error)
+template <class H, class C> template<MemSpace MS, Size S, Flags F> void
+MoiraT<H, C>::writeMS(u32 addr, u32 val, bool &error)
 {
     // Check for address errors
     if ((error = misaligned<S>(addr)) == true) {
@@ -311,8 +324,8 @@ Moira::writeMS(u32 addr, u32 val, bool &error)
     writeMS <MS,S,F> (addr, val);
 }
 
-template<MemSpace MS, Size S, Flags F> void
-Moira::writeMS(u32 addr, u32 val)
+template <class H, class C> template<MemSpace MS, Size S, Flags F> void
+MoiraT<H, C>::writeMS(u32 addr, u32 val)
 {
     if constexpr (S == Long) {
 
@@ -330,21 +343,36 @@ Moira::writeMS(u32 addr, u32 val)
         // Update function code pins
         setFC(MS == MEM_DATA ? FC_USER_DATA : FC_USER_PROG);
         
-        // Check if a watchpoint is being accessed
-        if ((flags & CPU_CHECK_WP) && debugger.watchpointMatches(addr, S)) {
-            watchpointReached(addr);
+        // Check if a watchpoint is being accessed or an idle loop is observed
+        if (flags & (CPU_CHECK_WP | CPU_TRACK_IDLE)) {
+
+            if constexpr (C::enableDebugger) {
+                if ((flags & CPU_CHECK_WP) && debugger.watchpointMatches(addr, S)) {
+                    host().watchpointReached(addr);
+                }
+            }
+            if (flags & CPU_TRACK_IDLE) {
+                idle.clean = false;
+            }
         }
+
+        // Record the modified page
+        if (C::dirtyTracking && !dirty.empty()) markDirty(addr, S);
         
         // Perform the write operation
-        sync(2);
+        advance(2);
         if (F & POLLIPL) pollIpl();
-        S == Byte ? write8(addr & 0xFFFFFF, (u8)val) : write16(addr & 0xFFFFFF, (u16)val);
-        sync(2);
+        if (u8 *p = lookupTLB<MS, true, S>(addr); p) {
+            if (S == Byte) { p[0] = (u8)val; } else { p[0] = (u8)(val >> 8); p[1] = (u8)val; }
+        } else {
+            S == Byte ? host().write8(addr & 0xFFFFFF, (u8)val) : host().write16(addr & 0xFFFFFF, (u16)val);
+        }
+        advance(2);
     }
 }
 
-template<Size S> u32
-Moira::readI()
+template <class H, class C> template<Size S> u32
+MoiraT<H, C>::readI()
 {
     u32 result;
 
@@ -377,28 +405,28 @@ Moira::readI()
     return result;
 }
 
-template<Size S, Flags F> void
-Moira::push(u32 val)
+template <class H, class C> template<Size S, Flags F> void
+MoiraT<H, C>::push(u32 val)
 {
     reg.sp -= S;
     writeMS <MEM_DATA,S,F> (reg.sp, val);
 }
 
-template<Size S, Flags F> void
-Moira::push(u32 val, bool &error)
+template <class H, class C> template<Size S, Flags F> void
+MoiraT<H, C>::push(u32 val, bool &error)
 {
     reg.sp -= S;
     writeMS <MEM_DATA,S,F> (reg.sp, val, error);
 }
 
-template<Size S> bool
-Moira::misaligned(u32 addr)
+template <class H, class C> template<Size S> bool
+MoiraT<H, C>::misaligned(u32 addr)
 {
-    return EMULATE_ADDRESS_ERROR ? ((addr & 1) && S != Byte) : false;
+    return C::emulateAddressError ? ((addr & 1) && S != Byte) : false;
 }
 
-template <Flags F> AEStackFrame
-Moira::makeFrame(u32 addr, u32 pc, u16 sr, u16 ird)
+template <class H, class C> template <Flags F> AEStackFrame
+MoiraT<H, C>::makeFrame(u32 addr, u32 pc, u16 sr, u16 ird)
 {
     AEStackFrame frame;
     u16 read = 0x10;
@@ -425,20 +453,20 @@ Moira::makeFrame(u32 addr, u32 pc, u16 sr, u16 ird)
     return frame;
 }
 
-template <Flags F> AEStackFrame
-Moira::makeFrame(u32 addr, u32 pc)
+template <class H, class C> template <Flags F> AEStackFrame
+MoiraT<H, C>::makeFrame(u32 addr, u32 pc)
 {
     return makeFrame <F> (addr, pc, getSR(), getIRD());
 }
 
-template <Flags F> AEStackFrame
-Moira::makeFrame(u32 addr)
+template <class H, class C> template <Flags F> AEStackFrame
+MoiraT<H, C>::makeFrame(u32 addr)
 {
     return makeFrame <F> (addr, getPC(), getSR(), getIRD());
 }
 
-template<Flags F> void
-Moira::prefetch()
+template <class H, class C> template<Flags F> void
+MoiraT<H, C>::prefetch()
 {
     /* Whereas pc is a moving target (it moves forward while an instruction is
      * being processed, pc0 stays stable throughout the entire execution of
@@ -451,8 +479,8 @@ Moira::prefetch()
     queue.irc = (u16)readMS <MEM_PROG, Word, F> (reg.pc + 2);
 }
 
-template<Flags F, int delay> void
-Moira::fullPrefetch()
+template <class H, class C> template<Flags F, int delay> void
+MoiraT<H, C>::fullPrefetch()
 {    
     // Check for address error
     if (misaligned(reg.pc)) {
@@ -461,12 +489,12 @@ Moira::fullPrefetch()
     }
 
     queue.irc = (u16)readMS <MEM_PROG, Word> (reg.pc);
-    if (delay) sync(delay);
+    if (delay) advance(delay);
     prefetch<F>();
 }
 
-void
-Moira::readExt()
+template <class H, class C> void
+MoiraT<H, C>::readExt()
 {
     reg.pc += 2;
     
@@ -479,12 +507,15 @@ Moira::readExt()
     queue.irc = (u16)readMS <MEM_PROG, Word> (reg.pc);
 }
 
-template<Flags F> void
-Moira::jumpToVector(int nr)
+template <class H, class C> template<Flags F> void
+MoiraT<H, C>::jumpToVector(int nr)
 {
     u32 vectorAddr = 4 * nr;
 
     exception = nr;
+
+    // Don't let the loop kernels observe an iteration containing an exception
+    loop.pc = UINT32_MAX;
     
     // Update the program counter
     reg.pc = readMS <MEM_DATA, Long> (vectorAddr);
@@ -501,11 +532,13 @@ Moira::jumpToVector(int nr)
     
     // Update the prefetch queue
     queue.irc = (u16)readMS <MEM_PROG, Word> (reg.pc);
-    sync(2);
+    advance(2);
     prefetch<POLLIPL>();
     
     // Stop emulation if the exception should be catched
-    if (debugger.catchpointMatches(nr)) catchpointReached(u8(nr));
+    if constexpr (C::enableDebugger) {
+        if (debugger.catchpointMatches(nr)) host().catchpointReached(u8(nr));
+    }
 
-    signalJumpToVector(nr, reg.pc);
+    host().signalJumpToVector(nr, reg.pc);
 }
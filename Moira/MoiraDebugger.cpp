@@ -177,9 +177,9 @@ void
 Breakpoints::setNeedsCheck(bool value)
 {
     if (value) {
-        moira.flags |= Moira::CPU_CHECK_BP;
+        moira.flags |= MoiraBase::CPU_CHECK_BP;
     } else {
-        moira.flags &= ~Moira::CPU_CHECK_BP;
+        moira.flags &= ~MoiraBase::CPU_CHECK_BP;
     }
 }
 
@@ -187,9 +187,9 @@ void
 Watchpoints::setNeedsCheck(bool value)
 {
     if (value) {
-        moira.flags |= Moira::CPU_CHECK_WP;
+        moira.flags |= MoiraBase::CPU_CHECK_WP;
     } else {
-        moira.flags &= ~Moira::CPU_CHECK_WP;
+        moira.flags &= ~MoiraBase::CPU_CHECK_WP;
     }
 }
 
@@ -197,9 +197,9 @@ void
 Catchpoints::setNeedsCheck(bool value)
 {
     if (value) {
-        moira.flags |= Moira::CPU_CHECK_CP;
+        moira.flags |= MoiraBase::CPU_CHECK_CP;
     } else {
-        moira.flags &= ~Moira::CPU_CHECK_CP;
+        moira.flags &= ~MoiraBase::CPU_CHECK_CP;
     }
 }
 
@@ -248,7 +248,7 @@ void
 Debugger::stepOver()
 {
     char tmp[64];
-    softStop = moira.getPC() + moira.disassemble(moira.getPC(), tmp);
+    softStop = moira.reg.pc + moira.disassemble(moira.reg.pc, tmp);
     breakpoints.setNeedsCheck(true);
 }
 
@@ -286,13 +286,14 @@ Debugger::catchpointMatches(u32 vectorNr)
 void
 Debugger::enableLogging()
 {
-    moira.flags |= Moira::CPU_LOG_INSTRUCTION;
+    if (!logBuffer) logBuffer = std::make_unique<Registers[]>(logBufferCapacity);
+    moira.flags |= MoiraBase::CPU_LOG_INSTRUCTION;
 }
 
 void
 Debugger::disableLogging()
 {
-    moira.flags &= ~Moira::CPU_LOG_INSTRUCTION;
+    moira.flags &= ~MoiraBase::CPU_LOG_INSTRUCTION;
 }
 
 int
@@ -368,8 +369,7 @@ Debugger::vectorName(u8 vectorNr)
 void
 Debugger::jump(u32 addr)
 {
-    moira.reg.pc = addr;
-    moira.fullPrefetch<POLLIPL>();
+    moira.jump(addr);
 }
 
 }
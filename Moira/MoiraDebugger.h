@@ -12,6 +12,7 @@
 #include "MoiraConfig.h"
 #include "MoiraTypes.h"
 #include <map>
+#include <memory>
 
 namespace moira {
 
@@ -69,7 +70,7 @@ public:
 
 public:
 
-    // Guards(Moira& ref) : moira(ref) { }
+    // Guards(MoiraBase& ref) : moira(ref) { }
     virtual ~Guards();
     
     
@@ -132,31 +133,31 @@ public:
 
 class Breakpoints : public Guards {
 
-    class Moira &moira;
+    class MoiraBase &moira;
 
 public:
 
-    Breakpoints(Moira& ref) : moira(ref) { }
+    Breakpoints(MoiraBase& ref) : moira(ref) { }
     void setNeedsCheck(bool value) override;
 };
 
 class Watchpoints : public Guards {
 
-    class Moira &moira;
+    class MoiraBase &moira;
     
 public:
 
-    Watchpoints(Moira& ref) : moira(ref) { }
+    Watchpoints(MoiraBase& ref) : moira(ref) { }
     void setNeedsCheck(bool value) override;
 };
 
 class Catchpoints : public Guards {
 
-    class Moira &moira;
+    class MoiraBase &moira;
     
 public:
 
-    Catchpoints(Moira& ref) : moira(ref) { }
+    Catchpoints(MoiraBase& ref) : moira(ref) { }
     void setNeedsCheck(bool value) override;
 };
 
@@ -188,7 +189,7 @@ class Debugger {
 public:
 
     // Reference to the connected CPU
-    class Moira &moira;
+    class MoiraBase &moira;
 
     // Breakpoints, watchpoints, and catchpoints
     Breakpoints breakpoints = Breakpoints(moira);
@@ -208,9 +209,9 @@ private:
      */
     std::optional <i64> softStop;
     
-    // Buffer storing logged instructions
+    // Buffer storing logged instructions (allocated when logging is enabled)
     static const int logBufferCapacity = 256;
-    Registers logBuffer[logBufferCapacity];
+    std::unique_ptr<Registers[]> logBuffer;
 
     // Logging counter
     long logCnt = 0;
@@ -222,7 +223,7 @@ private:
 
 public:
 
-    Debugger(Moira& ref) : moira(ref) { }
+    Debugger(MoiraBase& ref) : moira(ref) { }
 
     void reset();
 
@@ -294,4 +295,16 @@ public:
     void jump(u32 addr);    
 };
 
+/* Placeholder for the debugger in cores built without one
+ *
+ * The placeholder occupies no storage. All calls into the debugger are
+ * compiled out in cores using it (see ENABLE_DEBUGGER).
+ */
+class NoDebugger {
+
+public:
+
+    NoDebugger(class MoiraBase&) { }
+};
+
 }
@@ -7,8 +7,8 @@
 // See https://www.gnu.org for license information
 // -----------------------------------------------------------------------------
 
-void
-Moira::saveToStack(AEStackFrame &frame)
+template <class H, class C> void
+MoiraT<H, C>::saveToStack(AEStackFrame &frame)
 {
     // Push PC
     push <Word> ((u16)frame.pc);
@@ -26,10 +26,10 @@ Moira::saveToStack(AEStackFrame &frame)
     push <Word> (frame.code);
 }
 
-void
-Moira::saveToStackBrief(u16 sr, u32 pc)
+template <class H, class C> void
+MoiraT<H, C>::saveToStackBrief(u16 sr, u32 pc)
 {
-    if constexpr (MIMIC_MUSASHI) {
+    if constexpr (C::mimicMusashi) {
 
         push <Long> (pc);
         push <Word> (sr);
@@ -43,15 +43,15 @@ Moira::saveToStackBrief(u16 sr, u32 pc)
     }
 }
 
-void
-Moira::execAddressError(AEStackFrame frame, int delay)
+template <class H, class C> void
+MoiraT<H, C>::execAddressError(AEStackFrame frame, int delay)
 {
     EXEC_DEBUG
 
     assert(frame.addr & 1);
     
     // Emulate additional delay
-    sync(delay);
+    advance(delay);
     
     // Enter supervisor mode
     setSupervisorMode(true);
@@ -59,7 +59,7 @@ Moira::execAddressError(AEStackFrame frame, int delay)
     // Disable tracing
     clearTraceFlag();
     flags &= ~CPU_TRACE_EXCEPTION;
-    sync(8);
+    advance(8);
 
     // A misaligned stack pointer will cause a "double fault"
     bool doubleFault = misaligned<Word>(reg.sp);
@@ -68,19 +68,19 @@ Moira::execAddressError(AEStackFrame frame, int delay)
         
         // Write stack frame
         saveToStack(frame);
-        sync(2);
+        advance(2);
         jumpToVector(3);
     }
     
     // Inform the delegate
-    signalAddressError(frame);
+    host().signalAddressError(frame);
     
     // Halt the CPU if a double fault occurred
     if (doubleFault) halt();
 }
 
-void
-Moira::execUnimplemented(int nr)
+template <class H, class C> void
+MoiraT<H, C>::execUnimplemented(int nr)
 {
     EXEC_DEBUG
 
@@ -94,19 +94,99 @@ Moira::execUnimplemented(int nr)
     flags &= ~CPU_TRACE_EXCEPTION;
 
     // Write exception information to stack
-    sync(4);
+    advance(4);
     saveToStackBrief(status, reg.pc - 2);
 
     jumpToVector<AE_SET_CB3>(nr);
 }
 
-void
-Moira::execLineA(u16 opcode)
+template <class H, class C> void
+MoiraT<H, C>::setNativeHandler(u16 opcode, NativeHandler handler)
+{
+    assert((opcode & 0xFFF0) == 0x4E40 || (opcode & 0xF000) == 0xA000 || (opcode & 0xF000) == 0xF000);
+
+    if (natives.empty()) natives.resize(16 + 2 * 4096);
+    natives[nativeIndex(opcode)] = handler;
+}
+
+template <class H, class C> bool
+MoiraT<H, C>::execNative(u16 opcode)
+{
+    if (natives.empty()) return false;
+
+    auto &handler = natives[nativeIndex(opcode)];
+    if (!handler) return false;
+
+    u32 pc = reg.pc;
+
+    int cycles = handler(opcode);
+    if (cycles < 0) return false;
+    advance(cycles);
+
+    // Continue with the next instruction or at the location set by the handler
+    if (reg.pc == pc) {
+        prefetch<POLLIPL>();
+    } else {
+        fullPrefetch<POLLIPL>();
+    }
+    return true;
+}
+
+template <class H, class C> void
+MoiraT<H, C>::setPCHook(u32 addr, PCHook hook)
+{
+    assert(!(addr & 1));
+
+    if (hook) {
+        hooks[addr & 0xFFFFFF] = hook;
+    } else {
+        hooks.erase(addr & 0xFFFFFF);
+    }
+
+    // Rebuild the page bitmap
+    hookPages.reset();
+    if (!hooks.empty()) hookPages = std::make_unique<u64[]>(4096 / 64);
+    for (auto &it : hooks) hookPages[it.first >> 18] |= 1ULL << ((it.first >> 12) & 63);
+
+    // Translated blocks don't check for hooks
+    flushJit();
+}
+
+template <class H, class C> void
+MoiraT<H, C>::returnFromHook()
+{
+    reg.pc = readMS<MEM_DATA, Long>(reg.sp);
+    reg.sp += 4;
+}
+
+template <class H, class C> bool
+MoiraT<H, C>::execHook()
+{
+    auto it = hooks.find(reg.pc & 0xFFFFFF);
+    if (it == hooks.end()) return false;
+
+    u32 pc = reg.pc;
+
+    int cycles = it->second(pc);
+    if (cycles < 0) return false;
+    advance(cycles);
+
+    // Don't skip the hook as part of an idle loop
+    idle.clean = false;
+
+    // Execute the hooked instruction or continue at the location set by the hook
+    if (reg.pc == pc) return false;
+    fullPrefetch<POLLIPL>();
+    return true;
+}
+
+template <class H, class C> void
+MoiraT<H, C>::execLineA(u16 opcode)
 {
     EXEC_DEBUG
 
     // Check if a software trap is set for this instruction
-    if (debugger.swTraps.traps.contains(opcode)) {
+    if constexpr (C::enableDebugger) if (debugger.swTraps.traps.contains(opcode)) {
 
         auto &trap = debugger.swTraps.traps[opcode];
         
@@ -116,39 +196,45 @@ Moira::execLineA(u16 opcode)
         prefetch();
         
         // Call the delegates
-        signalSoftwareTrap(opcode, debugger.swTraps.traps[opcode]);
-        swTrapReached(reg.pc0);
+        host().signalSoftwareTrap(opcode, debugger.swTraps.traps[opcode]);
+        host().swTrapReached(reg.pc0);
         return;
     }
+
+    // Check if the instruction is emulated natively
+    if (execNative(opcode)) return;
     
-    signalLineAException(opcode);
+    host().signalLineAException(opcode);
     execUnimplemented(10);
 }
 
-void
-Moira::execLineF(u16 opcode)
+template <class H, class C> void
+MoiraT<H, C>::execLineF(u16 opcode)
 {
     EXEC_DEBUG
 
-    signalLineFException(opcode);
+    // Check if the instruction is emulated natively
+    if (execNative(opcode)) return;
+
+    host().signalLineFException(opcode);
     execUnimplemented(11);
 }
 
-void
-Moira::execIllegal(u16 opcode)
+template <class H, class C> void
+MoiraT<H, C>::execIllegal(u16 opcode)
 {
     EXEC_DEBUG
 
-    signalIllegalOpcodeException(opcode);
+    host().signalIllegalOpcodeException(opcode);
     execUnimplemented(4);
 }
 
-void
-Moira::execTraceException()
+template <class H, class C> void
+MoiraT<H, C>::execTraceException()
 {
     EXEC_DEBUG
 
-    signalTraceException();
+    host().signalTraceException();
     
     u16 status = getSR();
 
@@ -163,18 +249,18 @@ Moira::execTraceException()
     flags &= ~CPU_TRACE_EXCEPTION;
 
     // Write exception information to stack
-    sync(4);
+    advance(4);
     saveToStackBrief(status, reg.pc);
 
     jumpToVector(9);
 }
 
-void
-Moira::execTrapException(int nr)
+template <class H, class C> void
+MoiraT<H, C>::execTrapException(int nr)
 {
     EXEC_DEBUG
 
-    signalTrapException();
+    host().signalTrapException();
     
     u16 status = getSR();
 
@@ -190,12 +276,12 @@ Moira::execTrapException(int nr)
     jumpToVector(nr);
 }
 
-void
-Moira::execPrivilegeException()
+template <class H, class C> void
+MoiraT<H, C>::execPrivilegeException()
 {
     EXEC_DEBUG
 
-    signalPrivilegeViolation();
+    host().signalPrivilegeViolation();
     
     u16 status = getSR();
 
@@ -207,21 +293,21 @@ Moira::execPrivilegeException()
     flags &= ~CPU_TRACE_EXCEPTION;
 
     // Write exception information to stack
-    sync(4);
+    advance(4);
     saveToStackBrief(status, reg.pc - 2);
 
     jumpToVector<AE_SET_CB3>(8);
 }
 
-void
-Moira::execIrqException(u8 level)
+template <class H, class C> void
+MoiraT<H, C>::execIrqException(u8 level)
 {
     EXEC_DEBUG
     
     assert(level < 8);
     
     // Notify delegate
-    signalInterrupt(level);
+    host().signalInterrupt(level);
     
     // Remember the current value of the status register
     u16 status = getSR();
@@ -242,14 +328,14 @@ Moira::execIrqException(u8 level)
     clearTraceFlag();
     flags &= ~CPU_TRACE_EXCEPTION;
         
-    sync(6);
+    advance(6);
     reg.sp -= 6;
     writeMS <MEM_DATA, Word> (reg.sp + 4, reg.pc & 0xFFFF);
 
-    sync(4);
+    advance(4);
     queue.ird = getIrqVector(level);
     
-    sync(4);
+    advance(4);
     writeMS <MEM_DATA, Word> (reg.sp + 0, status);
     writeMS <MEM_DATA, Word> (reg.sp + 2, reg.pc >> 16);
 
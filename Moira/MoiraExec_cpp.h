@@ -29,6 +29,7 @@
 #define _____xx_________(opcode) (u8)((opcode >> 9)  & 0b11)
 #define ____xxx_________(opcode) (u8)((opcode >> 9)  & 0b111)
 #define ____x___________(opcode) (u8)((opcode >> 11) & 0b1)
+#define ____xxxx________(opcode) (u8)((opcode >> 8)  & 0b1111)
 #define xxxx____________(opcode) (u8)((opcode >> 12) & 0b1111)
 
 #define STD_AE_FRAME \
@@ -38,8 +39,8 @@
 (M == MODE_DIPC)            ? AE_DEC_PC : \
 (M == MODE_IXPC)            ? AE_DEC_PC : 0
 
-template<Instr I, Mode M, Size S> void
-Moira::execShiftRg(u16 opcode)
+template <class H, class C> template<Instr I, Mode M, Size S> void
+MoiraT<H, C>::execShiftRg(u16 opcode)
 {
     EXEC_DEBUG
     
@@ -48,13 +49,13 @@ Moira::execShiftRg(u16 opcode)
     int cnt = readD(src) & 0x3F;
 
     prefetch<POLLIPL>();
-    sync((S == Long ? 4 : 2) + 2 * cnt);
+    advance((S == Long ? 4 : 2) + 2 * cnt);
 
     writeD<S>(dst, shift<I,S>(cnt, readD<S>(dst)));
 }
 
-template<Instr I, Mode M, Size S> void
-Moira::execShiftIm(u16 opcode)
+template <class H, class C> template<Instr I, Mode M, Size S> void
+MoiraT<H, C>::execShiftIm(u16 opcode)
 {
     EXEC_DEBUG
 
@@ -63,13 +64,13 @@ Moira::execShiftIm(u16 opcode)
     int cnt = src ? src : 8;
 
     prefetch<POLLIPL>();
-    sync((S == Long ? 4 : 2) + 2 * cnt);
+    advance((S == Long ? 4 : 2) + 2 * cnt);
 
     writeD<S>(dst, shift<I,S>(cnt, readD<S>(dst)));
 }
 
-template<Instr I, Mode M, Size S> void
-Moira::execShiftEa(u16 op)
+template <class H, class C> template<Instr I, Mode M, Size S> void
+MoiraT<H, C>::execShiftEa(u16 op)
 {
     EXEC_DEBUG
     
@@ -83,8 +84,8 @@ Moira::execShiftEa(u16 op)
     writeM<M,S>(ea, shift<I,S>(1, data));
 }
 
-template<Instr I, Mode M, Size S> void
-Moira::execAbcd(u16 opcode)
+template <class H, class C> template<Instr I, Mode M, Size S> void
+MoiraT<H, C>::execAbcd(u16 opcode)
 {
     EXEC_DEBUG
     
@@ -99,7 +100,7 @@ Moira::execAbcd(u16 opcode)
         {
             u32 result = bcd<I,Byte>(readD<Byte>(src), readD<Byte>(dst));
             prefetch<POLLIPL>();
-            sync(2);
+            advance(2);
             writeD<Byte>(dst, result);
             break;
         }
@@ -119,8 +120,8 @@ Moira::execAbcd(u16 opcode)
     }
 }
 
-template<Instr I, Mode M, Size S> void
-Moira::execAddEaRg(u16 opcode)
+template <class H, class C> template<Instr I, Mode M, Size S> void
+MoiraT<H, C>::execAddEaRg(u16 opcode)
 {
     EXEC_DEBUG
 
@@ -134,12 +135,12 @@ Moira::execAddEaRg(u16 opcode)
     result = addsub<I,S>(data, readD<S>(dst));
     prefetch<POLLIPL>();
     
-    if constexpr (S == Long) sync(2 + (isMemMode(M) ? 0 : 2));
+    if constexpr (S == Long) advance(2 + (isMemMode(M) ? 0 : 2));
     writeD<S>(dst, result);
 }
 
-template<Instr I, Mode M, Size S> void
-Moira::execAddRgEa(u16 opcode)
+template <class H, class C> template<Instr I, Mode M, Size S> void
+MoiraT<H, C>::execAddRgEa(u16 opcode)
 {
     EXEC_DEBUG
 
@@ -155,8 +156,8 @@ Moira::execAddRgEa(u16 opcode)
     writeM <M, S> (ea, result);
 }
 
-template<Instr I, Mode M, Size S> void
-Moira::execAdda(u16 opcode)
+template <class H, class C> template<Instr I, Mode M, Size S> void
+MoiraT<H, C>::execAdda(u16 opcode)
 {
     EXEC_DEBUG
 
@@ -171,13 +172,13 @@ Moira::execAdda(u16 opcode)
     result = (I == ADDA) ? U32_ADD(readA(dst), data) : U32_SUB(readA(dst), data);
     prefetch<POLLIPL>();
 
-    sync(2);
-    if constexpr (S == Word || isRegMode(M) || isImmMode(M)) sync(2);
+    advance(2);
+    if constexpr (S == Word || isRegMode(M) || isImmMode(M)) advance(2);
     writeA(dst, result);
 }
 
-template<Instr I, Mode M, Size S> void
-Moira::execAddiRg(u16 opcode)
+template <class H, class C> template<Instr I, Mode M, Size S> void
+MoiraT<H, C>::execAddiRg(u16 opcode)
 {
     EXEC_DEBUG
 
@@ -190,12 +191,12 @@ Moira::execAddiRg(u16 opcode)
     result = addsub<I,S>(src, data);
     prefetch<POLLIPL>();
 
-    if constexpr (S == Long) sync(4);
+    if constexpr (S == Long) advance(4);
     writeD<S>(dst, result);
 }
 
-template<Instr I, Mode M, Size S> void
-Moira::execAddiEa(u16 opcode)
+template <class H, class C> template<Instr I, Mode M, Size S> void
+MoiraT<H, C>::execAddiEa(u16 opcode)
 {
     EXEC_DEBUG
 
@@ -211,8 +212,8 @@ Moira::execAddiEa(u16 opcode)
     writeOp<M,S, POLLIPL>(dst, ea, result);
 }
 
-template<Instr I, Mode M, Size S> void
-Moira::execAddqDn(u16 opcode)
+template <class H, class C> template<Instr I, Mode M, Size S> void
+MoiraT<H, C>::execAddqDn(u16 opcode)
 {
     EXEC_DEBUG
 
@@ -223,12 +224,12 @@ Moira::execAddqDn(u16 opcode)
     u32 result = addsub<I,S>(src, readD<S>(dst));
     prefetch<POLLIPL>();
 
-    if constexpr (S == Long) sync(4);
+    if constexpr (S == Long) advance(4);
     writeD<S>(dst, result);
 }
 
-template<Instr I, Mode M, Size S> void
-Moira::execAddqAn(u16 opcode)
+template <class H, class C> template<Instr I, Mode M, Size S> void
+MoiraT<H, C>::execAddqAn(u16 opcode)
 {
     EXEC_DEBUG
 
@@ -239,12 +240,12 @@ Moira::execAddqAn(u16 opcode)
     u32 result = (I == ADDQ) ? readA(dst) + src : readA(dst) - src;
     prefetch<POLLIPL>();
 
-    sync(4);
+    advance(4);
     writeA(dst, result);
 }
 
-template<Instr I, Mode M, Size S> void
-Moira::execAddqEa(u16 opcode)
+template <class H, class C> template<Instr I, Mode M, Size S> void
+MoiraT<H, C>::execAddqEa(u16 opcode)
 {
     EXEC_DEBUG
 
@@ -261,8 +262,8 @@ Moira::execAddqEa(u16 opcode)
     writeOp<M,S>(dst, ea, result);
 }
 
-template<Instr I, Mode M, Size S> void
-Moira::execAddxRg(u16 opcode)
+template <class H, class C> template<Instr I, Mode M, Size S> void
+MoiraT<H, C>::execAddxRg(u16 opcode)
 {
     EXEC_DEBUG
 
@@ -272,12 +273,12 @@ Moira::execAddxRg(u16 opcode)
     u32 result = addsub<I,S>(readD<S>(src), readD<S>(dst));
     prefetch<POLLIPL>();
 
-    if constexpr (S == Long) sync(4);
+    if constexpr (S == Long) advance(4);
     writeD<S>(dst, result);
 }
 
-template<Instr I, Mode M, Size S> void
-Moira::execAddxEa(u16 opcode)
+template <class H, class C> template<Instr I, Mode M, Size S> void
+MoiraT<H, C>::execAddxEa(u16 opcode)
 {
     EXEC_DEBUG
 
@@ -302,7 +303,7 @@ Moira::execAddxEa(u16 opcode)
 
     u32 result = addsub<I,S>(data1, data2);
 
-    if constexpr (S == Long && !MIMIC_MUSASHI) {
+    if constexpr (S == Long && !C::mimicMusashi) {
 
         writeM <M, Word, POLLIPL> (ea2 + 2, result & 0xFFFF);
         prefetch();
@@ -315,8 +316,8 @@ Moira::execAddxEa(u16 opcode)
     }
 }
 
-template<Instr I, Mode M, Size S> void
-Moira::execAndEaRg(u16 opcode)
+template <class H, class C> template<Instr I, Mode M, Size S> void
+MoiraT<H, C>::execAndEaRg(u16 opcode)
 {
     EXEC_DEBUG
 
@@ -329,12 +330,12 @@ Moira::execAndEaRg(u16 opcode)
     u32 result = logic<I,S>(data, readD<S>(dst));
     prefetch<POLLIPL>();
 
-    if constexpr (S == Long) sync(isRegMode(M) || isImmMode(M) ? 4 : 2);
+    if constexpr (S == Long) advance(isRegMode(M) || isImmMode(M) ? 4 : 2);
     writeD<S>(dst, result);
 }
 
-template<Instr I, Mode M, Size S> void
-Moira::execAndRgEa(u16 opcode)
+template <class H, class C> template<Instr I, Mode M, Size S> void
+MoiraT<H, C>::execAndRgEa(u16 opcode)
 {
     EXEC_DEBUG
 
@@ -347,17 +348,17 @@ Moira::execAndRgEa(u16 opcode)
     u32 result = logic<I,S>(readD<S>(src), data);
     prefetch<POLLIPL>();
     
-    if constexpr (S == Long && isRegMode(M)) sync(4);
+    if constexpr (S == Long && isRegMode(M)) advance(4);
     
-    if constexpr (MIMIC_MUSASHI) {
+    if constexpr (C::mimicMusashi) {
         writeOp <M,S> (dst, ea, result);
     } else {
         writeOp <M,S, REVERSE> (dst, ea, result);
     }
 }
 
-template<Instr I, Mode M, Size S> void
-Moira::execAndiRg(u16 opcode)
+template <class H, class C> template<Instr I, Mode M, Size S> void
+MoiraT<H, C>::execAndiRg(u16 opcode)
 {
     EXEC_DEBUG
 
@@ -367,12 +368,12 @@ Moira::execAndiRg(u16 opcode)
     u32 result = logic<I,S>(src, readD<S>(dst));
     prefetch<POLLIPL>();
 
-    if constexpr (S == Long) sync(4);
+    if constexpr (S == Long) advance(4);
     writeD<S>(dst, result);
 }
 
-template<Instr I, Mode M, Size S> void
-Moira::execAndiEa(u16 opcode)
+template <class H, class C> template<Instr I, Mode M, Size S> void
+MoiraT<H, C>::execAndiEa(u16 opcode)
 {
     EXEC_DEBUG
 
@@ -386,22 +387,22 @@ Moira::execAndiEa(u16 opcode)
     result = logic<I,S>(src, data);
     prefetch<POLLIPL>();
 
-    if constexpr (MIMIC_MUSASHI) {
+    if constexpr (C::mimicMusashi) {
         writeOp <M,S> (dst, ea, result);
     } else {
         writeOp <M,S, REVERSE> (dst, ea, result);
     }
 }
 
-template<Instr I, Mode M, Size S> void
-Moira::execAndiccr(u16 opcode)
+template <class H, class C> template<Instr I, Mode M, Size S> void
+MoiraT<H, C>::execAndiccr(u16 opcode)
 {
     EXEC_DEBUG
 
     u32 src = readI<S>();
     u8  dst = getCCR();
 
-    sync(8);
+    advance(8);
 
     u32 result = logic<I,S>(src, dst);
     setCCR((u8)result);
@@ -410,8 +411,8 @@ Moira::execAndiccr(u16 opcode)
     prefetch<POLLIPL>();
 }
 
-template<Instr I, Mode M, Size S> void
-Moira::execAndisr(u16 opcode)
+template <class H, class C> template<Instr I, Mode M, Size S> void
+MoiraT<H, C>::execAndisr(u16 opcode)
 {
     EXEC_DEBUG
 
@@ -420,7 +421,7 @@ Moira::execAndisr(u16 opcode)
     u32 src = readI<S>();
     u16 dst = getSR();
 
-    sync(8);
+    advance(8);
 
     u32 result = logic<I,S>(src, dst);
     setSR((u16)result);
@@ -429,13 +430,13 @@ Moira::execAndisr(u16 opcode)
     prefetch<POLLIPL>();
 }
 
-template<Instr I, Mode M, Size S> void
-Moira::execBcc(u16 opcode)
+template <class H, class C> template<Instr I, Mode M, Size S> void
+MoiraT<H, C>::execBcc(u16 opcode)
 {
     EXEC_DEBUG
 
-    sync(2);
-    if (cond<I>()) {
+    advance(2);
+    if (cond<I>(opcode)) {
 
         u32 newpc = U32_ADD(reg.pc, S == Word ? (i16)queue.irc : (i8)opcode);
         
@@ -445,6 +446,9 @@ Moira::execBcc(u16 opcode)
             return;
         }
                 
+        // Check for an idle loop
+        if (detectIdle && newpc <= reg.pc0) detectIdleLoop();
+
         // Take branch
         reg.pc = newpc;
         fullPrefetch<POLLIPL>();
@@ -452,14 +456,14 @@ Moira::execBcc(u16 opcode)
     } else {
 
         // Fall through to next instruction
-        sync(2);
+        advance(2);
         if constexpr (S == Word) readExt();
         prefetch<POLLIPL>();
     }
 }
 
-template<Instr I, Mode M, Size S> void
-Moira::execBitDxEa(u16 opcode)
+template <class H, class C> template<Instr I, Mode M, Size S> void
+MoiraT<H, C>::execBitDxEa(u16 opcode)
 {
     EXEC_DEBUG
 
@@ -476,7 +480,7 @@ Moira::execBitDxEa(u16 opcode)
 
             prefetch<POLLIPL>();
 
-            sync(cyclesBit<I>(b));
+            advance(cyclesBit<I>(b));
             if (I != BTST) writeD(dst, data);
             break;
         }
@@ -495,8 +499,8 @@ Moira::execBitDxEa(u16 opcode)
     }
 }
 
-template<Instr I, Mode M, Size S> void
-Moira::execBitImEa(u16 opcode)
+template <class H, class C> template<Instr I, Mode M, Size S> void
+MoiraT<H, C>::execBitImEa(u16 opcode)
 {
     EXEC_DEBUG
 
@@ -513,7 +517,7 @@ Moira::execBitImEa(u16 opcode)
 
             prefetch<POLLIPL>();
 
-            sync(cyclesBit<I>(src));
+            advance(cyclesBit<I>(src));
             if (I != BTST) writeD(dst, data);
             break;
         }
@@ -531,16 +535,16 @@ Moira::execBitImEa(u16 opcode)
     }
 }
 
-template<Instr I, Mode M, Size S> void
-Moira::execBsr(u16 opcode)
+template <class H, class C> template<Instr I, Mode M, Size S> void
+MoiraT<H, C>::execBsr(u16 opcode)
 {
     EXEC_DEBUG
     
     i32 offset = S == Word ? (i16)queue.irc : (i8)opcode;
     if (S == Long)
     {
-        offset=read16(reg.pc);
-        offset=(offset<<16) | read16(reg.pc+2);
+        offset=host().read16(reg.pc);
+        offset=(offset<<16) | host().read16(reg.pc+2);
     }
 
     u32 newpc = U32_ADD(reg.pc, offset);
@@ -552,7 +556,7 @@ Moira::execBsr(u16 opcode)
     }
     
     // Save return address on stack
-    sync(2);
+    advance(2);
     bool error;
     push <Long> (retpc, error);
     if (error) return;
@@ -563,11 +567,11 @@ Moira::execBsr(u16 opcode)
 
     fullPrefetch<POLLIPL>();
     
-    signalJsrBsrInstr(opcode, oldpc, reg.pc);
+    host().signalJsrBsrInstr(opcode, oldpc, reg.pc);
 }
 
-template<Instr I, Mode M, Size S> void
-Moira::execChk(u16 opcode)
+template <class H, class C> template<Instr I, Mode M, Size S> void
+MoiraT<H, C>::execChk(u16 opcode)
 {
     EXEC_DEBUG
 
@@ -579,16 +583,16 @@ Moira::execChk(u16 opcode)
     if (!readOp<M,S, STD_AE_FRAME>(src, ea, data)) return;
     dy = readD<S>(dst);
 
-    sync(6);
+    advance(6);
 
     reg.sr.z = ZERO<S>(dy);
     reg.sr.v = 0;
     reg.sr.c = 0;
-    reg.sr.n = MIMIC_MUSASHI ? reg.sr.n : 0;
+    reg.sr.n = C::mimicMusashi ? reg.sr.n : 0;
 
     if ((i16)dy > (i16)data) {
 
-        sync(MIMIC_MUSASHI ? 10 - (int)(clock - c) : 2);
+        advance(C::mimicMusashi ? 10 - (int)(clock - c) : 2);
         reg.sr.n = NBIT<S>(dy);
         execTrapException(6);
         return;
@@ -596,8 +600,8 @@ Moira::execChk(u16 opcode)
 
     if ((i16)dy < 0) {
 
-        sync(MIMIC_MUSASHI ? 10 - (int)(clock - c) : 4);
-        reg.sr.n = MIMIC_MUSASHI ? NBIT<S>(dy) : 1;
+        advance(C::mimicMusashi ? 10 - (int)(clock - c) : 4);
+        reg.sr.n = C::mimicMusashi ? NBIT<S>(dy) : 1;
         execTrapException(6);
         return;
     }
@@ -605,8 +609,8 @@ Moira::execChk(u16 opcode)
     prefetch<POLLIPL>();
 }
 
-template<Instr I, Mode M, Size S> void
-Moira::execClr(u16 opcode)
+template <class H, class C> template<Instr I, Mode M, Size S> void
+MoiraT<H, C>::execClr(u16 opcode)
 {
     EXEC_DEBUG
 
@@ -617,9 +621,9 @@ Moira::execClr(u16 opcode)
 
     prefetch<POLLIPL>();
     
-    if constexpr (S == Long && isRegMode(M)) sync(2);
+    if constexpr (S == Long && isRegMode(M)) advance(2);
     
-    if constexpr (MIMIC_MUSASHI) {
+    if constexpr (C::mimicMusashi) {
         writeOp <M,S> (dst, ea, 0);
     } else {
         writeOp <M,S, REVERSE> (dst, ea, 0);
@@ -631,8 +635,8 @@ Moira::execClr(u16 opcode)
     reg.sr.c = 0;
 }
 
-template<Instr I, Mode M, Size S> void
-Moira::execCmp(u16 opcode)
+template <class H, class C> template<Instr I, Mode M, Size S> void
+MoiraT<H, C>::execCmp(u16 opcode)
 {
     EXEC_DEBUG
 
@@ -645,11 +649,11 @@ Moira::execCmp(u16 opcode)
     cmp<S>(data, readD<S>(dst));
     prefetch<POLLIPL>();
 
-    if constexpr (S == Long) sync(2);
+    if constexpr (S == Long) advance(2);
 }
 
-template<Instr I, Mode M, Size S> void
-Moira::execCmpa(u16 opcode)
+template <class H, class C> template<Instr I, Mode M, Size S> void
+MoiraT<H, C>::execCmpa(u16 opcode)
 {
     EXEC_DEBUG
 
@@ -663,11 +667,11 @@ Moira::execCmpa(u16 opcode)
     cmp<Long>(data, readA(dst));
     prefetch<POLLIPL>();
 
-    sync(2);
+    advance(2);
 }
 
-template<Instr I, Mode M, Size S> void
-Moira::execCmpiRg(u16 opcode)
+template <class H, class C> template<Instr I, Mode M, Size S> void
+MoiraT<H, C>::execCmpiRg(u16 opcode)
 {
     EXEC_DEBUG
 
@@ -676,12 +680,12 @@ Moira::execCmpiRg(u16 opcode)
 
     prefetch<POLLIPL>();
 
-    if constexpr (S == Long) sync(2);
+    if constexpr (S == Long) advance(2);
     cmp<S>(src, readD<S>(dst));
 }
 
-template<Instr I, Mode M, Size S> void
-Moira::execCmpiEa(u16 opcode)
+template <class H, class C> template<Instr I, Mode M, Size S> void
+MoiraT<H, C>::execCmpiEa(u16 opcode)
 {
     EXEC_DEBUG
 
@@ -695,8 +699,8 @@ Moira::execCmpiEa(u16 opcode)
     cmp<S>(src, data);
 }
 
-template<Instr I, Mode M, Size S> void
-Moira::execCmpm(u16 opcode)
+template <class H, class C> template<Instr I, Mode M, Size S> void
+MoiraT<H, C>::execCmpm(u16 opcode)
 {
     EXEC_DEBUG
 
@@ -713,13 +717,13 @@ Moira::execCmpm(u16 opcode)
     prefetch();
 }
 
-template<Instr I, Mode M, Size S> void
-Moira::execDbcc(u16 opcode)
+template <class H, class C> template<Instr I, Mode M, Size S> void
+MoiraT<H, C>::execDbcc(u16 opcode)
 {
     EXEC_DEBUG
 
-    sync(2);
-    if (!cond<I>()) {
+    advance(2);
+    if (!cond<I>(opcode)) {
 
         int dn = _____________xxx(opcode);
         u32 newpc = U32_ADD(reg.pc, (i16)queue.irc);
@@ -737,6 +741,15 @@ Moira::execDbcc(u16 opcode)
 
         // Branch
         if (takeBranch) {
+            if (detectIdle && newpc <= reg.pc0) detectIdleLoop(dn);
+            if (!ram.empty() && newpc == reg.pc0 - 2) {
+                if constexpr (C::compactHandlers) {
+                    if (____xxxx________(opcode) == 0x1) execLoopKernel<DBF>(dn);
+                    if (____xxxx________(opcode) == 0x6) execLoopKernel<DBNE>(dn);
+                } else {
+                    execLoopKernel<I>(dn);
+                }
+            }
             reg.pc = newpc;
             fullPrefetch<POLLIPL>();
             return;
@@ -744,7 +757,7 @@ Moira::execDbcc(u16 opcode)
             (void)readMS <MEM_PROG, Word> (reg.pc + 2);
         }
     } else {
-        sync(2);
+        advance(2);
     }
 
     // Fall through to next instruction
@@ -752,8 +765,8 @@ Moira::execDbcc(u16 opcode)
     fullPrefetch<POLLIPL>();
 }
 
-template<Instr I, Mode M, Size S> void
-Moira::execExgDxDy(u16 opcode)
+template <class H, class C> template<Instr I, Mode M, Size S> void
+MoiraT<H, C>::execExgDxDy(u16 opcode)
 {
     EXEC_DEBUG
 
@@ -763,11 +776,11 @@ Moira::execExgDxDy(u16 opcode)
     std::swap(reg.d[src], reg.d[dst]);
     prefetch<POLLIPL>();
 
-    sync(2);
+    advance(2);
 }
 
-template<Instr I, Mode M, Size S> void
-Moira::execExgAxDy(u16 opcode)
+template <class H, class C> template<Instr I, Mode M, Size S> void
+MoiraT<H, C>::execExgAxDy(u16 opcode)
 {
     EXEC_DEBUG
 
@@ -777,11 +790,11 @@ Moira::execExgAxDy(u16 opcode)
     std::swap(reg.a[src], reg.d[dst]);
 
     prefetch<POLLIPL>();
-    sync(2);
+    advance(2);
 }
 
-template<Instr I, Mode M, Size S> void
-Moira::execExgAxAy(u16 opcode)
+template <class H, class C> template<Instr I, Mode M, Size S> void
+MoiraT<H, C>::execExgAxAy(u16 opcode)
 {
     EXEC_DEBUG
 
@@ -791,11 +804,11 @@ Moira::execExgAxAy(u16 opcode)
     std::swap(reg.a[src], reg.a[dst]);
 
     prefetch<POLLIPL>();
-    sync(2);
+    advance(2);
 }
 
-template<Instr I, Mode M, Size S> void
-Moira::execExt(u16 opcode)
+template <class H, class C> template<Instr I, Mode M, Size S> void
+MoiraT<H, C>::execExt(u16 opcode)
 {
     EXEC_DEBUG
 
@@ -813,8 +826,8 @@ Moira::execExt(u16 opcode)
     prefetch<POLLIPL>();
 }
 
-template<Instr I, Mode M, Size S> void
-Moira::execJmp(u16 opcode)
+template <class H, class C> template<Instr I, Mode M, Size S> void
+MoiraT<H, C>::execJmp(u16 opcode)
 {
     EXEC_DEBUG
 
@@ -824,7 +837,7 @@ Moira::execJmp(u16 opcode)
     u32 ea  = computeEA <M,Long, SKIP_LAST_READ> (src);
     
     const int delay[] = { 0,0,0,0,0,2,4,2,0,2,4,0 };
-    sync(delay[M]);
+    advance(delay[M]);
     
     // Check for address error
     if (misaligned<Word>(ea)) {
@@ -839,8 +852,8 @@ Moira::execJmp(u16 opcode)
     fullPrefetch<POLLIPL>();
 }
 
-template<Instr I, Mode M, Size S> void
-Moira::execJsr(u16 opcode)
+template <class H, class C> template<Instr I, Mode M, Size S> void
+MoiraT<H, C>::execJsr(u16 opcode)
 {
     EXEC_DEBUG
 
@@ -848,7 +861,7 @@ Moira::execJsr(u16 opcode)
     u32 ea  = computeEA<M, Long, SKIP_LAST_READ>(src);
     
     const int delay[] = { 0,0,0,0,0,2,4,2,0,2,4,0 };
-    sync(delay[M]);
+    advance(delay[M]);
     
     // Check for address error in displacement modes
     if (isDspMode(M) && misaligned<Word>(ea)) {
@@ -877,11 +890,11 @@ Moira::execJsr(u16 opcode)
     queue.irc = (u16)readMS <MEM_PROG, Word> (ea);
     prefetch<POLLIPL>();
 
-    signalJsrBsrInstr(opcode, oldpc, reg.pc);
+    host().signalJsrBsrInstr(opcode, oldpc, reg.pc);
 }
 
-template<Instr I, Mode M, Size S> void
-Moira::execLea(u16 opcode)
+template <class H, class C> template<Instr I, Mode M, Size S> void
+MoiraT<H, C>::execLea(u16 opcode)
 {
     EXEC_DEBUG
 
@@ -889,13 +902,13 @@ Moira::execLea(u16 opcode)
     int dst = ____xxx_________(opcode);
 
     reg.a[dst] = computeEA<M,S>(src);
-    if (isIdxMode(M)) sync(2);
+    if (isIdxMode(M)) advance(2);
 
     prefetch<POLLIPL>();
 }
 
-template<Instr I, Mode M, Size S> void
-Moira::execLink(u16 opcode)
+template <class H, class C> template<Instr I, Mode M, Size S> void
+MoiraT<H, C>::execLink(u16 opcode)
 {
     EXEC_DEBUG
 
@@ -915,7 +928,7 @@ Moira::execLink(u16 opcode)
     pollIpl();
 
     // Write to stack
-    push <Long> (readA(ax) - ((MIMIC_MUSASHI && ax == 7) ? 4 : 0));
+    push <Long> (readA(ax) - ((C::mimicMusashi && ax == 7) ? 4 : 0));
 
     // Modify address register and stack pointer
     writeA(ax, sp);
@@ -924,8 +937,8 @@ Moira::execLink(u16 opcode)
     prefetch();
 }
 
-template<Instr I, Mode M, Size S> void
-Moira::execMove0(u16 opcode)
+template <class H, class C> template<Instr I, Mode M, Size S> void
+MoiraT<H, C>::execMove0(u16 opcode)
 {
     EXEC_DEBUG
 
@@ -946,8 +959,8 @@ Moira::execMove0(u16 opcode)
     prefetch<POLLIPL>();
 }
 
-template<Instr I, Mode M, Size S> void
-Moira::execMove2(u16 opcode)
+template <class H, class C> template<Instr I, Mode M, Size S> void
+MoiraT<H, C>::execMove2(u16 opcode)
 {
     EXEC_DEBUG
 
@@ -985,8 +998,8 @@ Moira::execMove2(u16 opcode)
     }
 }
 
-template<Instr I, Mode M, Size S> void
-Moira::execMove3(u16 opcode)
+template <class H, class C> template<Instr I, Mode M, Size S> void
+MoiraT<H, C>::execMove3(u16 opcode)
 {
     EXEC_DEBUG
 
@@ -1024,8 +1037,8 @@ Moira::execMove3(u16 opcode)
     }
 }
 
-template<Instr I, Mode M, Size S> void
-Moira::execMove4(u16 opcode)
+template <class H, class C> template<Instr I, Mode M, Size S> void
+MoiraT<H, C>::execMove4(u16 opcode)
 {
     EXEC_DEBUG
 
@@ -1073,8 +1086,8 @@ Moira::execMove4(u16 opcode)
     updateAn<MODE_PD, S>(dst);
 }
 
-template<Instr I, Mode M, Size S> void
-Moira::execMove5(u16 opcode)
+template <class H, class C> template<Instr I, Mode M, Size S> void
+MoiraT<H, C>::execMove5(u16 opcode)
 {
     EXEC_DEBUG
 
@@ -1112,8 +1125,8 @@ Moira::execMove5(u16 opcode)
     }
 }
 
-template<Instr I, Mode M, Size S> void
-Moira::execMove6(u16 opcode)
+template <class H, class C> template<Instr I, Mode M, Size S> void
+MoiraT<H, C>::execMove6(u16 opcode)
 {
     EXEC_DEBUG
 
@@ -1151,8 +1164,8 @@ Moira::execMove6(u16 opcode)
     }
 }
 
-template<Instr I, Mode M, Size S> void
-Moira::execMove7(u16 opcode)
+template <class H, class C> template<Instr I, Mode M, Size S> void
+MoiraT<H, C>::execMove7(u16 opcode)
 {
     EXEC_DEBUG
 
@@ -1173,8 +1186,8 @@ Moira::execMove7(u16 opcode)
     prefetch<POLLIPL>();
 }
 
-template<Instr I, Mode M, Size S> void
-Moira::execMove8(u16 opcode)
+template <class H, class C> template<Instr I, Mode M, Size S> void
+MoiraT<H, C>::execMove8(u16 opcode)
 {
     EXEC_DEBUG
 
@@ -1236,8 +1249,8 @@ Moira::execMove8(u16 opcode)
     prefetch<POLLIPL>();
 }
 
-template<Instr I, Mode M, Size S> void
-Moira::execMovea(u16 opcode)
+template <class H, class C> template<Instr I, Mode M, Size S> void
+MoiraT<H, C>::execMovea(u16 opcode)
 {
     EXEC_DEBUG
 
@@ -1251,8 +1264,8 @@ Moira::execMovea(u16 opcode)
     writeA(dst, SEXT<S>(data));
 }
 
-template<Instr I, Mode M, Size S> void
-Moira::execMovemEaRg(u16 opcode)
+template <class H, class C> template<Instr I, Mode M, Size S> void
+MoiraT<H, C>::execMovemEaRg(u16 opcode)
 {
     EXEC_DEBUG
 
@@ -1304,8 +1317,8 @@ Moira::execMovemEaRg(u16 opcode)
     prefetch<POLLIPL>();
 }
 
-template<Instr I, Mode M, Size S> void
-Moira::execMovemRgEa(u16 opcode)
+template <class H, class C> template<Instr I, Mode M, Size S> void
+MoiraT<H, C>::execMovemRgEa(u16 opcode)
 {
     EXEC_DEBUG
 
@@ -1329,7 +1342,7 @@ Moira::execMovemRgEa(u16 opcode)
 
                 if (mask & (0x8000 >> i)) {
                     ea -= S;
-                    writeM <M, S, MIMIC_MUSASHI ? REVERSE : 0> (ea, reg.r[i]);
+                    writeM <M, S, C::mimicMusashi ? REVERSE : 0> (ea, reg.r[i]);
                 }
             }
             writeA(dst, ea);
@@ -1359,8 +1372,8 @@ Moira::execMovemRgEa(u16 opcode)
     prefetch<POLLIPL>();
 }
 
-template<Instr I, Mode M, Size S> void
-Moira::execMovepDxEa(u16 opcode)
+template <class H, class C> template<Instr I, Mode M, Size S> void
+MoiraT<H, C>::execMovepDxEa(u16 opcode)
 {
     EXEC_DEBUG
 
@@ -1387,8 +1400,8 @@ Moira::execMovepDxEa(u16 opcode)
     prefetch<POLLIPL>();
 }
 
-template<Instr I, Mode M, Size S> void
-Moira::execMovepEaDx(u16 opcode)
+template <class H, class C> template<Instr I, Mode M, Size S> void
+MoiraT<H, C>::execMovepEaDx(u16 opcode)
 {
     EXEC_DEBUG
 
@@ -1418,8 +1431,8 @@ Moira::execMovepEaDx(u16 opcode)
     prefetch();
 }
 
-template<Instr I, Mode M, Size S> void
-Moira::execMoveq(u16 opcode)
+template <class H, class C> template<Instr I, Mode M, Size S> void
+MoiraT<H, C>::execMoveq(u16 opcode)
 {
     EXEC_DEBUG
 
@@ -1436,8 +1449,8 @@ Moira::execMoveq(u16 opcode)
     prefetch<POLLIPL>();
 }
 
-template<Instr I, Mode M, Size S> void
-Moira::execMoveToCcr(u16 opcode)
+template <class H, class C> template<Instr I, Mode M, Size S> void
+MoiraT<H, C>::execMoveToCcr(u16 opcode)
 {
     EXEC_DEBUG
 
@@ -1446,15 +1459,15 @@ Moira::execMoveToCcr(u16 opcode)
     
     if (!readOp <M,S, STD_AE_FRAME> (src, ea, data)) return;
 
-    sync(4);
+    advance(4);
     setCCR((u8)data);
 
     (void)readMS <MEM_PROG, Word> (reg.pc + 2);
     prefetch<POLLIPL>();
 }
 
-template<Instr I, Mode M, Size S> void
-Moira::execMoveFromSrRg(u16 opcode)
+template <class H, class C> template<Instr I, Mode M, Size S> void
+MoiraT<H, C>::execMoveFromSrRg(u16 opcode)
 {
     EXEC_DEBUG
 
@@ -1464,12 +1477,12 @@ Moira::execMoveFromSrRg(u16 opcode)
     if (!readOp <M,S> (dst, ea, data)) return;
     prefetch<POLLIPL>();
 
-    sync(2);
+    advance(2);
     writeD <S> (dst, getSR());
 }
 
-template<Instr I, Mode M, Size S> void
-Moira::execMoveFromSrEa(u16 opcode)
+template <class H, class C> template<Instr I, Mode M, Size S> void
+MoiraT<H, C>::execMoveFromSrEa(u16 opcode)
 {
     EXEC_DEBUG
 
@@ -1482,8 +1495,8 @@ Moira::execMoveFromSrEa(u16 opcode)
     writeOp <M,S, POLLIPL> (dst, ea, getSR());
 }
 
-template<Instr I, Mode M, Size S> void
-Moira::execMoveToSr(u16 opcode)
+template <class H, class C> template<Instr I, Mode M, Size S> void
+MoiraT<H, C>::execMoveToSr(u16 opcode)
 {
     EXEC_DEBUG
 
@@ -1494,15 +1507,15 @@ Moira::execMoveToSr(u16 opcode)
     u32 ea, data;
     if (!readOp <M,S, STD_AE_FRAME> (src, ea, data)) return;
 
-    sync(4);
+    advance(4);
     setSR((u16)data);
 
     (void)readMS <MEM_PROG, Word> (reg.pc + 2);
     prefetch<POLLIPL>();
 }
 
-template<Instr I, Mode M, Size S> void
-Moira::execMoveUspAn(u16 opcode)
+template <class H, class C> template<Instr I, Mode M, Size S> void
+MoiraT<H, C>::execMoveUspAn(u16 opcode)
 {
     EXEC_DEBUG
 
@@ -1513,8 +1526,8 @@ Moira::execMoveUspAn(u16 opcode)
     writeA(an, getUSP());
 }
 
-template<Instr I, Mode M, Size S> void
-Moira::execMoveAnUsp(u16 opcode)
+template <class H, class C> template<Instr I, Mode M, Size S> void
+MoiraT<H, C>::execMoveAnUsp(u16 opcode)
 {
     EXEC_DEBUG
 
@@ -1525,12 +1538,12 @@ Moira::execMoveAnUsp(u16 opcode)
     setUSP(readA(an));
 }
 
-template<Instr I, Mode M, Size S> void
-Moira::execMul(u16 opcode)
+template <class H, class C> template<Instr I, Mode M, Size S> void
+MoiraT<H, C>::execMul(u16 opcode)
 {
     EXEC_DEBUG
 
-    if constexpr (MIMIC_MUSASHI) {
+    if constexpr (C::mimicMusashi) {
         execMulMusashi<I, M, S>(opcode);
         return;
     }
@@ -1547,8 +1560,8 @@ Moira::execMul(u16 opcode)
     writeD(dst, result);
 }
 
-template<Instr I, Mode M, Size S> void
-Moira::execMulMusashi(u16 op)
+template <class H, class C> template<Instr I, Mode M, Size S> void
+MoiraT<H, C>::execMulMusashi(u16 op)
 {
     EXEC_DEBUG
     
@@ -1562,17 +1575,17 @@ Moira::execMulMusashi(u16 op)
     prefetch<POLLIPL>();
     result = mulMusashi<I>(data, readD<Word>(dst));
 
-    sync(50);
+    advance(50);
     writeD(dst, result);
 }
 
 
-template<Instr I, Mode M, Size S> void
-Moira::execDiv(u16 opcode)
+template <class H, class C> template<Instr I, Mode M, Size S> void
+MoiraT<H, C>::execDiv(u16 opcode)
 {
     EXEC_DEBUG
 
-    if constexpr (MIMIC_MUSASHI) {
+    if constexpr (C::mimicMusashi) {
         execDivMusashi<I, M, S>(opcode);
         return;
     }
@@ -1599,7 +1612,7 @@ Moira::execDiv(u16 opcode)
             reg.sr.c = 0;
         }
 
-        sync(8);
+        advance(8);
         execTrapException(5);
         return;
     }
@@ -1609,8 +1622,8 @@ Moira::execDiv(u16 opcode)
     prefetch<POLLIPL>();
 }
 
-template<Instr I, Mode M, Size S> void
-Moira::execDivMusashi(u16 opcode)
+template <class H, class C> template<Instr I, Mode M, Size S> void
+MoiraT<H, C>::execDivMusashi(u16 opcode)
 {
     EXEC_DEBUG
 
@@ -1623,7 +1636,7 @@ Moira::execDivMusashi(u16 opcode)
 
     // Check for division by zero
     if (divisor == 0) {
-        sync(8 - (int)(clock - c));
+        advance(8 - (int)(clock - c));
         execTrapException(5);
         return;
     }
@@ -1634,8 +1647,8 @@ Moira::execDivMusashi(u16 opcode)
     prefetch<POLLIPL>();
 }
 
-template<Instr I, Mode M, Size S> void
-Moira::execNbcd(u16 opcode)
+template <class H, class C> template<Instr I, Mode M, Size S> void
+MoiraT<H, C>::execNbcd(u16 opcode)
 {
     EXEC_DEBUG
 
@@ -1646,7 +1659,7 @@ Moira::execNbcd(u16 opcode)
         case 0: // Dn
         {
             prefetch<POLLIPL>();
-            sync(2);
+            advance(2);
             writeD<Byte>(reg, bcd<SBCD, Byte>(readD<Byte>(reg), 0));
             break;
         }
@@ -1661,8 +1674,8 @@ Moira::execNbcd(u16 opcode)
     }
 }
 
-template<Instr I, Mode M, Size S> void
-Moira::execNegRg(u16 opcode)
+template <class H, class C> template<Instr I, Mode M, Size S> void
+MoiraT<H, C>::execNegRg(u16 opcode)
 {
     EXEC_DEBUG
 
@@ -1674,12 +1687,12 @@ Moira::execNegRg(u16 opcode)
     data = logic<I,S>(data);
     prefetch<POLLIPL>();
 
-    if constexpr (S == Long) sync(2);
+    if constexpr (S == Long) advance(2);
     writeD<S>(dst, data);
 }
 
-template<Instr I, Mode M, Size S> void
-Moira::execNegEa(u16 opcode)
+template <class H, class C> template<Instr I, Mode M, Size S> void
+MoiraT<H, C>::execNegEa(u16 opcode)
 {
     EXEC_DEBUG
 
@@ -1691,23 +1704,23 @@ Moira::execNegEa(u16 opcode)
     data = logic<I,S>(data);
     prefetch <POLLIPL> ();
 
-    if constexpr (MIMIC_MUSASHI) {
+    if constexpr (C::mimicMusashi) {
         writeOp <M,S> (dst, ea, data);
     } else {
         writeOp <M,S,REVERSE> (dst, ea, data);
     }
 }
 
-template<Instr I, Mode M, Size S> void
-Moira::execNop(u16 opcode)
+template <class H, class C> template<Instr I, Mode M, Size S> void
+MoiraT<H, C>::execNop(u16 opcode)
 {
     EXEC_DEBUG
 
     prefetch<POLLIPL>();
 }
 
-template<Instr I, Mode M, Size S> void
-Moira::execPea(u16 opcode)
+template <class H, class C> template<Instr I, Mode M, Size S> void
+MoiraT<H, C>::execPea(u16 opcode)
 {
     EXEC_DEBUG
 
@@ -1715,7 +1728,7 @@ Moira::execPea(u16 opcode)
 
     u32 ea = computeEA<M,Long>(src);
 
-    if (isIdxMode(M)) sync(2);
+    if (isIdxMode(M)) advance(2);
     
     if (misaligned(reg.sp)) {
         reg.sp -= S;
@@ -1745,21 +1758,22 @@ Moira::execPea(u16 opcode)
     }
 }
 
-template<Instr I, Mode M, Size S> void
-Moira::execReset(u16 opcode)
+template <class H, class C> template<Instr I, Mode M, Size S> void
+MoiraT<H, C>::execReset(u16 opcode)
 {
     EXEC_DEBUG
 
     SUPERVISOR_MODE_ONLY
     
-    signalResetInstr();
+    host().signalResetInstr();
+    idle.clean = false;
     
-    sync(128);
+    advance(128);
     prefetch<POLLIPL>();
 }
 
-template<Instr I, Mode M, Size S> void
-Moira::execRte(u16 opcode)
+template <class H, class C> template<Instr I, Mode M, Size S> void
+MoiraT<H, C>::execRte(u16 opcode)
 {
     EXEC_DEBUG
 
@@ -1783,8 +1797,8 @@ Moira::execRte(u16 opcode)
     fullPrefetch<POLLIPL>();
 }
 
-template<Instr I, Mode M, Size S> void
-Moira::execRtr(u16 opcode)
+template <class H, class C> template<Instr I, Mode M, Size S> void
+MoiraT<H, C>::execRtr(u16 opcode)
 {
     EXEC_DEBUG
 
@@ -1809,12 +1823,12 @@ Moira::execRtr(u16 opcode)
     fullPrefetch<POLLIPL>();
 }
 
-template<Instr I, Mode M, Size S> void
-Moira::execRts(u16 opcode)
+template <class H, class C> template<Instr I, Mode M, Size S> void
+MoiraT<H, C>::execRts(u16 opcode)
 {
     EXEC_DEBUG
 
-    signalRtsInstr();
+    host().signalRtsInstr();
     
     bool error;
     u32 newpc = readM<M, Long>(reg.sp, error);
@@ -1831,8 +1845,8 @@ Moira::execRts(u16 opcode)
     fullPrefetch<POLLIPL>();
 }
 
-template<Instr I, Mode M, Size S> void
-Moira::execSccRg(u16 opcode)
+template <class H, class C> template<Instr I, Mode M, Size S> void
+MoiraT<H, C>::execSccRg(u16 opcode)
 {
     EXEC_DEBUG
 
@@ -1841,15 +1855,15 @@ Moira::execSccRg(u16 opcode)
 
     if (!readOp<M,Byte>(dst, ea, data)) return;
 
-    data = cond<I>() ? 0xFF : 0;
+    data = cond<I>(opcode) ? 0xFF : 0;
     prefetch<POLLIPL>();
 
-    if (data) sync(2);
+    if (data) advance(2);
     writeD<Byte>(dst, data);
 }
 
-template<Instr I, Mode M, Size S> void
-Moira::execSccEa(u16 opcode)
+template <class H, class C> template<Instr I, Mode M, Size S> void
+MoiraT<H, C>::execSccEa(u16 opcode)
 {
     EXEC_DEBUG
 
@@ -1858,14 +1872,14 @@ Moira::execSccEa(u16 opcode)
 
     if (!readOp<M,Byte>(dst, ea, data)) return;
 
-    data = cond<I>() ? 0xFF : 0;
+    data = cond<I>(opcode) ? 0xFF : 0;
     prefetch<POLLIPL>();
 
     writeOp <M,Byte> (dst, ea, data);
 }
 
-template<Instr I, Mode M, Size S> void
-Moira::execStop(u16 opcode)
+template <class H, class C> template<Instr I, Mode M, Size S> void
+MoiraT<H, C>::execStop(u16 opcode)
 {
     EXEC_DEBUG
 
@@ -1877,11 +1891,11 @@ Moira::execStop(u16 opcode)
     flags |= CPU_IS_STOPPED;
     reg.pc0 = reg.pc;
     
-    signalStopInstr(src);
+    host().signalStopInstr(src);
 }
 
-template<Instr I, Mode M, Size S> void
-Moira::execSwap(u16 opcode)
+template <class H, class C> template<Instr I, Mode M, Size S> void
+MoiraT<H, C>::execSwap(u16 opcode)
 {
     EXEC_DEBUG
 
@@ -1899,12 +1913,12 @@ Moira::execSwap(u16 opcode)
     reg.sr.c = 0;
 }
 
-template<Instr I, Mode M, Size S> void
-Moira::execTasRg(u16 opcode)
+template <class H, class C> template<Instr I, Mode M, Size S> void
+MoiraT<H, C>::execTasRg(u16 opcode)
 {
     EXEC_DEBUG
 
-    signalTasInstr();
+    host().signalTasInstr();
     
     int dst = ( _____________xxx(opcode) );
 
@@ -1922,12 +1936,12 @@ Moira::execTasRg(u16 opcode)
     prefetch<POLLIPL>();
 }
 
-template<Instr I, Mode M, Size S> void
-Moira::execTasEa(u16 opcode)
+template <class H, class C> template<Instr I, Mode M, Size S> void
+MoiraT<H, C>::execTasEa(u16 opcode)
 {
     EXEC_DEBUG
 
-    signalTasInstr();
+    host().signalTasInstr();
 
     int dst = ( _____________xxx(opcode) );
 
@@ -1940,25 +1954,28 @@ Moira::execTasEa(u16 opcode)
     reg.sr.c = 0;
     data |= 0x80;
 
-    if (!isRegMode(M)) sync(2);
+    if (!isRegMode(M)) advance(2);
     writeOp <M,S> (dst, ea, data);
 
     prefetch<POLLIPL>();
 }
 
-template<Instr I, Mode M, Size S> void
-Moira::execTrap(u16 opcode)
+template <class H, class C> template<Instr I, Mode M, Size S> void
+MoiraT<H, C>::execTrap(u16 opcode)
 {
     EXEC_DEBUG
 
+    // Check if the instruction is emulated natively
+    if (execNative(opcode)) return;
+
     int nr = ____________xxxx(opcode);
     
-    sync(4);
+    advance(4);
     execTrapException(32 + nr);
 }
 
-template<Instr I, Mode M, Size S> void
-Moira::execTrapv(u16 opcode)
+template <class H, class C> template<Instr I, Mode M, Size S> void
+MoiraT<H, C>::execTrapv(u16 opcode)
 {
     EXEC_DEBUG
 
@@ -1973,8 +1990,8 @@ Moira::execTrapv(u16 opcode)
     }
 }
 
-template<Instr I, Mode M, Size S> void
-Moira::execTst(u16 opcode)
+template <class H, class C> template<Instr I, Mode M, Size S> void
+MoiraT<H, C>::execTst(u16 opcode)
 {
     EXEC_DEBUG
 
@@ -1991,8 +2008,8 @@ Moira::execTst(u16 opcode)
     prefetch<POLLIPL>();
 }
 
-template<Instr I, Mode M, Size S> void
-Moira::execUnlk(u16 opcode)
+template <class H, class C> template<Instr I, Mode M, Size S> void
+MoiraT<H, C>::execUnlk(u16 opcode)
 {
     EXEC_DEBUG
 
@@ -2014,3 +2031,18 @@ Moira::execUnlk(u16 opcode)
     prefetch();
 }
 
+
+template <class H, class C> template <Instr I, typename MoiraT<H, C>::ExecPtr F> void
+MoiraT<H, C>::execPair(u16 opcode)
+{
+    (this->*F)(opcode);
+
+    // Dispatch the next instruction if it can be fused with this one
+    u16 next = queue.ird;
+    if (fusion && !flags && clock < nextEvent && ((fusableLines(I) >> (next >> 12)) & 1) && !hooked(reg.pc)) {
+
+        fusedPairs++;
+        reg.pc += 2;
+        (this->*exec[next])(next);
+    }
+}
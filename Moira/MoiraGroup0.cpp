@@ -0,0 +1,17 @@
+// -----------------------------------------------------------------------------
+// This file is part of Moira - A Motorola 68k emulator
+//
+// Copyright (C) Dirk W. Hoffmann. www.dirkwhoffmann.de
+// Licensed under the GNU General Public License v3
+//
+// See https://www.gnu.org for license information
+// -----------------------------------------------------------------------------
+
+#include "MoiraImpl.h"
+
+namespace moira {
+
+// Instantiate the handlers of instruction group 0 (ABCD to ASR)
+template void MoiraT<Moira>::bindGroup<0>();
+
+}
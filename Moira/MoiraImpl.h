@@ -0,0 +1,42 @@
+// -----------------------------------------------------------------------------
+// This file is part of Moira - A Motorola 68k emulator
+//
+// Copyright (C) Dirk W. Hoffmann. www.dirkwhoffmann.de
+// Licensed under the GNU General Public License v3
+//
+// See https://www.gnu.org for license information
+// -----------------------------------------------------------------------------
+
+/* This file provides the implementation of the MoiraT class template. The
+ * default core (class Moira) is instantiated inside the Moira library. Include
+ * this file in the translation unit that instantiates a custom host or
+ * configuration.
+ */
+
+#pragma once
+
+#include "Moira.h"
+
+#include <cstdio>
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <mutex>
+
+namespace moira {
+
+#include "MoiraInit_cpp.h"
+#include "MoiraALU_cpp.h"
+#include "MoiraDataflow_cpp.h"
+#include "MoiraExceptions_cpp.h"
+#include "MoiraExec_cpp.h"
+#include "MoiraKernels_cpp.h"
+#include "MoiraBlocks_cpp.h"
+#include "MoiraJit_cpp.h"
+#include "MoiraTLB_cpp.h"
+#include "StrWriter_cpp.h"
+#include "MoiraDasm_cpp.h"
+#include "MoiraTiming_cpp.h"
+#include "Moira_cpp.h"
+
+}
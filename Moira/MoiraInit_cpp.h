@@ -11,10 +11,9 @@
 
 #define TPARAM(x,y,z) <x,y,z>
 #define bind(id, name, I, M, S) { \
-assert(exec[id] == &Moira::execIllegal); \
-if (dasm) assert(dasm[id] == &Moira::dasmIllegal); \
-exec[id] = &Moira::exec##name TPARAM(I, M, S); \
-if (dasm) dasm[id] = &Moira::dasm##name TPARAM(I, M, S); \
+assert(exec[id] == &MoiraT::execIllegal); \
+exec[id] = fuse<I, &MoiraT::exec##name TPARAM(shared(I), M, S)>(); \
+if constexpr (C::enableDasm) bindDasm TPARAM(I, M, S)(&MoiraT::dasm##name TPARAM(I, M, S)); \
 if (info) info[id] = InstrInfo { I, M, S }; \
 }
 
@@ -115,20 +114,20 @@ parse(const char *s, int sum = 0)
     *s == '1' ? parse(s + 1, (sum << 1) + 1) : (u16)sum;
 }
 
-void
-Moira::createJumpTables()
+template <class H, class C> void
+MoiraT<H, C>::createJumpTables()
 {
-    u16 opcode;
-
     //
     // Start with clean tables
     //
 
     for (int i = 0; i < 0x10000; i++) {
-        exec[i] = &Moira::execIllegal;
-        if (dasm) dasm[i] = &Moira::dasmIllegal;
+        exec[i] = &MoiraT::execIllegal;
         if (info) info[i] = InstrInfo { ILLEGAL, MODE_IP, (Size)0 };
     }
+    for (int i = 0; dasm && i < dasmEntries; i++) {
+        dasm[i] = &MoiraT::dasmIllegal;
+    }
 
 
     // Unimplemented instructions
@@ -138,1219 +137,1258 @@ Moira::createJumpTables()
 
     for (int i = 0; i < 0x1000; i++) {
 
-        exec[0b1010 << 12 | i] = &Moira::execLineA;
-        if (dasm) dasm[0b1010 << 12 | i] = &Moira::dasmLineA;
+        exec[0b1010 << 12 | i] = &MoiraT::execLineA;
         if (info) info[0b1010 << 12 | i] = InstrInfo { LINE_A, MODE_IP, (Size)0 };
 
-        exec[0b1111 << 12 | i] = &Moira::execLineF;
-        if (dasm) dasm[0b1111 << 12 | i] = &Moira::dasmLineF;
+        exec[0b1111 << 12 | i] = &MoiraT::execLineF;
         if (info) info[0b1111 << 12 | i] = InstrInfo { LINE_F, MODE_IP, (Size)0 };
     }
+    if (dasm) {
 
-
-    // ABCD
-    //
-    //       Syntax: (1) ABCD Dx,Dy
-    //               (2) ABCD -(Ax),-(Ay)
-    //         Size: Byte
-
-    // Dx,Dy
-    opcode = parse("1100 ---1 0000 0---");
-    ____XXX______XXX(opcode, ABCD, MODE_DN, Byte, Abcd);
-
-    // -(Ax),-(Ay)
-    opcode = parse("1100 ---1 0000 1---");
-    ____XXX______XXX(opcode, ABCD, MODE_PD, Byte, Abcd);
-
-
-    // ADD
-    //
-    //       Syntax: (1) ADD <ea>,Dy
-    //               (2) ADD Dx,<ea>
-    //         Size: Byte, Word, Longword
-
-    //               -------------------------------------------------
-    // <ea>,Dy       | 0 | 1 | 2 | 3 | 4 | 5 | 6 | 7 | 8 | 9 | A | B |
-    //               -------------------------------------------------
-    //                 X  (X)  X   X   X   X   X   X   X   X   X   X
-
-    opcode = parse("1101 ---0 ---- ----");
-    ____XXX_SSMMMXXX(opcode, ADD, 0b101111111111, Byte,        AddEaRg);
-    ____XXX_SSMMMXXX(opcode, ADD, 0b111111111111, Word | Long, AddEaRg);
-
-    //               -------------------------------------------------
-    // Dx,<ea>       | 0 | 1 | 2 | 3 | 4 | 5 | 6 | 7 | 8 | 9 | A | B |
-    //               -------------------------------------------------
-    //                         X   X   X   X   X   X   X
-
-     opcode = parse("1101 ---1 ---- ----");
-     ____XXX_SSMMMXXX(opcode, ADD, 0b001111111000, Byte | Word | Long, AddRgEa);
-
-
-    // ADDA
-    //
-    //       Syntax: ADDA <ea>,Ay
-    //         Size: Word, Longword
-    //
-    //               -------------------------------------------------
-    // <ea>,Ay       | 0 | 1 | 2 | 3 | 4 | 5 | 6 | 7 | 8 | 9 | A | B |
-    //               -------------------------------------------------
-    //                 X   X   X   X   X   X   X   X   X   X   X   X
-
-    opcode = parse("1101 ---- 11-- ----");
-    ____XXXS__MMMXXX(opcode, ADDA, 0b111111111111, Word | Long, Adda)
-
-
-    // ADDI
-    //
-    //       Syntax: ADDI #<data>,<ea>
-    //         Size: Byte, Word, Longword
-    //
-    //               -------------------------------------------------
-    // #<data>,<ea>  | 0 | 1 | 2 | 3 | 4 | 5 | 6 | 7 | 8 | 9 | A | B |
-    //               -------------------------------------------------
-    //                 X       X   X   X   X   X   X   X
-
-    opcode = parse("0000 0110 ---- ----");
-    ________SSMMMXXX(opcode, ADDI, 0b100000000000, Byte | Word | Long, AddiRg);
-    ________SSMMMXXX(opcode, ADDI, 0b001111111000, Byte | Word | Long, AddiEa);
+        dasm[dasmIndex(LINE_A, MODE_IP, (Size)0)] = &MoiraT::dasmLineA;
+        dasm[dasmIndex(LINE_F, MODE_IP, (Size)0)] = &MoiraT::dasmLineF;
+    }
 
 
-    // ADDQ
     //
-    //       Syntax: ADDQ #<data>,<ea>
-    //         Size: Byte, Word, Longword
+    // Register all instructions group by group
     //
-    //               -------------------------------------------------
-    // #<data>,<ea>  | 0 | 1 | 2 | 3 | 4 | 5 | 6 | 7 | 8 | 9 | A | B |
-    //               -------------------------------------------------
-    //                 X  (X)  X   X   X   X   X   X   X
 
-    opcode = parse("0101 ---0 ---- ----");
-    ____XXX_SSMMMXXX(opcode, ADDQ, 0b100000000000, Byte | Word | Long, AddqDn);
-    ____XXX_SSMMMXXX(opcode, ADDQ, 0b010000000000, Word | Long,        AddqAn);
-    ____XXX_SSMMMXXX(opcode, ADDQ, 0b001111111000, Byte | Word | Long, AddqEa);
+    bindGroup<0>();
+    bindGroup<1>();
+    bindGroup<2>();
+    bindGroup<3>();
+    bindGroup<4>();
+    bindGroup<5>();
+    bindGroup<6>();
+    bindGroup<7>();
+}
 
+template <class H, class C> template <int G> void
+MoiraT<H, C>::bindGroup()
+{
+    u16 opcode;
 
-    // ADDX
-    //
-    //       Syntax: (1) ADDX Dx,Dy
-    //               (2) ADDX -(Ax),-(Ay)
-    //         Size: Byte, Word, Longword
+    if constexpr (G == 0) { // ABCD - ASR
 
-    // Dx,Dy
-    opcode = parse("1101 ---1 --00 0---");
-    ____XXX_SS___XXX(opcode, ADDX, MODE_DN, Byte | Word | Long, AddxRg);
+        // ABCD
+        //
+        //       Syntax: (1) ABCD Dx,Dy
+        //               (2) ABCD -(Ax),-(Ay)
+        //         Size: Byte
+
+        // Dx,Dy
+        opcode = parse("1100 ---1 0000 0---");
+        ____XXX______XXX(opcode, ABCD, MODE_DN, Byte, Abcd);
+
+        // -(Ax),-(Ay)
+        opcode = parse("1100 ---1 0000 1---");
+        ____XXX______XXX(opcode, ABCD, MODE_PD, Byte, Abcd);
+
+
+        // ADD
+        //
+        //       Syntax: (1) ADD <ea>,Dy
+        //               (2) ADD Dx,<ea>
+        //         Size: Byte, Word, Longword
+
+        //               -------------------------------------------------
+        // <ea>,Dy       | 0 | 1 | 2 | 3 | 4 | 5 | 6 | 7 | 8 | 9 | A | B |
+        //               -------------------------------------------------
+        //                 X  (X)  X   X   X   X   X   X   X   X   X   X
+
+        opcode = parse("1101 ---0 ---- ----");
+        ____XXX_SSMMMXXX(opcode, ADD, 0b101111111111, Byte,        AddEaRg);
+        ____XXX_SSMMMXXX(opcode, ADD, 0b111111111111, Word | Long, AddEaRg);
+
+        //               -------------------------------------------------
+        // Dx,<ea>       | 0 | 1 | 2 | 3 | 4 | 5 | 6 | 7 | 8 | 9 | A | B |
+        //               -------------------------------------------------
+        //                         X   X   X   X   X   X   X
+
+         opcode = parse("1101 ---1 ---- ----");
+         ____XXX_SSMMMXXX(opcode, ADD, 0b001111111000, Byte | Word | Long, AddRgEa);
+
+
+        // ADDA
+        //
+        //       Syntax: ADDA <ea>,Ay
+        //         Size: Word, Longword
+        //
+        //               -------------------------------------------------
+        // <ea>,Ay       | 0 | 1 | 2 | 3 | 4 | 5 | 6 | 7 | 8 | 9 | A | B |
+        //               -------------------------------------------------
+        //                 X   X   X   X   X   X   X   X   X   X   X   X
+
+        opcode = parse("1101 ---- 11-- ----");
+        ____XXXS__MMMXXX(opcode, ADDA, 0b111111111111, Word | Long, Adda)
 
-    // -(Ax),-(Ay)
-    opcode = parse("1101 ---1 --00 1---");
-    ____XXX_SS___XXX(opcode, ADDX, MODE_PD, Byte | Word | Long, AddxEa);
 
+        // ADDI
+        //
+        //       Syntax: ADDI #<data>,<ea>
+        //         Size: Byte, Word, Longword
+        //
+        //               -------------------------------------------------
+        // #<data>,<ea>  | 0 | 1 | 2 | 3 | 4 | 5 | 6 | 7 | 8 | 9 | A | B |
+        //               -------------------------------------------------
+        //                 X       X   X   X   X   X   X   X
+
+        opcode = parse("0000 0110 ---- ----");
+        ________SSMMMXXX(opcode, ADDI, 0b100000000000, Byte | Word | Long, AddiRg);
+        ________SSMMMXXX(opcode, ADDI, 0b001111111000, Byte | Word | Long, AddiEa);
 
-    // AND
-    //
-    //       Syntax: (1) AND <ea>,Dy
-    //               (2) AND Dx,<ea>
-    //         Size: Byte, Word, Longword
 
-    //               -------------------------------------------------
-    // <ea>,Dy       | 0 | 1 | 2 | 3 | 4 | 5 | 6 | 7 | 8 | 9 | A | B |
-    //               -------------------------------------------------
-    //                 X       X   X   X   X   X   X   X   X   X   X
+        // ADDQ
+        //
+        //       Syntax: ADDQ #<data>,<ea>
+        //         Size: Byte, Word, Longword
+        //
+        //               -------------------------------------------------
+        // #<data>,<ea>  | 0 | 1 | 2 | 3 | 4 | 5 | 6 | 7 | 8 | 9 | A | B |
+        //               -------------------------------------------------
+        //                 X  (X)  X   X   X   X   X   X   X
 
-    opcode = parse("1100 ---0 ---- ----");
-    ____XXX_SSMMMXXX(opcode, AND, 0b101111111111, Byte | Word | Long, AndEaRg);
+        opcode = parse("0101 ---0 ---- ----");
+        ____XXX_SSMMMXXX(opcode, ADDQ, 0b100000000000, Byte | Word | Long, AddqDn);
+        ____XXX_SSMMMXXX(opcode, ADDQ, 0b010000000000, Word | Long,        AddqAn);
+        ____XXX_SSMMMXXX(opcode, ADDQ, 0b001111111000, Byte | Word | Long, AddqEa);
 
-    //               -------------------------------------------------
-    // Dx,<ea>       | 0 | 1 | 2 | 3 | 4 | 5 | 6 | 7 | 8 | 9 | A | B |
-    //               -------------------------------------------------
-    //                         X   X   X   X   X   X   X
 
-    opcode = parse("1100 ---1 ---- ----");
-    ____XXX_SSMMMXXX(opcode, AND, 0b001111111000, Byte | Word | Long, AndRgEa);
+        // ADDX
+        //
+        //       Syntax: (1) ADDX Dx,Dy
+        //               (2) ADDX -(Ax),-(Ay)
+        //         Size: Byte, Word, Longword
 
+        // Dx,Dy
+        opcode = parse("1101 ---1 --00 0---");
+        ____XXX_SS___XXX(opcode, ADDX, MODE_DN, Byte | Word | Long, AddxRg);
 
-    // ANDI
-    //
-    //       Syntax: ANDI #<data>,<ea>
-    //         Size: Byte, Word, Longword
-    //
-    //               -------------------------------------------------
-    // #<data>,<ea>  | 0 | 1 | 2 | 3 | 4 | 5 | 6 | 7 | 8 | 9 | A | B |
-    //               -------------------------------------------------
-    //                 X       X   X   X   X   X   X   X
+        // -(Ax),-(Ay)
+        opcode = parse("1101 ---1 --00 1---");
+        ____XXX_SS___XXX(opcode, ADDX, MODE_PD, Byte | Word | Long, AddxEa);
 
-    opcode = parse("0000 0010 ---- ----");
-    ________SSMMMXXX(opcode, ANDI, 0b100000000000, Byte | Word | Long, AndiRg);
-    ________SSMMMXXX(opcode, ANDI, 0b001111111000, Byte | Word | Long, AndiEa);
 
+        // AND
+        //
+        //       Syntax: (1) AND <ea>,Dy
+        //               (2) AND Dx,<ea>
+        //         Size: Byte, Word, Longword
+
+        //               -------------------------------------------------
+        // <ea>,Dy       | 0 | 1 | 2 | 3 | 4 | 5 | 6 | 7 | 8 | 9 | A | B |
+        //               -------------------------------------------------
+        //                 X       X   X   X   X   X   X   X   X   X   X
 
-    // ANDI to CCR
-    //
-    //       Syntax: ANDI #<data>,CCR
-    //         Size: Byte
-    //
+        opcode = parse("1100 ---0 ---- ----");
+        ____XXX_SSMMMXXX(opcode, AND, 0b101111111111, Byte | Word | Long, AndEaRg);
 
-    bind(parse("0000 0010 0011 1100"), Andiccr, ANDICCR, MODE_IM, Byte);
+        //               -------------------------------------------------
+        // Dx,<ea>       | 0 | 1 | 2 | 3 | 4 | 5 | 6 | 7 | 8 | 9 | A | B |
+        //               -------------------------------------------------
+        //                         X   X   X   X   X   X   X
+
+        opcode = parse("1100 ---1 ---- ----");
+        ____XXX_SSMMMXXX(opcode, AND, 0b001111111000, Byte | Word | Long, AndRgEa);
 
 
-    // ANDI to SR
-    //
-    //       Syntax: ANDI #<data>,SR
-    //         Size: Byte
-    //
+        // ANDI
+        //
+        //       Syntax: ANDI #<data>,<ea>
+        //         Size: Byte, Word, Longword
+        //
+        //               -------------------------------------------------
+        // #<data>,<ea>  | 0 | 1 | 2 | 3 | 4 | 5 | 6 | 7 | 8 | 9 | A | B |
+        //               -------------------------------------------------
+        //                 X       X   X   X   X   X   X   X
+
+        opcode = parse("0000 0010 ---- ----");
+        ________SSMMMXXX(opcode, ANDI, 0b100000000000, Byte | Word | Long, AndiRg);
+        ________SSMMMXXX(opcode, ANDI, 0b001111111000, Byte | Word | Long, AndiEa);
 
-    bind(parse("0000 0010 0111 1100"), Andisr, ANDISR, MODE_IM, Word);
 
+        // ANDI to CCR
+        //
+        //       Syntax: ANDI #<data>,CCR
+        //         Size: Byte
+        //
+
+        bind(parse("0000 0010 0011 1100"), Andiccr, ANDICCR, MODE_IM, Byte);
 
-    // ASL, ASR
-    //
-    //       Syntax: (1) ASx Dx,Dy
-    //               (2) ASx #<data>,Dy
-    //               (3) ASx <ea>
-    //         Size: Byte, Word, Longword
 
-    // Dx,Dy
-    opcode = parse("1110 ---1 --10 0---");
-    ____XXX_SS___XXX(opcode, ASL, MODE_DN,  Byte | Word | Long, ShiftRg);
+        // ANDI to SR
+        //
+        //       Syntax: ANDI #<data>,SR
+        //         Size: Byte
+        //
 
-    opcode = parse("1110 ---0 --10 0---");
-    ____XXX_SS___XXX(opcode, ASR, MODE_DN,  Byte | Word | Long, ShiftRg);
+        bind(parse("0000 0010 0111 1100"), Andisr, ANDISR, MODE_IM, Word);
+
+
+        // ASL, ASR
+        //
+        //       Syntax: (1) ASx Dx,Dy
+        //               (2) ASx #<data>,Dy
+        //               (3) ASx <ea>
+        //         Size: Byte, Word, Longword
 
-    // #<data>,Dy
-    opcode = parse("1110 ---1 --00 0---");
-    ____XXX_SS___XXX(opcode, ASL, MODE_IM, Byte | Word | Long, ShiftIm);
+        // Dx,Dy
+        opcode = parse("1110 ---1 --10 0---");
+        ____XXX_SS___XXX(opcode, ASL, MODE_DN,  Byte | Word | Long, ShiftRg);
 
-    opcode = parse("1110 ---0 --00 0---");
-    ____XXX_SS___XXX(opcode, ASR, MODE_IM, Byte | Word | Long, ShiftIm);
+        opcode = parse("1110 ---0 --10 0---");
+        ____XXX_SS___XXX(opcode, ASR, MODE_DN,  Byte | Word | Long, ShiftRg);
 
-    //               -------------------------------------------------
-    // <ea>          | 0 | 1 | 2 | 3 | 4 | 5 | 6 | 7 | 8 | 9 | A | B |
-    //               -------------------------------------------------
-    //                         X   X   X   X   X   X   X
+        // #<data>,Dy
+        opcode = parse("1110 ---1 --00 0---");
+        ____XXX_SS___XXX(opcode, ASL, MODE_IM, Byte | Word | Long, ShiftIm);
 
-    opcode = parse("1110 0001 11-- ----");
-    __________MMMXXX(opcode, ASL, 0b001111111000, Word, ShiftEa);
+        opcode = parse("1110 ---0 --00 0---");
+        ____XXX_SS___XXX(opcode, ASR, MODE_IM, Byte | Word | Long, ShiftIm);
 
-    opcode = parse("1110 0000 11-- ----");
-    __________MMMXXX(opcode, ASR, 0b001111111000, Word, ShiftEa);
+        //               -------------------------------------------------
+        // <ea>          | 0 | 1 | 2 | 3 | 4 | 5 | 6 | 7 | 8 | 9 | A | B |
+        //               -------------------------------------------------
+        //                         X   X   X   X   X   X   X
 
+        opcode = parse("1110 0001 11-- ----");
+        __________MMMXXX(opcode, ASL, 0b001111111000, Word, ShiftEa);
 
-    // Bcc
-    //
-    //       Syntax: Bcc <label>
-    //         Size: Word
-
-    // Dn,<label>
-    opcode = parse("0110 ---- ---- ----");
-
-    bind(opcode | 0x000, Bcc, BRA, MODE_IP, Word);
-    bind(opcode | 0x200, Bcc, BHI, MODE_IP, Word);
-    bind(opcode | 0x300, Bcc, BLS, MODE_IP, Word);
-    bind(opcode | 0x400, Bcc, BCC, MODE_IP, Word);
-    bind(opcode | 0x500, Bcc, BCS, MODE_IP, Word);
-    bind(opcode | 0x600, Bcc, BNE, MODE_IP, Word);
-    bind(opcode | 0x700, Bcc, BEQ, MODE_IP, Word);
-    bind(opcode | 0x800, Bcc, BVC, MODE_IP, Word);
-    bind(opcode | 0x900, Bcc, BVS, MODE_IP, Word);
-    bind(opcode | 0xA00, Bcc, BPL, MODE_IP, Word);
-    bind(opcode | 0xB00, Bcc, BMI, MODE_IP, Word);
-    bind(opcode | 0xC00, Bcc, BGE, MODE_IP, Word);
-    bind(opcode | 0xD00, Bcc, BLT, MODE_IP, Word);
-    bind(opcode | 0xE00, Bcc, BGT, MODE_IP, Word);
-    bind(opcode | 0xF00, Bcc, BLE, MODE_IP, Word);
-
-    for (int i = 1; i <= 0xFF; i++) {
-        bind(opcode | 0x000 | i, Bcc, BRA, MODE_IP, Byte);
-        bind(opcode | 0x200 | i, Bcc, BHI, MODE_IP, Byte);
-        bind(opcode | 0x300 | i, Bcc, BLS, MODE_IP, Byte);
-        bind(opcode | 0x400 | i, Bcc, BCC, MODE_IP, Byte);
-        bind(opcode | 0x500 | i, Bcc, BCS, MODE_IP, Byte);
-        bind(opcode | 0x600 | i, Bcc, BNE, MODE_IP, Byte);
-        bind(opcode | 0x700 | i, Bcc, BEQ, MODE_IP, Byte);
-        bind(opcode | 0x800 | i, Bcc, BVC, MODE_IP, Byte);
-        bind(opcode | 0x900 | i, Bcc, BVS, MODE_IP, Byte);
-        bind(opcode | 0xA00 | i, Bcc, BPL, MODE_IP, Byte);
-        bind(opcode | 0xB00 | i, Bcc, BMI, MODE_IP, Byte);
-        bind(opcode | 0xC00 | i, Bcc, BGE, MODE_IP, Byte);
-        bind(opcode | 0xD00 | i, Bcc, BLT, MODE_IP, Byte);
-        bind(opcode | 0xE00 | i, Bcc, BGT, MODE_IP, Byte);
-        bind(opcode | 0xF00 | i, Bcc, BLE, MODE_IP, Byte);
+        opcode = parse("1110 0000 11-- ----");
+        __________MMMXXX(opcode, ASR, 0b001111111000, Word, ShiftEa);
     }
 
-
-    // BCHG, BCLR
-    //
-    //       Syntax: (1) BCxx Dn,<ea>
-    //               (2) BCxx #<data>,<ea>
-    //         Size: Byte, Longword
-
-    //               -------------------------------------------------
-    // Dx,<ea>       | 0 | 1 | 2 | 3 | 4 | 5 | 6 | 7 | 8 | 9 | A | B |
-    //               -------------------------------------------------
-    //                 X       X   X   X   X   X   X   X
-
-    opcode = parse("0000 ---1 01-- ----");
-    ____XXX___MMMXXX(opcode, BCHG, 0b101111111000, Long, BitDxEa);
-    opcode = parse("0000 ---1 10-- ----");
-    ____XXX___MMMXXX(opcode, BCLR, 0b101111111000, Long, BitDxEa);
-
-    //               -------------------------------------------------
-    // #<data>,<ea>  | 0 | 1 | 2 | 3 | 4 | 5 | 6 | 7 | 8 | 9 | A | B |
-    //               -------------------------------------------------
-    //                 X       X   X   X   X   X   X   X
-
-    opcode = parse("0000 1000 01-- ----");
-    __________MMMXXX(opcode, BCHG, 0b101111111000, Byte, BitImEa);
-    opcode = parse("0000 1000 10-- ----");
-    __________MMMXXX(opcode, BCLR, 0b101111111000, Byte, BitImEa);
-
-
-    // BSET
-    //
-    //       Syntax: (1) BSET Dx,<ea>
-    //               (2) BSET #<data>,<ea>
-    //         Size: Byte, Longword
-
-    //               -------------------------------------------------
-    // Dx,<ea>       | 0 | 1 | 2 | 3 | 4 | 5 | 6 | 7 | 8 | 9 | A | B |
-    //               -------------------------------------------------
-    //                 X       X   X   X   X   X   X   X
-
-    opcode = parse("0000 ---1 11-- ----");
-    ____XXX___MMMXXX(opcode, BSET, 0b101111111000, Long, BitDxEa);
-
-    //               -------------------------------------------------
-    // #<data>,<ea>  | 0 | 1 | 2 | 3 | 4 | 5 | 6 | 7 | 8 | 9 | A | B |
-    //               -------------------------------------------------
-    //                 X       X   X   X   X   X   X   X
-
-    opcode = parse("0000 1000 11-- ----");
-    __________MMMXXX(opcode, BSET, 0b101111111000, Byte, BitImEa);
-
-
-    // BSR
-    //
-    //       Syntax: (1) BSR <label>
-    //         Size: Byte, Word
-
-    opcode = parse("0110 0001 ---- ----");
-    bind(opcode, Bsr, BSR, MODE_IP, Word);
-    for (int i = 1; i < 0xFF; i++) {
-        bind(opcode | i, Bsr, BSR, MODE_IP, Byte);
+    if constexpr (G == 1) { // Bcc - BTST
+
+        // Bcc
+        //
+        //       Syntax: Bcc <label>
+        //         Size: Word
+
+        // Dn,<label>
+        opcode = parse("0110 ---- ---- ----");
+
+        bind(opcode | 0x000, Bcc, BRA, MODE_IP, Word);
+        bind(opcode | 0x200, Bcc, BHI, MODE_IP, Word);
+        bind(opcode | 0x300, Bcc, BLS, MODE_IP, Word);
+        bind(opcode | 0x400, Bcc, BCC, MODE_IP, Word);
+        bind(opcode | 0x500, Bcc, BCS, MODE_IP, Word);
+        bind(opcode | 0x600, Bcc, BNE, MODE_IP, Word);
+        bind(opcode | 0x700, Bcc, BEQ, MODE_IP, Word);
+        bind(opcode | 0x800, Bcc, BVC, MODE_IP, Word);
+        bind(opcode | 0x900, Bcc, BVS, MODE_IP, Word);
+        bind(opcode | 0xA00, Bcc, BPL, MODE_IP, Word);
+        bind(opcode | 0xB00, Bcc, BMI, MODE_IP, Word);
+        bind(opcode | 0xC00, Bcc, BGE, MODE_IP, Word);
+        bind(opcode | 0xD00, Bcc, BLT, MODE_IP, Word);
+        bind(opcode | 0xE00, Bcc, BGT, MODE_IP, Word);
+        bind(opcode | 0xF00, Bcc, BLE, MODE_IP, Word);
+
+        for (int i = 1; i <= 0xFF; i++) {
+            bind(opcode | 0x000 | i, Bcc, BRA, MODE_IP, Byte);
+            bind(opcode | 0x200 | i, Bcc, BHI, MODE_IP, Byte);
+            bind(opcode | 0x300 | i, Bcc, BLS, MODE_IP, Byte);
+            bind(opcode | 0x400 | i, Bcc, BCC, MODE_IP, Byte);
+            bind(opcode | 0x500 | i, Bcc, BCS, MODE_IP, Byte);
+            bind(opcode | 0x600 | i, Bcc, BNE, MODE_IP, Byte);
+            bind(opcode | 0x700 | i, Bcc, BEQ, MODE_IP, Byte);
+            bind(opcode | 0x800 | i, Bcc, BVC, MODE_IP, Byte);
+            bind(opcode | 0x900 | i, Bcc, BVS, MODE_IP, Byte);
+            bind(opcode | 0xA00 | i, Bcc, BPL, MODE_IP, Byte);
+            bind(opcode | 0xB00 | i, Bcc, BMI, MODE_IP, Byte);
+            bind(opcode | 0xC00 | i, Bcc, BGE, MODE_IP, Byte);
+            bind(opcode | 0xD00 | i, Bcc, BLT, MODE_IP, Byte);
+            bind(opcode | 0xE00 | i, Bcc, BGT, MODE_IP, Byte);
+            bind(opcode | 0xF00 | i, Bcc, BLE, MODE_IP, Byte);
+        }
+
+
+        // BCHG, BCLR
+        //
+        //       Syntax: (1) BCxx Dn,<ea>
+        //               (2) BCxx #<data>,<ea>
+        //         Size: Byte, Longword
+
+        //               -------------------------------------------------
+        // Dx,<ea>       | 0 | 1 | 2 | 3 | 4 | 5 | 6 | 7 | 8 | 9 | A | B |
+        //               -------------------------------------------------
+        //                 X       X   X   X   X   X   X   X
+
+        opcode = parse("0000 ---1 01-- ----");
+        ____XXX___MMMXXX(opcode, BCHG, 0b101111111000, Long, BitDxEa);
+        opcode = parse("0000 ---1 10-- ----");
+        ____XXX___MMMXXX(opcode, BCLR, 0b101111111000, Long, BitDxEa);
+
+        //               -------------------------------------------------
+        // #<data>,<ea>  | 0 | 1 | 2 | 3 | 4 | 5 | 6 | 7 | 8 | 9 | A | B |
+        //               -------------------------------------------------
+        //                 X       X   X   X   X   X   X   X
+
+        opcode = parse("0000 1000 01-- ----");
+        __________MMMXXX(opcode, BCHG, 0b101111111000, Byte, BitImEa);
+        opcode = parse("0000 1000 10-- ----");
+        __________MMMXXX(opcode, BCLR, 0b101111111000, Byte, BitImEa);
+
+
+        // BSET
+        //
+        //       Syntax: (1) BSET Dx,<ea>
+        //               (2) BSET #<data>,<ea>
+        //         Size: Byte, Longword
+
+        //               -------------------------------------------------
+        // Dx,<ea>       | 0 | 1 | 2 | 3 | 4 | 5 | 6 | 7 | 8 | 9 | A | B |
+        //               -------------------------------------------------
+        //                 X       X   X   X   X   X   X   X
+
+        opcode = parse("0000 ---1 11-- ----");
+        ____XXX___MMMXXX(opcode, BSET, 0b101111111000, Long, BitDxEa);
+
+        //               -------------------------------------------------
+        // #<data>,<ea>  | 0 | 1 | 2 | 3 | 4 | 5 | 6 | 7 | 8 | 9 | A | B |
+        //               -------------------------------------------------
+        //                 X       X   X   X   X   X   X   X
+
+        opcode = parse("0000 1000 11-- ----");
+        __________MMMXXX(opcode, BSET, 0b101111111000, Byte, BitImEa);
+
+
+        // BSR
+        //
+        //       Syntax: (1) BSR <label>
+        //         Size: Byte, Word
+
+        opcode = parse("0110 0001 ---- ----");
+        bind(opcode, Bsr, BSR, MODE_IP, Word);
+        for (int i = 1; i < 0xFF; i++) {
+            bind(opcode | i, Bsr, BSR, MODE_IP, Byte);
+        }
+        bind(opcode | 0xFF, Bsr, BSR, MODE_IP, Long);
+        // BTST
+        //
+        //       Syntax: (1) BTST Dx,<ea>
+        //               (2) BTST #<data>,<ea>
+        //         Size: Byte, Longword
+
+        //               -------------------------------------------------
+        // Dx,<ea>       | 0 | 1 | 2 | 3 | 4 | 5 | 6 | 7 | 8 | 9 | A | B |
+        //               -------------------------------------------------
+        //                 X       X   X   X   X   X   X   X   X   X   X?
+
+        opcode = parse("0000 ---1 00-- ----");
+        ____XXX___MMMXXX(opcode, BTST, 0b101111111111, Byte, BitDxEa);
+
+        //               -------------------------------------------------
+        // #<data>,<ea>  | 0 | 1 | 2 | 3 | 4 | 5 | 6 | 7 | 8 | 9 | A | B |
+        //               -------------------------------------------------
+        //                 X       X   X   X   X   X   X   X   X   X
+
+        opcode = parse("0000 1000 00-- ----");
+        __________MMMXXX(opcode, BTST, 0b101111111110, Byte, BitImEa);
     }
-    bind(opcode | 0xFF, Bsr, BSR, MODE_IP, Long);
-    // BTST
-    //
-    //       Syntax: (1) BTST Dx,<ea>
-    //               (2) BTST #<data>,<ea>
-    //         Size: Byte, Longword
-
-    //               -------------------------------------------------
-    // Dx,<ea>       | 0 | 1 | 2 | 3 | 4 | 5 | 6 | 7 | 8 | 9 | A | B |
-    //               -------------------------------------------------
-    //                 X       X   X   X   X   X   X   X   X   X   X?
-
-    opcode = parse("0000 ---1 00-- ----");
-    ____XXX___MMMXXX(opcode, BTST, 0b101111111111, Byte, BitDxEa);
-
-    //               -------------------------------------------------
-    // #<data>,<ea>  | 0 | 1 | 2 | 3 | 4 | 5 | 6 | 7 | 8 | 9 | A | B |
-    //               -------------------------------------------------
-    //                 X       X   X   X   X   X   X   X   X   X
-
-    opcode = parse("0000 1000 00-- ----");
-    __________MMMXXX(opcode, BTST, 0b101111111110, Byte, BitImEa);
-
-
-    // CHK
-    //
-    //       Syntax: CHK <ea>,Dy
-    //         Size: Word
-
-    //               -------------------------------------------------
-    // <ea>,Ay       | 0 | 1 | 2 | 3 | 4 | 5 | 6 | 7 | 8 | 9 | A | B |
-    //               -------------------------------------------------
-    //                 X       X   X   X   X   X   X   X   X   X   X?
-
-    opcode = parse("0100 ---1 10-- ----");
-    ____XXX___MMMXXX(opcode, CHK, 0b101111111111, Word, Chk);
-
-
-    // CLR
-    //
-    //       Syntax: CLR <ea>
-    //         Size: Byte, Word, Longword
-
-    //               -------------------------------------------------
-    // <ea>          | 0 | 1 | 2 | 3 | 4 | 5 | 6 | 7 | 8 | 9 | A | B |
-    //               -------------------------------------------------
-    //                 X       X   X   X   X   X   X   X
-
-    opcode = parse("0100 0010 ---- ----");
-    ________SSMMMXXX(opcode, CLR, 0b101111111000, Byte | Word | Long, Clr);
-
-
-    // CMP
-    //
-    //       Syntax: CMP <ea>,Dy
-    //         Size: Byte, Word, Longword
-
-    //               -------------------------------------------------
-    // <ea>,Dy       | 0 | 1 | 2 | 3 | 4 | 5 | 6 | 7 | 8 | 9 | A | B |
-    //               -------------------------------------------------
-    //                 X  (X)  X   X   X   X   X   X   X   X   X   X
-
-    opcode = parse("1011 ---0 ---- ----");
-    ____XXX_SSMMMXXX(opcode, CMP, 0b101111111111, Byte,        Cmp);
-    ____XXX_SSMMMXXX(opcode, CMP, 0b111111111111, Word | Long, Cmp);
-
-
-    // CMPA
-    //
-    //       Syntax: CMPA <ea>,Ay
-    //         Size: Byte, Word, Longword
-
-    //               -------------------------------------------------
-    // <ea>,Ay       | 0 | 1 | 2 | 3 | 4 | 5 | 6 | 7 | 8 | 9 | A | B |
-    //               -------------------------------------------------
-    //                 X   X   X   X   X   X   X   X   X   X   X   X
-
-    opcode = parse("1011 ---- 11-- ----");
-    ____XXXS__MMMXXX(opcode, CMPA, 0b111111111111, Word | Long, Cmpa);
-
-
-    // CMPI
-    //
-    //       Syntax: CMPI #<data>,<ea>
-    //         Size: Byte, Word, Longword
-    //
-    //               -------------------------------------------------
-    // #<data>,<ea>  | 0 | 1 | 2 | 3 | 4 | 5 | 6 | 7 | 8 | 9 | A | B |
-    //               -------------------------------------------------
-    //                 X       X   X   X   X   X   X   X
-
-    opcode = parse("0000 1100 ---- ----");
-    ________SSMMMXXX(opcode, CMPI, 0b100000000000, Byte | Word | Long, CmpiRg);
-    ________SSMMMXXX(opcode, CMPI, 0b001111111000, Byte | Word | Long, CmpiEa);
-
-
-    // CMPM
-    //
-    //       Syntax: (1) CMPM (Ax)+,(Ay)+
-    //         Size: Byte, Word, Longword
-
-    // (Ax)+,(Ay)+
-    opcode = parse("1011 ---1 --00 1---");
-    ____XXX_SS___XXX(opcode, CMPM, MODE_PI, Byte | Word | Long, Cmpm);
-
-
-    // DBcc
-    //
-    //       Syntax: DBcc Dn,<label>
-    //         Size: Word
-
-    // Dn,<label>
-    opcode = parse("0101 ---- 1100 1---");
-    _____________XXX(opcode | 0x000, DBT,  MODE_IP, Word, Dbcc);
-    _____________XXX(opcode | 0x100, DBF,  MODE_IP, Word, Dbcc);
-    _____________XXX(opcode | 0x200, DBHI, MODE_IP, Word, Dbcc);
-    _____________XXX(opcode | 0x300, DBLS, MODE_IP, Word, Dbcc);
-    _____________XXX(opcode | 0x400, DBCC, MODE_IP, Word, Dbcc);
-    _____________XXX(opcode | 0x500, DBCS, MODE_IP, Word, Dbcc);
-    _____________XXX(opcode | 0x600, DBNE, MODE_IP, Word, Dbcc);
-    _____________XXX(opcode | 0x700, DBEQ, MODE_IP, Word, Dbcc);
-    _____________XXX(opcode | 0x800, DBVC, MODE_IP, Word, Dbcc);
-    _____________XXX(opcode | 0x900, DBVS, MODE_IP, Word, Dbcc);
-    _____________XXX(opcode | 0xA00, DBPL, MODE_IP, Word, Dbcc);
-    _____________XXX(opcode | 0xB00, DBMI, MODE_IP, Word, Dbcc);
-    _____________XXX(opcode | 0xC00, DBGE, MODE_IP, Word, Dbcc);
-    _____________XXX(opcode | 0xD00, DBLT, MODE_IP, Word, Dbcc);
-    _____________XXX(opcode | 0xE00, DBGT, MODE_IP, Word, Dbcc);
-    _____________XXX(opcode | 0xF00, DBLE, MODE_IP, Word, Dbcc);
-
-
-    // DIVS, DIVU
-    //
-    //       Syntax: DIVx <ea>,Dy
-    //        Sizes: Longword, Word -> Longword
-
-    //               -------------------------------------------------
-    // <ea>,Dn       | 0 | 1 | 2 | 3 | 4 | 5 | 6 | 7 | 8 | 9 | A | B |
-    //               -------------------------------------------------
-    //                 X       X   X   X   X   X   X   X   X   X   X
-
-    opcode = parse("1000 ---1 11-- ----");
-    ____XXX___MMMXXX(opcode, DIVS, 0b101111111111, Word, Div);
-
-    opcode = parse("1000 ---0 11-- ----");
-    ____XXX___MMMXXX(opcode, DIVU, 0b101111111111, Word, Div);
-
 
-    // EOR
-    //
-    //       Syntax: EOR Dx,<ea>
-    //        Sizes: Byte, Word, Longword
-
-    //               -------------------------------------------------
-    // <ea>,Dn       | 0 | 1 | 2 | 3 | 4 | 5 | 6 | 7 | 8 | 9 | A | B |
-    //               -------------------------------------------------
-    //                 X       X   X   X   X   X   X   X
-
-    opcode = parse("1011 ---1 ---- ----");
-    ____XXX_SSMMMXXX(opcode, EOR, 0b101111111000, Byte | Word | Long, AndRgEa);
-
-
-    // EORI
-    //
-    //       Syntax: EORI #<data>,<ea>
-    //         Size: Byte, Word, Longword
-    //
-    //               -------------------------------------------------
-    // #<data>,<ea>  | 0 | 1 | 2 | 3 | 4 | 5 | 6 | 7 | 8 | 9 | A | B |
-    //               -------------------------------------------------
-    //                 X       X   X   X   X   X   X   X
-
-    opcode = parse("0000 1010 ---- ----");
-    ________SSMMMXXX(opcode, EORI, 0b100000000000, Byte | Word | Long, AndiRg);
-    ________SSMMMXXX(opcode, EORI, 0b001111111000, Byte | Word | Long, AndiEa);
-
-
-    // EORI to CCR
-    //
-    //       Syntax: EORI #<data>,CCR
-    //         Size: Byte
-    //
-
-    bind(parse("0000 1010 0011 1100"), Andiccr, EORICCR, MODE_IM, Byte);
-
-
-    // EORI to SR
-    //
-    //       Syntax: EORI #<data>,SR
-    //         Size: Byte
-    //
+    if constexpr (G == 2) { // CHK - CMPM
 
-    bind(parse("0000 1010 0111 1100"), Andisr, EORISR, MODE_IM, Word);
+        // CHK
+        //
+        //       Syntax: CHK <ea>,Dy
+        //         Size: Word
 
+        //               -------------------------------------------------
+        // <ea>,Ay       | 0 | 1 | 2 | 3 | 4 | 5 | 6 | 7 | 8 | 9 | A | B |
+        //               -------------------------------------------------
+        //                 X       X   X   X   X   X   X   X   X   X   X?
 
-    // EXG
-    //
-    //       Syntax: EXG Dx,Dy
-    //               EXG Ax,Dy
-    //               EXG Ax,Ay
-    //         Size: Longword
+        opcode = parse("0100 ---1 10-- ----");
+        ____XXX___MMMXXX(opcode, CHK, 0b101111111111, Word, Chk);
 
-    opcode = parse("1100 ---1 0100 0---");
-    ____XXX______XXX(opcode, EXG, MODE_IP, Long, ExgDxDy);
 
-    opcode = parse("1100 ---1 1000 1---");
-    ____XXX______XXX(opcode, EXG, MODE_IP, Long, ExgAxDy);
+        // CLR
+        //
+        //       Syntax: CLR <ea>
+        //         Size: Byte, Word, Longword
 
-    opcode = parse("1100 ---1 0100 1---");
-    ____XXX______XXX(opcode, EXG, MODE_IP, Long, ExgAxAy);
+        //               -------------------------------------------------
+        // <ea>          | 0 | 1 | 2 | 3 | 4 | 5 | 6 | 7 | 8 | 9 | A | B |
+        //               -------------------------------------------------
+        //                 X       X   X   X   X   X   X   X
 
+        opcode = parse("0100 0010 ---- ----");
+        ________SSMMMXXX(opcode, CLR, 0b101111111000, Byte | Word | Long, Clr);
 
-    // EXT
-    //
-    //       Syntax: EXT Dx
-    //        Sizes: Word, Longword
 
-    opcode = parse("0100 1000 --00 0---");
-    _____________XXX(opcode | 2 << 6, EXT, MODE_DN, Word, Ext);
-    _____________XXX(opcode | 3 << 6, EXT, MODE_DN, Long, Ext);
+        // CMP
+        //
+        //       Syntax: CMP <ea>,Dy
+        //         Size: Byte, Word, Longword
 
+        //               -------------------------------------------------
+        // <ea>,Dy       | 0 | 1 | 2 | 3 | 4 | 5 | 6 | 7 | 8 | 9 | A | B |
+        //               -------------------------------------------------
+        //                 X  (X)  X   X   X   X   X   X   X   X   X   X
 
-    // LINK
-    //
-    //       Syntax: LINK An,#<displacement>
-    //        Sizes: Word
+        opcode = parse("1011 ---0 ---- ----");
+        ____XXX_SSMMMXXX(opcode, CMP, 0b101111111111, Byte,        Cmp);
+        ____XXX_SSMMMXXX(opcode, CMP, 0b111111111111, Word | Long, Cmp);
 
-    opcode = parse("0100 1110 0101 0---");
-    _____________XXX(opcode, LINK, MODE_IP, Word, Link);
 
+        // CMPA
+        //
+        //       Syntax: CMPA <ea>,Ay
+        //         Size: Byte, Word, Longword
 
-    // JMP
-    //
-    //       Syntax: JMP <ea>
-    //        Sizes: Longword
+        //               -------------------------------------------------
+        // <ea>,Ay       | 0 | 1 | 2 | 3 | 4 | 5 | 6 | 7 | 8 | 9 | A | B |
+        //               -------------------------------------------------
+        //                 X   X   X   X   X   X   X   X   X   X   X   X
 
-    //               -------------------------------------------------
-    // <ea>          | 0 | 1 | 2 | 3 | 4 | 5 | 6 | 7 | 8 | 9 | A | B |
-    //               -------------------------------------------------
-    //                         X           X   X   X   X   X   X
+        opcode = parse("1011 ---- 11-- ----");
+        ____XXXS__MMMXXX(opcode, CMPA, 0b111111111111, Word | Long, Cmpa);
 
-     opcode = parse("0100 1110 11-- ----");
-     __________MMMXXX(opcode, JMP, 0b001001111110, Long, Jmp);
 
+        // CMPI
+        //
+        //       Syntax: CMPI #<data>,<ea>
+        //         Size: Byte, Word, Longword
+        //
+        //               -------------------------------------------------
+        // #<data>,<ea>  | 0 | 1 | 2 | 3 | 4 | 5 | 6 | 7 | 8 | 9 | A | B |
+        //               -------------------------------------------------
+        //                 X       X   X   X   X   X   X   X
 
-    // JSR
-    //
-    //       Syntax: JSR <ea>
-    //        Sizes: Longword
+        opcode = parse("0000 1100 ---- ----");
+        ________SSMMMXXX(opcode, CMPI, 0b100000000000, Byte | Word | Long, CmpiRg);
+        ________SSMMMXXX(opcode, CMPI, 0b001111111000, Byte | Word | Long, CmpiEa);
 
-    //               -------------------------------------------------
-    // <ea>          | 0 | 1 | 2 | 3 | 4 | 5 | 6 | 7 | 8 | 9 | A | B |
-    //               -------------------------------------------------
-    //                         X           X   X   X   X   X   X
 
-     opcode = parse("0100 1110 10-- ----");
-     __________MMMXXX(opcode, JSR, 0b001001111110, Long, Jsr);
+        // CMPM
+        //
+        //       Syntax: (1) CMPM (Ax)+,(Ay)+
+        //         Size: Byte, Word, Longword
 
+        // (Ax)+,(Ay)+
+        opcode = parse("1011 ---1 --00 1---");
+        ____XXX_SS___XXX(opcode, CMPM, MODE_PI, Byte | Word | Long, Cmpm);
+    }
 
-    // LEA
-    //
-    //       Syntax: LEA <ea>,Ay
-    //        Sizes: Longword
+    if constexpr (G == 3) { // DBcc
+
+        // DBcc
+        //
+        //       Syntax: DBcc Dn,<label>
+        //         Size: Word
+
+        // Dn,<label>
+        opcode = parse("0101 ---- 1100 1---");
+        _____________XXX(opcode | 0x000, DBT,  MODE_IP, Word, Dbcc);
+        _____________XXX(opcode | 0x100, DBF,  MODE_IP, Word, Dbcc);
+        _____________XXX(opcode | 0x200, DBHI, MODE_IP, Word, Dbcc);
+        _____________XXX(opcode | 0x300, DBLS, MODE_IP, Word, Dbcc);
+        _____________XXX(opcode | 0x400, DBCC, MODE_IP, Word, Dbcc);
+        _____________XXX(opcode | 0x500, DBCS, MODE_IP, Word, Dbcc);
+        _____________XXX(opcode | 0x600, DBNE, MODE_IP, Word, Dbcc);
+        _____________XXX(opcode | 0x700, DBEQ, MODE_IP, Word, Dbcc);
+        _____________XXX(opcode | 0x800, DBVC, MODE_IP, Word, Dbcc);
+        _____________XXX(opcode | 0x900, DBVS, MODE_IP, Word, Dbcc);
+        _____________XXX(opcode | 0xA00, DBPL, MODE_IP, Word, Dbcc);
+        _____________XXX(opcode | 0xB00, DBMI, MODE_IP, Word, Dbcc);
+        _____________XXX(opcode | 0xC00, DBGE, MODE_IP, Word, Dbcc);
+        _____________XXX(opcode | 0xD00, DBLT, MODE_IP, Word, Dbcc);
+        _____________XXX(opcode | 0xE00, DBGT, MODE_IP, Word, Dbcc);
+        _____________XXX(opcode | 0xF00, DBLE, MODE_IP, Word, Dbcc);
+    }
 
-    //               -------------------------------------------------
-    // <ea>,Ay       | 0 | 1 | 2 | 3 | 4 | 5 | 6 | 7 | 8 | 9 | A | B |
-    //               -------------------------------------------------
-    //                         X           X   X   X   X   X   X
+    if constexpr (G == 4) { // DIVS - LSR
 
-    opcode = parse("0100 ---1 11-- ----");
-    ____XXX___MMMXXX(opcode, LEA, 0b001001111110, Long, Lea);
+        // DIVS, DIVU
+        //
+        //       Syntax: DIVx <ea>,Dy
+        //        Sizes: Longword, Word -> Longword
 
+        //               -------------------------------------------------
+        // <ea>,Dn       | 0 | 1 | 2 | 3 | 4 | 5 | 6 | 7 | 8 | 9 | A | B |
+        //               -------------------------------------------------
+        //                 X       X   X   X   X   X   X   X   X   X   X
 
-    // LSL, LSR
-    //
-    //       Syntax: (1) LSx Dx,Dy
-    //               (2) LSx #<data>,Dy
-    //               (3) LSx <ea>
-    //        Sizes: Byte, Word, Longword
+        opcode = parse("1000 ---1 11-- ----");
+        ____XXX___MMMXXX(opcode, DIVS, 0b101111111111, Word, Div);
 
-    // Dx,Dy
-    opcode = parse("1110 ---1 --10 1---");
-     ____XXX_SS___XXX(opcode, LSL, MODE_DN, Byte | Word | Long, ShiftRg);
+        opcode = parse("1000 ---0 11-- ----");
+        ____XXX___MMMXXX(opcode, DIVU, 0b101111111111, Word, Div);
 
-    opcode = parse("1110 ---0 --10 1---");
-     ____XXX_SS___XXX(opcode, LSR, MODE_DN, Byte | Word | Long, ShiftRg);
 
-    // #<data>,Dy
-    opcode = parse("1110 ---1 --00 1---");
-    ____XXX_SS___XXX(opcode, LSL, MODE_IM, Byte | Word | Long, ShiftIm);
+        // EOR
+        //
+        //       Syntax: EOR Dx,<ea>
+        //        Sizes: Byte, Word, Longword
 
-    opcode = parse("1110 ---0 --00 1---");
-    ____XXX_SS___XXX(opcode, LSR, MODE_IM, Byte | Word | Long, ShiftIm);
+        //               -------------------------------------------------
+        // <ea>,Dn       | 0 | 1 | 2 | 3 | 4 | 5 | 6 | 7 | 8 | 9 | A | B |
+        //               -------------------------------------------------
+        //                 X       X   X   X   X   X   X   X
 
-    //               -------------------------------------------------
-    // <ea>          | 0 | 1 | 2 | 3 | 4 | 5 | 6 | 7 | 8 | 9 | A | B |
-    //               -------------------------------------------------
-    //                         X   X   X   X   X   X   X
+        opcode = parse("1011 ---1 ---- ----");
+        ____XXX_SSMMMXXX(opcode, EOR, 0b101111111000, Byte | Word | Long, AndRgEa);
 
-    opcode = parse("1110 0011 11-- ----");
-    __________MMMXXX(opcode, LSL, 0b001111111000, Word, ShiftEa);
 
-    opcode = parse("1110 0010 11-- ----");
-    __________MMMXXX(opcode, LSR, 0b001111111000, Word, ShiftEa);
+        // EORI
+        //
+        //       Syntax: EORI #<data>,<ea>
+        //         Size: Byte, Word, Longword
+        //
+        //               -------------------------------------------------
+        // #<data>,<ea>  | 0 | 1 | 2 | 3 | 4 | 5 | 6 | 7 | 8 | 9 | A | B |
+        //               -------------------------------------------------
+        //                 X       X   X   X   X   X   X   X
 
+        opcode = parse("0000 1010 ---- ----");
+        ________SSMMMXXX(opcode, EORI, 0b100000000000, Byte | Word | Long, AndiRg);
+        ________SSMMMXXX(opcode, EORI, 0b001111111000, Byte | Word | Long, AndiEa);
 
-    // MOVE
-    //
-    //       Syntax: MOVE <ea>,<e>
-    //        Sizes: Byte, Word, Longword
-
-    //               -------------------------------------------------
-    // <ea>          | 0 | 1 | 2 | 3 | 4 | 5 | 6 | 7 | 8 | 9 | A | B |
-    //               -------------------------------------------------
-    //                 X  (X)   X   X   X   X   X   X   X   X   X   X
-
-    //               -------------------------------------------------
-    // <e>           | 0 | 1 | 2 | 3 | 4 | 5 | 6 | 7 | 8 | 9 | A | B |
-    //               -------------------------------------------------
-    //                 X       X   X   X   X   X   X   X
-
-    // <ea>,Dy
-    opcode = parse("00-- ---0 00-- ----");
-    __SSXXX___MMMXXX(opcode, MOVE, 0b101111111111, Byte,        Move0);
-    __SSXXX___MMMXXX(opcode, MOVE, 0b111111111111, Word | Long, Move0);
-
-    // <ea>,(Ay)
-    opcode = parse("00-- ---0 10-- ----");
-    __SSXXX___MMMXXX(opcode, MOVE, 0b101111111111, Byte,        Move2);
-    __SSXXX___MMMXXX(opcode, MOVE, 0b111111111111, Word | Long, Move2);
-
-    // <ea>,(Ay)+
-    opcode = parse("00-- ---0 11-- ----");
-    __SSXXX___MMMXXX(opcode, MOVE, 0b101111111111, Byte,        Move3);
-    __SSXXX___MMMXXX(opcode, MOVE, 0b111111111111, Word | Long, Move3);
-
-    // <ea>,-(Ay)
-    opcode = parse("00-- ---1 00-- ----");
-    __SSXXX___MMMXXX(opcode, MOVE, 0b101111111111, Byte,        Move4);
-    __SSXXX___MMMXXX(opcode, MOVE, 0b111111111111, Word | Long, Move4);
-
-    // <ea>,(d,Ay)
-    opcode = parse("00-- ---1 01-- ----");
-    __SSXXX___MMMXXX(opcode, MOVE, 0b101111111111, Byte,        Move5);
-    __SSXXX___MMMXXX(opcode, MOVE, 0b111111111111, Word | Long, Move5);
-
-    // <ea>,(d,Ay,Xi)
-     opcode = parse("00-- ---1 10-- ----");
-     __SSXXX___MMMXXX(opcode, MOVE, 0b101111111111, Byte,        Move6);
-     __SSXXX___MMMXXX(opcode, MOVE, 0b111111111111, Word | Long, Move6);
-
-    // <ea>,ABS.w
-    opcode = parse("00-- 0001 11-- ----");
-    __SS______MMMXXX(opcode, MOVE, 0b101111111111, Byte,        Move7);
-    __SS______MMMXXX(opcode, MOVE, 0b111111111111, Word | Long, Move7);
-
-    // <ea>,ABS.l
-    opcode = parse("00-- 0011 11-- ----");
-    __SS______MMMXXX(opcode, MOVE, 0b101111111111, Byte,        Move8);
-    __SS______MMMXXX(opcode, MOVE, 0b111111111111, Word | Long, Move8);
-
-
-    // MOVEA
-    //
-    //       Syntax: MOVEA <ea>,Ay
-    //        Sizes: Word, Longword
 
-    //               -------------------------------------------------
-    // <ea>,Ay       | 0 | 1 | 2 | 3 | 4 | 5 | 6 | 7 | 8 | 9 | A | B |
-    //               -------------------------------------------------
-    //                 X   X   X   X   X   X   X   X   X   X   X   X
+        // EORI to CCR
+        //
+        //       Syntax: EORI #<data>,CCR
+        //         Size: Byte
+        //
 
-    opcode = parse("001- ---0 01-- ----");
+        bind(parse("0000 1010 0011 1100"), Andiccr, EORICCR, MODE_IM, Byte);
 
-    ____XXX___MMMXXX(opcode | 0 << 12, MOVEA, 0b111111111111, Long, Movea)
-    ____XXX___MMMXXX(opcode | 1 << 12, MOVEA, 0b111111111111, Word, Movea)
 
+        // EORI to SR
+        //
+        //       Syntax: EORI #<data>,SR
+        //         Size: Byte
+        //
 
-    // MOVEM
-    //
-    //       Syntax: MOVEM <ea>,<register list>
-    //               MOVEM <register list>,<ea>
-    //        Sizes: Word, Longword
+        bind(parse("0000 1010 0111 1100"), Andisr, EORISR, MODE_IM, Word);
 
-    //               -------------------------------------------------
-    // <ea>,<list>   | 0 | 1 | 2 | 3 | 4 | 5 | 6 | 7 | 8 | 9 | A | B |
-    //               -------------------------------------------------
-    //                         X   X       X   X   X   X   X   X
 
-    //               -------------------------------------------------
-    // <list>,<ea>   | 0 | 1 | 2 | 3 | 4 | 5 | 6 | 7 | 8 | 9 | A | B |
-    //               -------------------------------------------------
-    //                         X       X   X   X   X   X
+        // EXG
+        //
+        //       Syntax: EXG Dx,Dy
+        //               EXG Ax,Dy
+        //               EXG Ax,Ay
+        //         Size: Longword
 
-    opcode = parse("0100 1100 1--- ----");
-    __________MMMXXX(opcode | 0 << 6, MOVEM, 0b001101111110, Word, MovemEaRg);
-    __________MMMXXX(opcode | 1 << 6, MOVEM, 0b001101111110, Long, MovemEaRg);
+        opcode = parse("1100 ---1 0100 0---");
+        ____XXX______XXX(opcode, EXG, MODE_IP, Long, ExgDxDy);
 
-    opcode = parse("0100 1000 1--- ----");
-    __________MMMXXX(opcode | 0 << 6, MOVEM, 0b001011111000, Word, MovemRgEa);
-    __________MMMXXX(opcode | 1 << 6, MOVEM, 0b001011111000, Long, MovemRgEa);
+        opcode = parse("1100 ---1 1000 1---");
+        ____XXX______XXX(opcode, EXG, MODE_IP, Long, ExgAxDy);
 
+        opcode = parse("1100 ---1 0100 1---");
+        ____XXX______XXX(opcode, EXG, MODE_IP, Long, ExgAxAy);
 
-    // MOVEP
-    //
-    //       Syntax: MOVEP Dx,(d,Ay)
-    //               MOVEP (d,Ay),Dx
-    //         Size: Word, Longword
 
-    // MOVEP Dx,(d,Ay)
-    opcode = parse("0000 ---1 1-00 1---");
-    ____XXX______XXX(opcode | 0 << 6, MOVEP, MODE_DI, Word, MovepDxEa);
-    ____XXX______XXX(opcode | 1 << 6, MOVEP, MODE_DI, Long, MovepDxEa);
+        // EXT
+        //
+        //       Syntax: EXT Dx
+        //        Sizes: Word, Longword
 
-    // MOVEP (d,Ay),Dx
-    opcode = parse("0000 ---1 0-00 1---");
-    ____XXX______XXX(opcode | 0 << 6, MOVEP, MODE_DI, Word, MovepEaDx);
-    ____XXX______XXX(opcode | 1 << 6, MOVEP, MODE_DI, Long, MovepEaDx);
+        opcode = parse("0100 1000 --00 0---");
+        _____________XXX(opcode | 2 << 6, EXT, MODE_DN, Word, Ext);
+        _____________XXX(opcode | 3 << 6, EXT, MODE_DN, Long, Ext);
 
 
-    // MOVEQ
-    //
-    //       Syntax: MOVEQ #<data>,Dn
-    //        Sizes: Longword
+        // LINK
+        //
+        //       Syntax: LINK An,#<displacement>
+        //        Sizes: Word
 
-    // #<data>,Dn
-    opcode = parse("0111 ---0 ---- ----");
-    ____XXX_XXXXXXXX(opcode, MOVEQ, MODE_IM, Long, Moveq);
+        opcode = parse("0100 1110 0101 0---");
+        _____________XXX(opcode, LINK, MODE_IP, Word, Link);
 
 
-    // MOVE to CCR
-    //
-    //       Syntax: MOVE <ea>,CCR
-    //         Size: Word
-    //
-    //               -------------------------------------------------
-    // #<data>,<ea>  | 0 | 1 | 2 | 3 | 4 | 5 | 6 | 7 | 8 | 9 | A | B |
-    //               -------------------------------------------------
-    //                 X       X   X   X   X   X   X   X   X   X   X
+        // JMP
+        //
+        //       Syntax: JMP <ea>
+        //        Sizes: Longword
 
-    opcode = parse("0100 0100 11-- ----");
-    __________MMMXXX(opcode, MOVETSR, 0b101111111111, Word, MoveToCcr);
+        //               -------------------------------------------------
+        // <ea>          | 0 | 1 | 2 | 3 | 4 | 5 | 6 | 7 | 8 | 9 | A | B |
+        //               -------------------------------------------------
+        //                         X           X   X   X   X   X   X
 
+         opcode = parse("0100 1110 11-- ----");
+         __________MMMXXX(opcode, JMP, 0b001001111110, Long, Jmp);
 
-    // MOVE from SR
-    //
-    //       Syntax: MOVE SR,<ea>
-    //         Size: Word
-    //
-    //               -------------------------------------------------
-    // #<data>,<ea>  | 0 | 1 | 2 | 3 | 4 | 5 | 6 | 7 | 8 | 9 | A | B |
-    //               -------------------------------------------------
-    //                 X       X   X   X   X   X   X   X
 
-    opcode = parse("0100 0000 11-- ----");
-    __________MMMXXX(opcode, MOVEFSR, 0b100000000000, Word, MoveFromSrRg);
-    __________MMMXXX(opcode, MOVEFSR, 0b001111111000, Word, MoveFromSrEa);
+        // JSR
+        //
+        //       Syntax: JSR <ea>
+        //        Sizes: Longword
 
+        //               -------------------------------------------------
+        // <ea>          | 0 | 1 | 2 | 3 | 4 | 5 | 6 | 7 | 8 | 9 | A | B |
+        //               -------------------------------------------------
+        //                         X           X   X   X   X   X   X
 
-    // MOVE to SR
-    //
-    //       Syntax: MOVE <ea>,SR
-    //         Size: Word
-    //
-    //               -------------------------------------------------
-    // #<data>,<ea>  | 0 | 1 | 2 | 3 | 4 | 5 | 6 | 7 | 8 | 9 | A | B |
-    //               -------------------------------------------------
-    //                 X       X   X   X   X   X   X   X   X   X   X
+         opcode = parse("0100 1110 10-- ----");
+         __________MMMXXX(opcode, JSR, 0b001001111110, Long, Jsr);
 
-    opcode = parse("0100 0110 11-- ----");
-    __________MMMXXX(opcode, MOVETSR, 0b101111111111, Word, MoveToSr);
 
+        // LEA
+        //
+        //       Syntax: LEA <ea>,Ay
+        //        Sizes: Longword
 
-    // MOVEUSP
-    //
-    //       Syntax: MOVE USP,An
-    //               MOVE An,USP
-    //        Sizes: Longword
+        //               -------------------------------------------------
+        // <ea>,Ay       | 0 | 1 | 2 | 3 | 4 | 5 | 6 | 7 | 8 | 9 | A | B |
+        //               -------------------------------------------------
+        //                         X           X   X   X   X   X   X
 
-    opcode = parse("0100 1110 0110 ----");
-    _____________XXX(opcode | 1 << 3, MOVEUSP, MODE_IP, Long, MoveUspAn);
-    _____________XXX(opcode | 0 << 3, MOVEUSP, MODE_IP, Long, MoveAnUsp);
+        opcode = parse("0100 ---1 11-- ----");
+        ____XXX___MMMXXX(opcode, LEA, 0b001001111110, Long, Lea);
 
 
-    // MULS, MULU
-    //
-    //       Syntax: MULx <ea>,Dy
-    //        Sizes: Word x Word -> Longword
+        // LSL, LSR
+        //
+        //       Syntax: (1) LSx Dx,Dy
+        //               (2) LSx #<data>,Dy
+        //               (3) LSx <ea>
+        //        Sizes: Byte, Word, Longword
 
-    //               -------------------------------------------------
-    // <ea>,Dy       | 0 | 1 | 2 | 3 | 4 | 5 | 6 | 7 | 8 | 9 | A | B |
-    //               -------------------------------------------------
-    //                 X       X   X   X   X   X   X   X   X   X   X
+        // Dx,Dy
+        opcode = parse("1110 ---1 --10 1---");
+         ____XXX_SS___XXX(opcode, LSL, MODE_DN, Byte | Word | Long, ShiftRg);
 
-    opcode = parse("1100 ---1 11-- ----");
-    ____XXX___MMMXXX(opcode, MULS, 0b101111111111, Word, Mul);
+        opcode = parse("1110 ---0 --10 1---");
+         ____XXX_SS___XXX(opcode, LSR, MODE_DN, Byte | Word | Long, ShiftRg);
 
-    opcode = parse("1100 ---0 11-- ----");
-    ____XXX___MMMXXX(opcode, MULU, 0b101111111111, Word, Mul);
+        // #<data>,Dy
+        opcode = parse("1110 ---1 --00 1---");
+        ____XXX_SS___XXX(opcode, LSL, MODE_IM, Byte | Word | Long, ShiftIm);
 
+        opcode = parse("1110 ---0 --00 1---");
+        ____XXX_SS___XXX(opcode, LSR, MODE_IM, Byte | Word | Long, ShiftIm);
 
-    // NBCD
-    //
-    //       Syntax: NBCD <ea>
-    //        Sizes: Byte
+        //               -------------------------------------------------
+        // <ea>          | 0 | 1 | 2 | 3 | 4 | 5 | 6 | 7 | 8 | 9 | A | B |
+        //               -------------------------------------------------
+        //                         X   X   X   X   X   X   X
 
-    //               -------------------------------------------------
-    // <ea>          | 0 | 1 | 2 | 3 | 4 | 5 | 6 | 7 | 8 | 9 | A | B |
-    //               -------------------------------------------------
-    //                 X       X   X   X   X   X   X   X
+        opcode = parse("1110 0011 11-- ----");
+        __________MMMXXX(opcode, LSL, 0b001111111000, Word, ShiftEa);
 
-    opcode = parse("0100 1000 00-- ----");
-    __________MMMXXX(opcode, NBCD, 0b101111111000, Byte, Nbcd);
+        opcode = parse("1110 0010 11-- ----");
+        __________MMMXXX(opcode, LSR, 0b001111111000, Word, ShiftEa);
+    }
 
+    if constexpr (G == 5) { // MOVE - MOVEUSP
 
-    // NEG, NEGX, NOT
-    //
-    //       Syntax: Nxx <ea>
-    //        Sizes: Byte, Word, Longword
+        // MOVE
+        //
+        //       Syntax: MOVE <ea>,<e>
+        //        Sizes: Byte, Word, Longword
+
+        //               -------------------------------------------------
+        // <ea>          | 0 | 1 | 2 | 3 | 4 | 5 | 6 | 7 | 8 | 9 | A | B |
+        //               -------------------------------------------------
+        //                 X  (X)   X   X   X   X   X   X   X   X   X   X
+
+        //               -------------------------------------------------
+        // <e>           | 0 | 1 | 2 | 3 | 4 | 5 | 6 | 7 | 8 | 9 | A | B |
+        //               -------------------------------------------------
+        //                 X       X   X   X   X   X   X   X
 
-    //               -------------------------------------------------
-    // <ea>          | 0 | 1 | 2 | 3 | 4 | 5 | 6 | 7 | 8 | 9 | A | B |
-    //               -------------------------------------------------
-    //                 X       X   X   X   X   X   X   X
+        // <ea>,Dy
+        opcode = parse("00-- ---0 00-- ----");
+        __SSXXX___MMMXXX(opcode, MOVE, 0b101111111111, Byte,        Move0);
+        __SSXXX___MMMXXX(opcode, MOVE, 0b111111111111, Word | Long, Move0);
 
-    opcode = parse("0100 0100 ---- ----");
-    ________SSMMMXXX(opcode, NEG, 0b100000000000, Byte | Word | Long, NegRg);
-    ________SSMMMXXX(opcode, NEG, 0b001111111000, Byte | Word | Long, NegEa);
+        // <ea>,(Ay)
+        opcode = parse("00-- ---0 10-- ----");
+        __SSXXX___MMMXXX(opcode, MOVE, 0b101111111111, Byte,        Move2);
+        __SSXXX___MMMXXX(opcode, MOVE, 0b111111111111, Word | Long, Move2);
 
-    opcode = parse("0100 0000 ---- ----");
-    ________SSMMMXXX(opcode, NEGX, 0b100000000000, Byte | Word | Long, NegRg);
-    ________SSMMMXXX(opcode, NEGX, 0b001111111000, Byte | Word | Long, NegEa);
+        // <ea>,(Ay)+
+        opcode = parse("00-- ---0 11-- ----");
+        __SSXXX___MMMXXX(opcode, MOVE, 0b101111111111, Byte,        Move3);
+        __SSXXX___MMMXXX(opcode, MOVE, 0b111111111111, Word | Long, Move3);
+
+        // <ea>,-(Ay)
+        opcode = parse("00-- ---1 00-- ----");
+        __SSXXX___MMMXXX(opcode, MOVE, 0b101111111111, Byte,        Move4);
+        __SSXXX___MMMXXX(opcode, MOVE, 0b111111111111, Word | Long, Move4);
+
+        // <ea>,(d,Ay)
+        opcode = parse("00-- ---1 01-- ----");
+        __SSXXX___MMMXXX(opcode, MOVE, 0b101111111111, Byte,        Move5);
+        __SSXXX___MMMXXX(opcode, MOVE, 0b111111111111, Word | Long, Move5);
 
-    opcode = parse("0100 0110 ---- ----");
-    ________SSMMMXXX(opcode, NOT, 0b100000000000, Byte | Word | Long, NegRg);
-    ________SSMMMXXX(opcode, NOT, 0b001111111000, Byte | Word | Long, NegEa);
+        // <ea>,(d,Ay,Xi)
+         opcode = parse("00-- ---1 10-- ----");
+         __SSXXX___MMMXXX(opcode, MOVE, 0b101111111111, Byte,        Move6);
+         __SSXXX___MMMXXX(opcode, MOVE, 0b111111111111, Word | Long, Move6);
+
+        // <ea>,ABS.w
+        opcode = parse("00-- 0001 11-- ----");
+        __SS______MMMXXX(opcode, MOVE, 0b101111111111, Byte,        Move7);
+        __SS______MMMXXX(opcode, MOVE, 0b111111111111, Word | Long, Move7);
+
+        // <ea>,ABS.l
+        opcode = parse("00-- 0011 11-- ----");
+        __SS______MMMXXX(opcode, MOVE, 0b101111111111, Byte,        Move8);
+        __SS______MMMXXX(opcode, MOVE, 0b111111111111, Word | Long, Move8);
+
+
+        // MOVEA
+        //
+        //       Syntax: MOVEA <ea>,Ay
+        //        Sizes: Word, Longword
+
+        //               -------------------------------------------------
+        // <ea>,Ay       | 0 | 1 | 2 | 3 | 4 | 5 | 6 | 7 | 8 | 9 | A | B |
+        //               -------------------------------------------------
+        //                 X   X   X   X   X   X   X   X   X   X   X   X
+
+        opcode = parse("001- ---0 01-- ----");
+
+        ____XXX___MMMXXX(opcode | 0 << 12, MOVEA, 0b111111111111, Long, Movea)
+        ____XXX___MMMXXX(opcode | 1 << 12, MOVEA, 0b111111111111, Word, Movea)
+
+
+        // MOVEM
+        //
+        //       Syntax: MOVEM <ea>,<register list>
+        //               MOVEM <register list>,<ea>
+        //        Sizes: Word, Longword
+
+        //               -------------------------------------------------
+        // <ea>,<list>   | 0 | 1 | 2 | 3 | 4 | 5 | 6 | 7 | 8 | 9 | A | B |
+        //               -------------------------------------------------
+        //                         X   X       X   X   X   X   X   X
+
+        //               -------------------------------------------------
+        // <list>,<ea>   | 0 | 1 | 2 | 3 | 4 | 5 | 6 | 7 | 8 | 9 | A | B |
+        //               -------------------------------------------------
+        //                         X       X   X   X   X   X
+
+        opcode = parse("0100 1100 1--- ----");
+        __________MMMXXX(opcode | 0 << 6, MOVEM, 0b001101111110, Word, MovemEaRg);
+        __________MMMXXX(opcode | 1 << 6, MOVEM, 0b001101111110, Long, MovemEaRg);
+
+        opcode = parse("0100 1000 1--- ----");
+        __________MMMXXX(opcode | 0 << 6, MOVEM, 0b001011111000, Word, MovemRgEa);
+        __________MMMXXX(opcode | 1 << 6, MOVEM, 0b001011111000, Long, MovemRgEa);
+
+
+        // MOVEP
+        //
+        //       Syntax: MOVEP Dx,(d,Ay)
+        //               MOVEP (d,Ay),Dx
+        //         Size: Word, Longword
+
+        // MOVEP Dx,(d,Ay)
+        opcode = parse("0000 ---1 1-00 1---");
+        ____XXX______XXX(opcode | 0 << 6, MOVEP, MODE_DI, Word, MovepDxEa);
+        ____XXX______XXX(opcode | 1 << 6, MOVEP, MODE_DI, Long, MovepDxEa);
+
+        // MOVEP (d,Ay),Dx
+        opcode = parse("0000 ---1 0-00 1---");
+        ____XXX______XXX(opcode | 0 << 6, MOVEP, MODE_DI, Word, MovepEaDx);
+        ____XXX______XXX(opcode | 1 << 6, MOVEP, MODE_DI, Long, MovepEaDx);
+
+
+        // MOVEQ
+        //
+        //       Syntax: MOVEQ #<data>,Dn
+        //        Sizes: Longword
+
+        // #<data>,Dn
+        opcode = parse("0111 ---0 ---- ----");
+        ____XXX_XXXXXXXX(opcode, MOVEQ, MODE_IM, Long, Moveq);
+
+
+        // MOVE to CCR
+        //
+        //       Syntax: MOVE <ea>,CCR
+        //         Size: Word
+        //
+        //               -------------------------------------------------
+        // #<data>,<ea>  | 0 | 1 | 2 | 3 | 4 | 5 | 6 | 7 | 8 | 9 | A | B |
+        //               -------------------------------------------------
+        //                 X       X   X   X   X   X   X   X   X   X   X
+
+        opcode = parse("0100 0100 11-- ----");
+        __________MMMXXX(opcode, MOVETSR, 0b101111111111, Word, MoveToCcr);
+
+
+        // MOVE from SR
+        //
+        //       Syntax: MOVE SR,<ea>
+        //         Size: Word
+        //
+        //               -------------------------------------------------
+        // #<data>,<ea>  | 0 | 1 | 2 | 3 | 4 | 5 | 6 | 7 | 8 | 9 | A | B |
+        //               -------------------------------------------------
+        //                 X       X   X   X   X   X   X   X
+
+        opcode = parse("0100 0000 11-- ----");
+        __________MMMXXX(opcode, MOVEFSR, 0b100000000000, Word, MoveFromSrRg);
+        __________MMMXXX(opcode, MOVEFSR, 0b001111111000, Word, MoveFromSrEa);
+
+
+        // MOVE to SR
+        //
+        //       Syntax: MOVE <ea>,SR
+        //         Size: Word
+        //
+        //               -------------------------------------------------
+        // #<data>,<ea>  | 0 | 1 | 2 | 3 | 4 | 5 | 6 | 7 | 8 | 9 | A | B |
+        //               -------------------------------------------------
+        //                 X       X   X   X   X   X   X   X   X   X   X
+
+        opcode = parse("0100 0110 11-- ----");
+        __________MMMXXX(opcode, MOVETSR, 0b101111111111, Word, MoveToSr);
 
 
-    // NOP
-    //
-    //       Syntax: NOP
-    //        Sizes: Unsized
+        // MOVEUSP
+        //
+        //       Syntax: MOVE USP,An
+        //               MOVE An,USP
+        //        Sizes: Longword
+
+        opcode = parse("0100 1110 0110 ----");
+        _____________XXX(opcode | 1 << 3, MOVEUSP, MODE_IP, Long, MoveUspAn);
+        _____________XXX(opcode | 0 << 3, MOVEUSP, MODE_IP, Long, MoveAnUsp);
+    }
+
+    if constexpr (G == 6) { // MULS - RTS
 
-    opcode = parse("0100 1110 0111 0001");
-    bind(opcode, Nop, NOP, MODE_IP, Long);
+        // MULS, MULU
+        //
+        //       Syntax: MULx <ea>,Dy
+        //        Sizes: Word x Word -> Longword
 
+        //               -------------------------------------------------
+        // <ea>,Dy       | 0 | 1 | 2 | 3 | 4 | 5 | 6 | 7 | 8 | 9 | A | B |
+        //               -------------------------------------------------
+        //                 X       X   X   X   X   X   X   X   X   X   X
 
-    // OR
-    //
-    //       Syntax: OR <ea>,Dy
-    //               OR Dx,<ea>
-    //        Sizes: Byte, Word, Longword
+        opcode = parse("1100 ---1 11-- ----");
+        ____XXX___MMMXXX(opcode, MULS, 0b101111111111, Word, Mul);
 
-    //               -------------------------------------------------
-    // <ea>,Dy       | 0 | 1 | 2 | 3 | 4 | 5 | 6 | 7 | 8 | 9 | A | B |
-    //               -------------------------------------------------
-    //                 X       X   X   X   X   X   X   X   X   X   X
+        opcode = parse("1100 ---0 11-- ----");
+        ____XXX___MMMXXX(opcode, MULU, 0b101111111111, Word, Mul);
 
-     opcode = parse("1000 ---0 ---- ----");
-    ____XXX_SSMMMXXX(opcode, OR, 0b101111111111, Byte | Word | Long, AndEaRg);
 
-    //               -------------------------------------------------
-    // Dx,<ea>       | 0 | 1 | 2 | 3 | 4 | 5 | 6 | 7 | 8 | 9 | A | B |
-    //               -------------------------------------------------
-    //                 X       X   X   X   X   X   X   X   X   X   X
+        // NBCD
+        //
+        //       Syntax: NBCD <ea>
+        //        Sizes: Byte
 
-    opcode = parse("1000 ---1 ---- ----");
-    ____XXX_SSMMMXXX(opcode, OR, 0b001111111000, Byte | Word | Long, AndRgEa);
+        //               -------------------------------------------------
+        // <ea>          | 0 | 1 | 2 | 3 | 4 | 5 | 6 | 7 | 8 | 9 | A | B |
+        //               -------------------------------------------------
+        //                 X       X   X   X   X   X   X   X
 
+        opcode = parse("0100 1000 00-- ----");
+        __________MMMXXX(opcode, NBCD, 0b101111111000, Byte, Nbcd);
 
-    // ORI
-    //
-    //       Syntax: ORI #<data>,<ea>
-    //         Size: Byte, Word, Longword
-    //
-    //               -------------------------------------------------
-    // #<data>,<ea>  | 0 | 1 | 2 | 3 | 4 | 5 | 6 | 7 | 8 | 9 | A | B |
-    //               -------------------------------------------------
-    //                 X       X   X   X   X   X   X   X
 
-    opcode = parse("0000 0000 ---- ----");
-    ________SSMMMXXX(opcode, ORI, 0b100000000000, Byte | Word | Long, AndiRg);
-    ________SSMMMXXX(opcode, ORI, 0b001111111000, Byte | Word | Long, AndiEa);
+        // NEG, NEGX, NOT
+        //
+        //       Syntax: Nxx <ea>
+        //        Sizes: Byte, Word, Longword
 
+        //               -------------------------------------------------
+        // <ea>          | 0 | 1 | 2 | 3 | 4 | 5 | 6 | 7 | 8 | 9 | A | B |
+        //               -------------------------------------------------
+        //                 X       X   X   X   X   X   X   X
 
-    // ORI to CCR
-    //
-    //       Syntax: ORI #<data>,CCR
-    //         Size: Byte
-    //
+        opcode = parse("0100 0100 ---- ----");
+        ________SSMMMXXX(opcode, NEG, 0b100000000000, Byte | Word | Long, NegRg);
+        ________SSMMMXXX(opcode, NEG, 0b001111111000, Byte | Word | Long, NegEa);
 
-    bind(parse("0000 0000 0011 1100"), Andiccr, ORICCR, MODE_IM, Byte);
+        opcode = parse("0100 0000 ---- ----");
+        ________SSMMMXXX(opcode, NEGX, 0b100000000000, Byte | Word | Long, NegRg);
+        ________SSMMMXXX(opcode, NEGX, 0b001111111000, Byte | Word | Long, NegEa);
 
+        opcode = parse("0100 0110 ---- ----");
+        ________SSMMMXXX(opcode, NOT, 0b100000000000, Byte | Word | Long, NegRg);
+        ________SSMMMXXX(opcode, NOT, 0b001111111000, Byte | Word | Long, NegEa);
 
-    // ORI to SR
-    //
-    //       Syntax: ORI #<data>,SR
-    //         Size: Byte
-    //
 
-    bind(parse("0000 0000 0111 1100"), Andisr, ORISR, MODE_IM, Word);
+        // NOP
+        //
+        //       Syntax: NOP
+        //        Sizes: Unsized
 
+        opcode = parse("0100 1110 0111 0001");
+        bind(opcode, Nop, NOP, MODE_IP, Long);
 
-    // ROL, ROR, ROXL, ROXR
-    //
-    //       Syntax: (1) ROxx Dx,Dy
-    //               (2) ROxx #<data>,Dy
-    //               (3) ROxx <ea>
-    //        Sizes: Byte, Word, Longword
 
-    // Dx,Dy
-    opcode = parse("1110 ---1 --11 1---");
-    ____XXX_SS___XXX(opcode, ROL, MODE_DN, Byte | Word | Long, ShiftRg);
+        // OR
+        //
+        //       Syntax: OR <ea>,Dy
+        //               OR Dx,<ea>
+        //        Sizes: Byte, Word, Longword
 
-    opcode = parse("1110 ---0 --11 1---");
-    ____XXX_SS___XXX(opcode, ROR, MODE_DN, Byte | Word | Long, ShiftRg);
+        //               -------------------------------------------------
+        // <ea>,Dy       | 0 | 1 | 2 | 3 | 4 | 5 | 6 | 7 | 8 | 9 | A | B |
+        //               -------------------------------------------------
+        //                 X       X   X   X   X   X   X   X   X   X   X
 
-    opcode = parse("1110 ---1 --11 0---");
-    ____XXX_SS___XXX(opcode, ROXL, MODE_DN, Byte | Word | Long, ShiftRg);
+         opcode = parse("1000 ---0 ---- ----");
+        ____XXX_SSMMMXXX(opcode, OR, 0b101111111111, Byte | Word | Long, AndEaRg);
 
-    opcode = parse("1110 ---0 --11 0---");
-    ____XXX_SS___XXX(opcode, ROXR, MODE_DN, Byte | Word | Long, ShiftRg);
+        //               -------------------------------------------------
+        // Dx,<ea>       | 0 | 1 | 2 | 3 | 4 | 5 | 6 | 7 | 8 | 9 | A | B |
+        //               -------------------------------------------------
+        //                 X       X   X   X   X   X   X   X   X   X   X
 
-    // #<data>,Dy
-    opcode = parse("1110 ---1 --01 1---");
-    ____XXX_SS___XXX(opcode, ROL, MODE_IM, Byte | Word | Long, ShiftIm);
+        opcode = parse("1000 ---1 ---- ----");
+        ____XXX_SSMMMXXX(opcode, OR, 0b001111111000, Byte | Word | Long, AndRgEa);
 
-    opcode = parse("1110 ---0 --01 1---");
-    ____XXX_SS___XXX(opcode, ROR, MODE_IM, Byte | Word | Long, ShiftIm);
 
-    opcode = parse("1110 ---1 --01 0---");
-    ____XXX_SS___XXX(opcode, ROXL, MODE_IM, Byte | Word | Long, ShiftIm);
+        // ORI
+        //
+        //       Syntax: ORI #<data>,<ea>
+        //         Size: Byte, Word, Longword
+        //
+        //               -------------------------------------------------
+        // #<data>,<ea>  | 0 | 1 | 2 | 3 | 4 | 5 | 6 | 7 | 8 | 9 | A | B |
+        //               -------------------------------------------------
+        //                 X       X   X   X   X   X   X   X
 
-    opcode = parse("1110 ---0 --01 0---");
-    ____XXX_SS___XXX(opcode, ROXR, MODE_IM, Byte | Word | Long, ShiftIm);
+        opcode = parse("0000 0000 ---- ----");
+        ________SSMMMXXX(opcode, ORI, 0b100000000000, Byte | Word | Long, AndiRg);
+        ________SSMMMXXX(opcode, ORI, 0b001111111000, Byte | Word | Long, AndiEa);
 
-    //               -------------------------------------------------
-    // <ea>          | 0 | 1 | 2 | 3 | 4 | 5 | 6 | 7 | 8 | 9 | A | B |
-    //               -------------------------------------------------
-    //                         X   X   X   X   X   X   X
 
-    opcode = parse("1110 0111 11-- ----");
-    __________MMMXXX(opcode, ROL, 0b001111111000, Word, ShiftEa);
+        // ORI to CCR
+        //
+        //       Syntax: ORI #<data>,CCR
+        //         Size: Byte
+        //
 
-    opcode = parse("1110 0110 11-- ----");
-    __________MMMXXX(opcode, ROR, 0b001111111000, Word, ShiftEa);
+        bind(parse("0000 0000 0011 1100"), Andiccr, ORICCR, MODE_IM, Byte);
 
-    opcode = parse("1110 0101 11-- ----");
-    __________MMMXXX(opcode, ROXL, 0b001111111000, Word, ShiftEa);
 
-    opcode = parse("1110 0100 11-- ----");
-    __________MMMXXX(opcode, ROXR, 0b001111111000, Word, ShiftEa);
+        // ORI to SR
+        //
+        //       Syntax: ORI #<data>,SR
+        //         Size: Byte
+        //
 
+        bind(parse("0000 0000 0111 1100"), Andisr, ORISR, MODE_IM, Word);
 
-    // PEA
-    //
-    //       Syntax: PEA <ea>,Ay
-    //        Sizes: Longword
 
-    //               -------------------------------------------------
-    // <ea>,Ay       | 0 | 1 | 2 | 3 | 4 | 5 | 6 | 7 | 8 | 9 | A | B |
-    //               -------------------------------------------------
-    //                         X           X   X   X   X   X   X
+        // ROL, ROR, ROXL, ROXR
+        //
+        //       Syntax: (1) ROxx Dx,Dy
+        //               (2) ROxx #<data>,Dy
+        //               (3) ROxx <ea>
+        //        Sizes: Byte, Word, Longword
 
-    opcode = parse("0100 1000 01-- ----");
-    __________MMMXXX(opcode, PEA, 0b001001111110, Long, Pea);
+        // Dx,Dy
+        opcode = parse("1110 ---1 --11 1---");
+        ____XXX_SS___XXX(opcode, ROL, MODE_DN, Byte | Word | Long, ShiftRg);
 
+        opcode = parse("1110 ---0 --11 1---");
+        ____XXX_SS___XXX(opcode, ROR, MODE_DN, Byte | Word | Long, ShiftRg);
 
-    // RESET
-    //
-    //       Syntax: RESET
-    //        Sizes: Unsized
+        opcode = parse("1110 ---1 --11 0---");
+        ____XXX_SS___XXX(opcode, ROXL, MODE_DN, Byte | Word | Long, ShiftRg);
 
-    bind(parse("0100 1110 0111 0000"), Reset, RESET, MODE_IP, Long);
+        opcode = parse("1110 ---0 --11 0---");
+        ____XXX_SS___XXX(opcode, ROXR, MODE_DN, Byte | Word | Long, ShiftRg);
 
+        // #<data>,Dy
+        opcode = parse("1110 ---1 --01 1---");
+        ____XXX_SS___XXX(opcode, ROL, MODE_IM, Byte | Word | Long, ShiftIm);
 
-    // RTE
-    //
-    //       Syntax: RTE
-    //        Sizes: Unsized
+        opcode = parse("1110 ---0 --01 1---");
+        ____XXX_SS___XXX(opcode, ROR, MODE_IM, Byte | Word | Long, ShiftIm);
 
-    bind(parse("0100 1110 0111 0011"), Rte, RTE, MODE_IP, Long);
+        opcode = parse("1110 ---1 --01 0---");
+        ____XXX_SS___XXX(opcode, ROXL, MODE_IM, Byte | Word | Long, ShiftIm);
 
+        opcode = parse("1110 ---0 --01 0---");
+        ____XXX_SS___XXX(opcode, ROXR, MODE_IM, Byte | Word | Long, ShiftIm);
 
-    // RTR
-    //
-    //       Syntax: RTR
-    //        Sizes: Unsized
+        //               -------------------------------------------------
+        // <ea>          | 0 | 1 | 2 | 3 | 4 | 5 | 6 | 7 | 8 | 9 | A | B |
+        //               -------------------------------------------------
+        //                         X   X   X   X   X   X   X
 
-    bind(parse("0100 1110 0111 0111"), Rtr, RTR, MODE_IP, Long);
+        opcode = parse("1110 0111 11-- ----");
+        __________MMMXXX(opcode, ROL, 0b001111111000, Word, ShiftEa);
 
+        opcode = parse("1110 0110 11-- ----");
+        __________MMMXXX(opcode, ROR, 0b001111111000, Word, ShiftEa);
 
-    // RTS
-    //
-    //       Syntax: RTS
-    //        Sizes: Unsized
+        opcode = parse("1110 0101 11-- ----");
+        __________MMMXXX(opcode, ROXL, 0b001111111000, Word, ShiftEa);
 
-    bind(parse("0100 1110 0111 0101"), Rts, RTS, MODE_IP, Long);
+        opcode = parse("1110 0100 11-- ----");
+        __________MMMXXX(opcode, ROXR, 0b001111111000, Word, ShiftEa);
 
 
-    // SBCD
-    //
-    //       Syntax: (1) SBCD Dx,Dy
-    //               (2) SBCD -(Ax),-(Ay)
-    //         Size: Byte
+        // PEA
+        //
+        //       Syntax: PEA <ea>,Ay
+        //        Sizes: Longword
 
-    // Dx,Dy
-    opcode = parse("1000 ---1 0000 0---");
-    ____XXX______XXX(opcode, SBCD, MODE_DN, Byte, Abcd);
+        //               -------------------------------------------------
+        // <ea>,Ay       | 0 | 1 | 2 | 3 | 4 | 5 | 6 | 7 | 8 | 9 | A | B |
+        //               -------------------------------------------------
+        //                         X           X   X   X   X   X   X
 
-    // -(Ax),-(Ay)
-    opcode = parse("1000 ---1 0000 1---");
-    ____XXX______XXX(opcode, SBCD, MODE_PD, Byte, Abcd);
+        opcode = parse("0100 1000 01-- ----");
+        __________MMMXXX(opcode, PEA, 0b001001111110, Long, Pea);
 
 
-    // Scc
-    //
-    //       Syntax: Scc <ea>
-    //         Size: Word
-
-    //               -------------------------------------------------
-    // <ea>          | 0 | 1 | 2 | 3 | 4 | 5 | 6 | 7 | 8 | 9 | A | B |
-    //               -------------------------------------------------
-    //                 X       X   X   X   X   X   X   X
-
-    opcode = parse("0101 ---- 11-- ----");
-    __________MMMXXX(opcode | 0x000, ST,  0b100000000000, Word, SccRg);
-    __________MMMXXX(opcode | 0x100, SF,  0b100000000000, Word, SccRg);
-    __________MMMXXX(opcode | 0x200, SHI, 0b100000000000, Word, SccRg);
-    __________MMMXXX(opcode | 0x300, SLS, 0b100000000000, Word, SccRg);
-    __________MMMXXX(opcode | 0x400, SCC, 0b100000000000, Word, SccRg);
-    __________MMMXXX(opcode | 0x500, SCS, 0b100000000000, Word, SccRg);
-    __________MMMXXX(opcode | 0x600, SNE, 0b100000000000, Word, SccRg);
-    __________MMMXXX(opcode | 0x700, SEQ, 0b100000000000, Word, SccRg);
-    __________MMMXXX(opcode | 0x800, SVC, 0b100000000000, Word, SccRg);
-    __________MMMXXX(opcode | 0x900, SVS, 0b100000000000, Word, SccRg);
-    __________MMMXXX(opcode | 0xA00, SPL, 0b100000000000, Word, SccRg);
-    __________MMMXXX(opcode | 0xB00, SMI, 0b100000000000, Word, SccRg);
-    __________MMMXXX(opcode | 0xC00, SGE, 0b100000000000, Word, SccRg);
-    __________MMMXXX(opcode | 0xD00, SLT, 0b100000000000, Word, SccRg);
-    __________MMMXXX(opcode | 0xE00, SGT, 0b100000000000, Word, SccRg);
-    __________MMMXXX(opcode | 0xF00, SLE, 0b100000000000, Word, SccRg);
-
-    __________MMMXXX(opcode | 0x000, ST,  0b001111111000, Word, SccEa);
-    __________MMMXXX(opcode | 0x100, SF,  0b001111111000, Word, SccEa);
-    __________MMMXXX(opcode | 0x200, SHI, 0b001111111000, Word, SccEa);
-    __________MMMXXX(opcode | 0x300, SLS, 0b001111111000, Word, SccEa);
-    __________MMMXXX(opcode | 0x400, SCC, 0b001111111000, Word, SccEa);
-    __________MMMXXX(opcode | 0x500, SCS, 0b001111111000, Word, SccEa);
-    __________MMMXXX(opcode | 0x600, SNE, 0b001111111000, Word, SccEa);
-    __________MMMXXX(opcode | 0x700, SEQ, 0b001111111000, Word, SccEa);
-    __________MMMXXX(opcode | 0x800, SVC, 0b001111111000, Word, SccEa);
-    __________MMMXXX(opcode | 0x900, SVS, 0b001111111000, Word, SccEa);
-    __________MMMXXX(opcode | 0xA00, SPL, 0b001111111000, Word, SccEa);
-    __________MMMXXX(opcode | 0xB00, SMI, 0b001111111000, Word, SccEa);
-    __________MMMXXX(opcode | 0xC00, SGE, 0b001111111000, Word, SccEa);
-    __________MMMXXX(opcode | 0xD00, SLT, 0b001111111000, Word, SccEa);
-    __________MMMXXX(opcode | 0xE00, SGT, 0b001111111000, Word, SccEa);
-    __________MMMXXX(opcode | 0xF00, SLE, 0b001111111000, Word, SccEa);
-
-    // STOP
-    //
-    //       Syntax: STOP
-    //        Sizes: Unsized
+        // RESET
+        //
+        //       Syntax: RESET
+        //        Sizes: Unsized
 
-    bind(parse("0100 1110 0111 0010"), Stop, STOP, MODE_IP, Word);
+        bind(parse("0100 1110 0111 0000"), Reset, RESET, MODE_IP, Long);
 
 
-    // SUB
-    //
-    //       Syntax: (1) SUB <ea>,Dy
-    //               (2) SUB Dx,<ea>
-    //         Size: Byte, Word, Longword
+        // RTE
+        //
+        //       Syntax: RTE
+        //        Sizes: Unsized
 
-    //               -------------------------------------------------
-    // <ea>,Dy       | 0 | 1 | 2 | 3 | 4 | 5 | 6 | 7 | 8 | 9 | A | B |
-    //               -------------------------------------------------
-    //                 X  (X)  X   X   X   X   X   X   X   X   X   X
+        bind(parse("0100 1110 0111 0011"), Rte, RTE, MODE_IP, Long);
 
-    opcode = parse("1001 ---0 ---- ----");
-    ____XXX_SSMMMXXX(opcode, SUB, 0b101111111111, Byte,        AddEaRg);
-    ____XXX_SSMMMXXX(opcode, SUB, 0b111111111111, Word | Long, AddEaRg);
 
-    //               -------------------------------------------------
-    // Dx,<ea>       | 0 | 1 | 2 | 3 | 4 | 5 | 6 | 7 | 8 | 9 | A | B |
-    //               -------------------------------------------------
-    //                         X   X   X   X   X   X   X
+        // RTR
+        //
+        //       Syntax: RTR
+        //        Sizes: Unsized
 
-    opcode = parse("1001 ---1 ---- ----");
-    ____XXX_SSMMMXXX(opcode, SUB, 0b001111111000, Byte | Word | Long, AddRgEa);
+        bind(parse("0100 1110 0111 0111"), Rtr, RTR, MODE_IP, Long);
 
 
-    // SUBA
-    //
-    //       Syntax: SUBA <ea>,Ay
-    //         Size: Word, Longword
-    //
-    //               -------------------------------------------------
-    // <ea>,Ay       | 0 | 1 | 2 | 3 | 4 | 5 | 6 | 7 | 8 | 9 | A | B |
-    //               -------------------------------------------------
-    //                 X   X   X   X   X   X   X   X   X   X   X   X
-
-    opcode = parse("1001 ---- 11-- ----");
-    ____XXXS__MMMXXX(opcode, SUBA, 0b111111111111, Word | Long, Adda)
-
-
-    // SUBI
-    //
-    //       Syntax: SUBI #<data>,<ea>
-    //         Size: Byte, Word, Longword
-    //
-    //               -------------------------------------------------
-    // #<data>,<ea>  | 0 | 1 | 2 | 3 | 4 | 5 | 6 | 7 | 8 | 9 | A | B |
-    //               -------------------------------------------------
-    //                 X       X   X   X   X   X   X   X
-
-    opcode = parse("0000 0100 ---- ----");
-    ________SSMMMXXX(opcode, SUBI, 0b100000000000, Byte | Word | Long, AddiRg);
-    ________SSMMMXXX(opcode, SUBI, 0b001111111000, Byte | Word | Long, AddiEa);
-
-
-    // SUBQ
-    //
-    //       Syntax: SUBQ #<data>,<ea>
-    //         Size: Byte, Word, Longword
-    //
-    //               -------------------------------------------------
-    // #<data>,<ea>  | 0 | 1 | 2 | 3 | 4 | 5 | 6 | 7 | 8 | 9 | A | B |
-    //               -------------------------------------------------
-    //                 X  (X)  X   X   X   X   X   X   X
-
-    opcode = parse("0101 ---1 ---- ----");
-    ____XXX_SSMMMXXX(opcode, SUBQ, 0b100000000000, Byte | Word | Long, AddqDn);
-    ____XXX_SSMMMXXX(opcode, SUBQ, 0b010000000000, Word | Long,        AddqAn);
-    ____XXX_SSMMMXXX(opcode, SUBQ, 0b001111111000, Byte | Word | Long, AddqEa);
+        // RTS
+        //
+        //       Syntax: RTS
+        //        Sizes: Unsized
 
+        bind(parse("0100 1110 0111 0101"), Rts, RTS, MODE_IP, Long);
+    }
 
-    // SUBX
-    //
-    //       Syntax: (1) SUBX Dx,Dy
-    //               (2) SUBX -(Ax),-(Ay)
-    //         Size: Byte, Word, Longword
+    if constexpr (G == 7) { // SBCD - UNLK
+
+        // SBCD
+        //
+        //       Syntax: (1) SBCD Dx,Dy
+        //               (2) SBCD -(Ax),-(Ay)
+        //         Size: Byte
+
+        // Dx,Dy
+        opcode = parse("1000 ---1 0000 0---");
+        ____XXX______XXX(opcode, SBCD, MODE_DN, Byte, Abcd);
+
+        // -(Ax),-(Ay)
+        opcode = parse("1000 ---1 0000 1---");
+        ____XXX______XXX(opcode, SBCD, MODE_PD, Byte, Abcd);
+
+
+        // Scc
+        //
+        //       Syntax: Scc <ea>
+        //         Size: Word
+
+        //               -------------------------------------------------
+        // <ea>          | 0 | 1 | 2 | 3 | 4 | 5 | 6 | 7 | 8 | 9 | A | B |
+        //               -------------------------------------------------
+        //                 X       X   X   X   X   X   X   X
+
+        opcode = parse("0101 ---- 11-- ----");
+        __________MMMXXX(opcode | 0x000, ST,  0b100000000000, Word, SccRg);
+        __________MMMXXX(opcode | 0x100, SF,  0b100000000000, Word, SccRg);
+        __________MMMXXX(opcode | 0x200, SHI, 0b100000000000, Word, SccRg);
+        __________MMMXXX(opcode | 0x300, SLS, 0b100000000000, Word, SccRg);
+        __________MMMXXX(opcode | 0x400, SCC, 0b100000000000, Word, SccRg);
+        __________MMMXXX(opcode | 0x500, SCS, 0b100000000000, Word, SccRg);
+        __________MMMXXX(opcode | 0x600, SNE, 0b100000000000, Word, SccRg);
+        __________MMMXXX(opcode | 0x700, SEQ, 0b100000000000, Word, SccRg);
+        __________MMMXXX(opcode | 0x800, SVC, 0b100000000000, Word, SccRg);
+        __________MMMXXX(opcode | 0x900, SVS, 0b100000000000, Word, SccRg);
+        __________MMMXXX(opcode | 0xA00, SPL, 0b100000000000, Word, SccRg);
+        __________MMMXXX(opcode | 0xB00, SMI, 0b100000000000, Word, SccRg);
+        __________MMMXXX(opcode | 0xC00, SGE, 0b100000000000, Word, SccRg);
+        __________MMMXXX(opcode | 0xD00, SLT, 0b100000000000, Word, SccRg);
+        __________MMMXXX(opcode | 0xE00, SGT, 0b100000000000, Word, SccRg);
+        __________MMMXXX(opcode | 0xF00, SLE, 0b100000000000, Word, SccRg);
+
+        __________MMMXXX(opcode | 0x000, ST,  0b001111111000, Word, SccEa);
+        __________MMMXXX(opcode | 0x100, SF,  0b001111111000, Word, SccEa);
+        __________MMMXXX(opcode | 0x200, SHI, 0b001111111000, Word, SccEa);
+        __________MMMXXX(opcode | 0x300, SLS, 0b001111111000, Word, SccEa);
+        __________MMMXXX(opcode | 0x400, SCC, 0b001111111000, Word, SccEa);
+        __________MMMXXX(opcode | 0x500, SCS, 0b001111111000, Word, SccEa);
+        __________MMMXXX(opcode | 0x600, SNE, 0b001111111000, Word, SccEa);
+        __________MMMXXX(opcode | 0x700, SEQ, 0b001111111000, Word, SccEa);
+        __________MMMXXX(opcode | 0x800, SVC, 0b001111111000, Word, SccEa);
+        __________MMMXXX(opcode | 0x900, SVS, 0b001111111000, Word, SccEa);
+        __________MMMXXX(opcode | 0xA00, SPL, 0b001111111000, Word, SccEa);
+        __________MMMXXX(opcode | 0xB00, SMI, 0b001111111000, Word, SccEa);
+        __________MMMXXX(opcode | 0xC00, SGE, 0b001111111000, Word, SccEa);
+        __________MMMXXX(opcode | 0xD00, SLT, 0b001111111000, Word, SccEa);
+        __________MMMXXX(opcode | 0xE00, SGT, 0b001111111000, Word, SccEa);
+        __________MMMXXX(opcode | 0xF00, SLE, 0b001111111000, Word, SccEa);
+
+        // STOP
+        //
+        //       Syntax: STOP
+        //        Sizes: Unsized
+
+        bind(parse("0100 1110 0111 0010"), Stop, STOP, MODE_IP, Word);
+
+
+        // SUB
+        //
+        //       Syntax: (1) SUB <ea>,Dy
+        //               (2) SUB Dx,<ea>
+        //         Size: Byte, Word, Longword
+
+        //               -------------------------------------------------
+        // <ea>,Dy       | 0 | 1 | 2 | 3 | 4 | 5 | 6 | 7 | 8 | 9 | A | B |
+        //               -------------------------------------------------
+        //                 X  (X)  X   X   X   X   X   X   X   X   X   X
+
+        opcode = parse("1001 ---0 ---- ----");
+        ____XXX_SSMMMXXX(opcode, SUB, 0b101111111111, Byte,        AddEaRg);
+        ____XXX_SSMMMXXX(opcode, SUB, 0b111111111111, Word | Long, AddEaRg);
+
+        //               -------------------------------------------------
+        // Dx,<ea>       | 0 | 1 | 2 | 3 | 4 | 5 | 6 | 7 | 8 | 9 | A | B |
+        //               -------------------------------------------------
+        //                         X   X   X   X   X   X   X
+
+        opcode = parse("1001 ---1 ---- ----");
+        ____XXX_SSMMMXXX(opcode, SUB, 0b001111111000, Byte | Word | Long, AddRgEa);
+
+
+        // SUBA
+        //
+        //       Syntax: SUBA <ea>,Ay
+        //         Size: Word, Longword
+        //
+        //               -------------------------------------------------
+        // <ea>,Ay       | 0 | 1 | 2 | 3 | 4 | 5 | 6 | 7 | 8 | 9 | A | B |
+        //               -------------------------------------------------
+        //                 X   X   X   X   X   X   X   X   X   X   X   X
+
+        opcode = parse("1001 ---- 11-- ----");
+        ____XXXS__MMMXXX(opcode, SUBA, 0b111111111111, Word | Long, Adda)
+
+
+        // SUBI
+        //
+        //       Syntax: SUBI #<data>,<ea>
+        //         Size: Byte, Word, Longword
+        //
+        //               -------------------------------------------------
+        // #<data>,<ea>  | 0 | 1 | 2 | 3 | 4 | 5 | 6 | 7 | 8 | 9 | A | B |
+        //               -------------------------------------------------
+        //                 X       X   X   X   X   X   X   X
+
+        opcode = parse("0000 0100 ---- ----");
+        ________SSMMMXXX(opcode, SUBI, 0b100000000000, Byte | Word | Long, AddiRg);
+        ________SSMMMXXX(opcode, SUBI, 0b001111111000, Byte | Word | Long, AddiEa);
+
+
+        // SUBQ
+        //
+        //       Syntax: SUBQ #<data>,<ea>
+        //         Size: Byte, Word, Longword
+        //
+        //               -------------------------------------------------
+        // #<data>,<ea>  | 0 | 1 | 2 | 3 | 4 | 5 | 6 | 7 | 8 | 9 | A | B |
+        //               -------------------------------------------------
+        //                 X  (X)  X   X   X   X   X   X   X
+
+        opcode = parse("0101 ---1 ---- ----");
+        ____XXX_SSMMMXXX(opcode, SUBQ, 0b100000000000, Byte | Word | Long, AddqDn);
+        ____XXX_SSMMMXXX(opcode, SUBQ, 0b010000000000, Word | Long,        AddqAn);
+        ____XXX_SSMMMXXX(opcode, SUBQ, 0b001111111000, Byte | Word | Long, AddqEa);
+
+
+        // SUBX
+        //
+        //       Syntax: (1) SUBX Dx,Dy
+        //               (2) SUBX -(Ax),-(Ay)
+        //         Size: Byte, Word, Longword
+
+        // Dx,Dy
+        opcode = parse("1001 ---1 --00 0---");
+        ____XXX_SS___XXX(opcode, SUBX, MODE_DN, Byte | Word | Long, AddxRg);
+
+        // -(Ax),-(Ay)
+        opcode = parse("1001 ---1 --00 1---");
+        ____XXX_SS___XXX(opcode, SUBX, MODE_PD, Byte | Word | Long, AddxEa);
 
-    // Dx,Dy
-    opcode = parse("1001 ---1 --00 0---");
-    ____XXX_SS___XXX(opcode, SUBX, MODE_DN, Byte | Word | Long, AddxRg);
 
-    // -(Ax),-(Ay)
-    opcode = parse("1001 ---1 --00 1---");
-    ____XXX_SS___XXX(opcode, SUBX, MODE_PD, Byte | Word | Long, AddxEa);
+        // SWAP
+        //
+        //       Syntax: SWAP Dn
+        //         Size: Word
 
+        opcode = parse("0100 1000 0100 0---");
+        _____________XXX(opcode, SWAP, MODE_DN, Word, Swap);
 
-    // SWAP
-    //
-    //       Syntax: SWAP Dn
-    //         Size: Word
 
-    opcode = parse("0100 1000 0100 0---");
-    _____________XXX(opcode, SWAP, MODE_DN, Word, Swap);
+        // TAS
+        //
+        //       Syntax: TAS <ea>
+        //         Size: Byte
 
+        //               -------------------------------------------------
+        // <ea>          | 0 | 1 | 2 | 3 | 4 | 5 | 6 | 7 | 8 | 9 | A | B |
+        //               -------------------------------------------------
+        //                 X       X   X   X   X   X   X   X
 
-    // TAS
-    //
-    //       Syntax: TAS <ea>
-    //         Size: Byte
+        opcode = parse("0100 1010 11-- ----");
+        __________MMMXXX(opcode, TAS, 0b100000000000, Byte, TasRg);
+        __________MMMXXX(opcode, TAS, 0b001111111000, Byte, TasEa);
 
-    //               -------------------------------------------------
-    // <ea>          | 0 | 1 | 2 | 3 | 4 | 5 | 6 | 7 | 8 | 9 | A | B |
-    //               -------------------------------------------------
-    //                 X       X   X   X   X   X   X   X
 
-    opcode = parse("0100 1010 11-- ----");
-    __________MMMXXX(opcode, TAS, 0b100000000000, Byte, TasRg);
-    __________MMMXXX(opcode, TAS, 0b001111111000, Byte, TasEa);
+        // TRAP
+        //
+        //       Syntax: TRAP #<vector>
+        //        Sizes: Unsized
 
+        opcode = parse("0100 1110 0100 ----");
+        ____________XXXX(opcode, TRAP, MODE_IP, Long, Trap);
 
-    // TRAP
-    //
-    //       Syntax: TRAP #<vector>
-    //        Sizes: Unsized
 
-    opcode = parse("0100 1110 0100 ----");
-    ____________XXXX(opcode, TRAP, MODE_IP, Long, Trap);
+        // TRAPV
+        //
+        //       Syntax: TRAPV
+        //        Sizes: Unsized
 
+        bind(parse("0100 1110 0111 0110"), Trapv, TRAPV, MODE_IP, Long);
 
-    // TRAPV
-    //
-    //       Syntax: TRAPV
-    //        Sizes: Unsized
 
-    bind(parse("0100 1110 0111 0110"), Trapv, TRAPV, MODE_IP, Long);
+        // TST
+        //
+        //       Syntax: TST <ea>
+        //         Size: Byte, Word, Longword
 
+        //               -------------------------------------------------
+        // <ea>          | 0 | 1 | 2 | 3 | 4 | 5 | 6 | 7 | 8 | 9 | A | B |
+        //               -------------------------------------------------
+        //                 X       X   X   X   X   X   X   X
 
-    // TST
-    //
-    //       Syntax: TST <ea>
-    //         Size: Byte, Word, Longword
-
-    //               -------------------------------------------------
-    // <ea>          | 0 | 1 | 2 | 3 | 4 | 5 | 6 | 7 | 8 | 9 | A | B |
-    //               -------------------------------------------------
-    //                 X       X   X   X   X   X   X   X
+        opcode = parse("0100 1010 ---- ----");
+        ________SSMMMXXX(opcode, TST, 0b101111111000, Byte | Word | Long, Tst);
 
-    opcode = parse("0100 1010 ---- ----");
-    ________SSMMMXXX(opcode, TST, 0b101111111000, Byte | Word | Long, Tst);
 
+        // UNLK
+        //
+        //       Syntax: UNLK An
+        //        Sizes: Word
 
-    // UNLK
-    //
-    //       Syntax: UNLK An
-    //        Sizes: Word
-
-    opcode = parse("0100 1110 0101 1---");
-    _____________XXX(opcode, UNLK, MODE_IP, Word, Unlk);
+        opcode = parse("0100 1110 0101 1---");
+        _____________XXX(opcode, UNLK, MODE_IP, Word, Unlk);
+    }
 }
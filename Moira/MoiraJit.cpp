@@ -0,0 +1,232 @@
+// -----------------------------------------------------------------------------
+// This file is part of Moira - A Motorola 68k emulator
+//
+// Copyright (C) Dirk W. Hoffmann. www.dirkwhoffmann.de
+// Licensed under the GNU General Public License v3
+//
+// See https://www.gnu.org for license information
+// -----------------------------------------------------------------------------
+
+#include "MoiraJit.h"
+
+#include <cstring>
+
+#if JIT_AVAILABLE
+#include <sys/mman.h>
+#endif
+
+namespace moira {
+
+JitBuffer::JitBuffer(size_t capacity)
+{
+#if JIT_AVAILABLE
+
+    void *mem = mmap(nullptr, capacity, PROT_READ | PROT_EXEC, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+    if (mem != MAP_FAILED) {
+
+        base = (u8 *)mem;
+        this->capacity = capacity;
+    }
+
+#endif
+}
+
+JitBuffer::~JitBuffer()
+{
+#if JIT_AVAILABLE
+
+    if (base) munmap(base, capacity);
+
+#endif
+}
+
+void
+JitBuffer::begin()
+{
+    code.clear();
+    exits.clear();
+
+    emit(0x53);                                 // push  rbx
+    emit(0x41); emit(0x54);                     // push  r12
+    emit(0x41); emit(0x55);                     // push  r13
+    emit(0x48); emit(0x89); emit(0xFB);         // mov   rbx,rdi
+    emit(0x49); emit(0x89); emit(0xF4);         // mov   r12,rsi
+}
+
+JitCode
+JitBuffer::end()
+{
+    // Let all exits jump to the epilogue
+    for (auto pos : exits) {
+
+        u32 rel = (u32)(code.size() - (pos + 4));
+        memcpy(&code[pos], &rel, 4);
+    }
+
+    emit(0x41); emit(0x5D);                     // pop   r13
+    emit(0x41); emit(0x5C);                     // pop   r12
+    emit(0x5B);                                 // pop   rbx
+    emit(0xC3);                                 // ret
+
+#if JIT_AVAILABLE
+
+    if (!base || used + code.size() > capacity) return nullptr;
+
+    u8 *entry = base + used;
+
+    // Executable memory is never writable at the same time
+    mprotect(base, capacity, PROT_READ | PROT_WRITE);
+    memcpy(entry, code.data(), code.size());
+    mprotect(base, capacity, PROT_READ | PROT_EXEC);
+
+    // Start the next block on a cache line boundary
+    used = (used + code.size() + 63) & ~(size_t)63;
+
+    return (JitCode)entry;
+
+#else
+
+    return nullptr;
+
+#endif
+}
+
+void
+JitBuffer::jump(size_t label)
+{
+    emit(0xE9);                                 // jmp   label
+    emit32((u32)(label - (code.size() + 4)));
+}
+
+void
+JitBuffer::exitIfSet(i32 off)
+{
+    emit(0x83); emit(0xBB); emit32(off);        // cmp   dword [rbx+off],0
+    emit(0x00);
+    exitIf(CC_Z | 1);                           // jne   exit
+}
+
+void
+JitBuffer::exitIfReached(i32 clock)
+{
+    emit(0x4C); emit(0x39); emit(0xA3);         // cmp   [rbx+clock],r12
+    emit32(clock);
+    exitIf(0xD);                                // jge   exit
+}
+
+void
+JitBuffer::exitIfDiffers(i32 off, u32 value, Size S)
+{
+    prefix(S);                                  // cmp   [rbx+off],value
+    emit(S == Byte ? 0x80 : 0x81); emit(0xBB); emit32(off);
+    emitImm(S, value);
+    exitIf(CC_Z | 1);                           // jne   exit
+}
+
+void
+JitBuffer::call(const void *fn, i32 adj)
+{
+    emit(0x48); emit(0x8D); emit(0xBB);         // lea   rdi,[rbx+adj]
+    emit32(adj);
+    emit(0x48); emit(0xB8);                     // mov   rax,fn
+    u64 addr = (u64)fn;
+    for (int i = 0; i < 8; i++) emit((u8)(addr >> (8 * i)));
+    emit(0xFF); emit(0xD0);                     // call  rax
+}
+
+void
+JitBuffer::call(const void *fn, i32 adj, u32 arg)
+{
+    emit(0xBE); emit32(arg);                    // mov   esi,arg
+    call(fn, adj);
+}
+
+void
+JitBuffer::storeImm(Size S, i32 off, u32 value)
+{
+    prefix(S);                                  // mov   [rbx+off],value
+    emit(S == Byte ? 0xC6 : 0xC7); emit(0x83); emit32(off);
+    emitImm(S, value);
+}
+
+void
+JitBuffer::aluImm(Size S, int ext, u32 value)
+{
+    prefix(S);                                  // op    eax,value
+    emit(S == Byte ? 0x80 : 0x81); emit((u8)(0xC0 | ext << 3));
+    emitImm(S, value);
+}
+
+void
+JitBuffer::unary(Size S, int ext)
+{
+    prefix(S);                                  // op    eax
+    emit(S == Byte ? 0xF6 : 0xF7); emit((u8)(0xC0 | ext << 3));
+}
+
+void
+JitBuffer::regs(Size S, u8 opcode, int src, int dst)
+{
+    u8 rex = (u8)(0x40 | (src & 8) >> 1 | (dst & 8) >> 3);
+
+    prefix(S);                                  // op    dst,src
+    if (rex != 0x40) emit(rex);
+    emit(S == Byte ? opcode - 1 : opcode);
+    emit((u8)(0xC0 | (src & 7) << 3 | (dst & 7)));
+}
+
+void
+JitBuffer::swap()
+{
+    emit(0xC1); emit(0xC0); emit(0x10);         // rol   eax,16
+}
+
+void
+JitBuffer::extend(Size S)
+{
+    if (S == Word) {
+        emit(0x66); emit(0x0F); emit(0xBE); emit(0xC0); // movsx ax,al
+    } else {
+        emit(0x0F); emit(0xBF); emit(0xC0);             // movsx eax,ax
+    }
+}
+
+void
+JitBuffer::set(int cc, i32 off)
+{
+    emit(0x0F); emit((u8)(0x90 | cc));          // setcc [rbx+off]
+    emit(0x83); emit32(off);
+}
+
+void
+JitBuffer::emit32(u32 value)
+{
+    for (int i = 0; i < 4; i++) emit((u8)(value >> (8 * i)));
+}
+
+void
+JitBuffer::emitImm(Size S, u32 value)
+{
+    for (int i = 0; i < (S == Byte ? 1 : S == Word ? 2 : 4); i++) emit((u8)(value >> (8 * i)));
+}
+
+void
+JitBuffer::mem(Size S, u8 opcode, int r, i32 off)
+{
+    prefix(S);                                  // op    r,[rbx+off]
+    if (r & 8) emit(0x44);
+    emit(S == Byte ? opcode - 1 : opcode);
+    emit((u8)(0x80 | (r & 7) << 3 | 3));
+    emit32(off);
+}
+
+void
+JitBuffer::exitIf(int cc)
+{
+    emit(0x0F); emit((u8)(0x80 | cc));          // jcc   exit
+    exits.push_back(code.size());
+    emit32(0);
+}
+
+}
@@ -0,0 +1,149 @@
+// -----------------------------------------------------------------------------
+// This file is part of Moira - A Motorola 68k emulator
+//
+// Copyright (C) Dirk W. Hoffmann. www.dirkwhoffmann.de
+// Licensed under the GNU General Public License v3
+//
+// See https://www.gnu.org for license information
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+#include "MoiraTypes.h"
+#include <vector>
+
+namespace moira {
+
+/* Indicates whether the host architecture is supported by the translator.
+ *
+ * The translator emits x86-64 machine code and follows the System V calling
+ * convention. On all other hosts, enableJit() leaves the block cache in place
+ * which executes all instructions by their ordinary handlers.
+ */
+#if defined(__x86_64__) && !defined(_WIN32)
+#define JIT_AVAILABLE true
+#else
+#define JIT_AVAILABLE false
+#endif
+
+// A translated block (called with the CPU and the cycle to stop at)
+typedef void (*JitCode)(void *cpu, i64 cycle);
+
+/* A minimal x86-64 code generator
+ *
+ * The generator assembles a single block at a time into a byte buffer and
+ * copies the result into a region of executable memory. The generated code
+ * keeps the CPU pointer in rbx, the cycle limit in r12, and the result of the
+ * current instruction in r13. All three registers are callee-saved, i.e., they
+ * survive the calls into the instruction handlers and into the bus interface.
+ * CPU members are addressed by their offset to the CPU pointer. Scratch
+ * registers are denoted by their x86 register number (0 = eax, 1 = ecx).
+ */
+class JitBuffer {
+
+    // Executable memory (writable only while a block is copied in)
+    u8 *base = nullptr;
+    size_t capacity = 0;
+    size_t used = 0;
+
+    // Machine code of the block under construction
+    std::vector<u8> code;
+
+    // Positions of all jumps to the block exit
+    std::vector<size_t> exits;
+
+public:
+
+    // Register numbers
+    static constexpr int EAX = 0;
+    static constexpr int ECX = 1;
+    static constexpr int R13 = 13;
+
+    JitBuffer(size_t capacity);
+    ~JitBuffer();
+
+    // Indicates whether executable memory has been granted by the OS
+    bool usable() const { return base != nullptr; }
+
+    // Discards all translated blocks
+    void reset() { used = 0; }
+
+    // Starts a new block
+    void begin();
+
+    // Finishes the block and returns its entry point (nullptr if full)
+    JitCode end();
+
+    // Returns the current position inside the block
+    size_t label() const { return code.size(); }
+
+    // Discards all code emitted after a previously recorded position
+    void rewind(size_t label) { code.resize(label); }
+
+    // Continues execution at a previously recorded position
+    void jump(size_t label);
+
+    // Leaves the block if a 32-bit member is non-zero
+    void exitIfSet(i32 off);
+
+    // Leaves the block if the clock has reached the cycle limit
+    void exitIfReached(i32 clock);
+
+    // Leaves the block if a member differs from the expected value
+    void exitIfDiffers(i32 off, u32 value, Size S);
+
+    // Calls a function with the CPU pointer (plus adj) and an optional argument
+    void call(const void *fn, i32 adj);
+    void call(const void *fn, i32 adj, u32 arg);
+
+    // Loads or stores a register
+    void load(Size S, int r, i32 off) { mem(S, 0x8B, r, off); }
+    void store(Size S, int r, i32 off) { mem(S, 0x89, r, off); }
+
+    // Stores a constant
+    void storeImm(Size S, i32 off, u32 value);
+
+    // Combines a register with a member (opcode = 32-bit "op r32, r/m32")
+    void alu(Size S, u8 opcode, int r, i32 off) { mem(S, opcode, r, off); }
+
+    // Combines eax with a constant (ext = opcode extension of "op r/m, imm")
+    void aluImm(Size S, int ext, u32 value);
+
+    // Performs a unary operation on eax (ext = opcode extension of F7)
+    void unary(Size S, int ext);
+
+    // Copies a register (opcode 0x89) or sets the flags from it (opcode 0x85)
+    void regs(Size S, u8 opcode, int src, int dst);
+
+    // Exchanges both halves of eax
+    void swap();
+
+    // Sign-extends the lower half of eax
+    void extend(Size S);
+
+    // Stores an x86 condition code as a boolean
+    void set(int cc, i32 off);
+
+    // x86 condition codes
+    static constexpr int CC_O = 0x0;
+    static constexpr int CC_C = 0x2;
+    static constexpr int CC_Z = 0x4;
+    static constexpr int CC_S = 0x8;
+
+private:
+
+    void emit(u8 byte) { code.push_back(byte); }
+    void emit32(u32 value);
+    void emitImm(Size S, u32 value);
+
+    // Emits the operand size prefix for word operations
+    void prefix(Size S) { if (S == Word) emit(0x66); }
+
+    // Emits an instruction operating on a register and [rbx + off]
+    void mem(Size S, u8 opcode, int r, i32 off);
+
+    // Emits a conditional jump to the block exit
+    void exitIf(int cc);
+};
+
+}
@@ -0,0 +1,347 @@
+// -----------------------------------------------------------------------------
+// This file is part of Moira - A Motorola 68k emulator
+//
+// Copyright (C) Dirk W. Hoffmann. www.dirkwhoffmann.de
+// Licensed under the GNU General Public License v3
+//
+// See https://www.gnu.org for license information
+// -----------------------------------------------------------------------------
+
+template <class H, class C> void
+MoiraT<H, C>::enableJit(bool value)
+{
+    if (value && !C::enableJit) {
+
+        printf("This feature requires ENABLE_JIT = true\n");
+        assert(false);
+        return;
+    }
+
+    jit.reset();
+
+    // Without executable memory, the block cache is used alone
+    if (value && JIT_AVAILABLE) {
+
+        jit = std::make_unique<JitBuffer>(JIT_SIZE);
+        if (!jit->usable()) jit.reset();
+    }
+
+    // Start over with an empty block cache
+    if (value) enableBlockCache(true);
+    flushJit();
+}
+
+template <class H, class C> void
+MoiraT<H, C>::flushJit()
+{
+    for (auto &block : blocks) { block.native = nullptr; block.runs = 0; }
+    if (jit) jit->reset();
+}
+
+template <class H, class C> void
+MoiraT<H, C>::jitPrefetch(void *cpu)
+{
+    static_cast<MoiraT *>(cpu)->template prefetch<POLLIPL>();
+}
+
+template <class H, class C> void
+MoiraT<H, C>::jitAdvance(void *cpu, int cycles)
+{
+    static_cast<MoiraT *>(cpu)->advance(cycles);
+}
+
+template <class H, class C> void
+MoiraT<H, C>::jitExec(void *cpu, u16 opcode)
+{
+    auto self = static_cast<MoiraT *>(cpu);
+    (self->*exec[opcode])(opcode);
+}
+
+template <class H, class C> void
+MoiraT<H, C>::translateBlock(CodeBlock &block)
+{
+    auto &x = *jit;
+
+    x.begin();
+    size_t top = x.label();
+
+    for (int i = 0; i < block.count; i++) {
+
+        u32 pc = block.pc[i];
+        u16 op = block.op[i];
+        u32 next = i + 1 < block.count ? block.pc[i + 1] : block.next;
+
+        // Leave the block if the instruction stream has changed (see runBlock())
+        x.exitIfSet(offset(&flags));
+        x.exitIfReached(offset(&clock));
+        x.exitIfDiffers(offset(&reg.pc), pc, Long);
+        x.exitIfDiffers(offset(&queue.ird), op, Word);
+
+        // Instructions fused with their successor are left to the handler
+        if (next == pc + 2 && translateInstr(x, pc, op)) continue;
+
+        x.storeImm(Long, offset(&reg.pc), pc + 2);
+
+        /* Call the handler directly if the member function pointer has the
+         * Itanium layout (code address, this adjustment) of a non-virtual
+         * function. Otherwise, take the detour through the jump table.
+         */
+        ExecPtr handler = exec[op];
+        struct { u64 fn; i64 adj; } raw;
+
+        if (sizeof(handler) == sizeof(raw)) memcpy(&raw, &handler, sizeof(raw));
+        if (sizeof(handler) == sizeof(raw) && !(raw.fn & 1)) {
+            x.call((const void *)raw.fn, (i32)raw.adj, op);
+        } else {
+            x.call((const void *)jitExec, 0, op);
+        }
+    }
+
+    /* Close the loop if the block ends where it started. In approximate
+     * timing mode, the block returns instead, because executeUntil() charges
+     * the elapsed cycles after each pass through a block.
+     */
+    if (block.next == block.pc[0] && !hooked(block.pc[0])) {
+
+        x.exitIfDiffers(offset(&preciseTiming), true, Byte);
+        x.jump(top);
+    }
+
+    block.native = x.end();
+
+    // Start over if the executable memory is exhausted
+    if (!block.native) flushJit();
+}
+
+template <class H, class C> bool
+MoiraT<H, C>::translateInstr(JitBuffer &x, u32 pc, u16 op)
+{
+    const int eax = JitBuffer::EAX, ecx = JitBuffer::ECX, r13 = JitBuffer::R13;
+
+    int rx = (op >> 9) & 7;
+    int ry = op & 7;
+    Size S = (op & 0xC0) == 0x00 ? Byte : (op & 0xC0) == 0x40 ? Word : Long;
+    bool sized = (op & 0xC0) != 0xC0;
+
+    auto d = [&](int n) { return offset(&reg.d[n]); };
+    auto a = [&](int n) { return offset(&reg.a[n]); };
+
+    // Copies the x86 condition codes into the status register
+    auto setNZ = [&]() {
+        x.set(JitBuffer::CC_S, offset(&reg.sr.n));
+        x.set(JitBuffer::CC_Z, offset(&reg.sr.z));
+    };
+    auto setNZVC = [&]() {
+        setNZ();
+        x.set(JitBuffer::CC_O, offset(&reg.sr.v));
+        x.set(JitBuffer::CC_C, offset(&reg.sr.c));
+    };
+    auto setXNZVC = [&]() {
+        setNZVC();
+        x.set(JitBuffer::CC_C, offset(&reg.sr.x));
+    };
+    auto clearVC = [&]() {
+        x.storeImm(Byte, offset(&reg.sr.v), 0);
+        x.storeImm(Byte, offset(&reg.sr.c), 0);
+    };
+    auto prefetch = [&]() { x.call((const void *)jitPrefetch, 0); };
+    auto advance = [&](int cycles) { x.call((const void *)jitAdvance, 0, cycles); };
+
+    /* The translated instructions perform the same sequence of bus accesses,
+     * calls to sync(), and register updates as their handlers. Only the
+     * computation of the result and the condition codes is done natively.
+     */
+    auto translate = [&]() -> bool {
+
+        // MOVEQ #<data>,Dx
+        if ((op & 0xF100) == 0x7000) {
+
+            i32 data = (i8)op;
+            x.storeImm(Long, d(rx), (u32)data);
+            x.storeImm(Byte, offset(&reg.sr.n), data < 0);
+            x.storeImm(Byte, offset(&reg.sr.z), data == 0);
+            clearVC();
+            prefetch();
+            return true;
+        }
+
+        // MOVE Dy,Dx
+        if ((op & 0xC1F8) == 0x0000 && (op & 0x3000)) {
+
+            Size s = (op & 0x3000) == 0x1000 ? Byte : (op & 0x3000) == 0x3000 ? Word : Long;
+            x.load(s, eax, d(ry));
+            x.regs(s, 0x85, eax, eax);
+            setNZ();
+            clearVC();
+            x.store(s, eax, d(rx));
+            prefetch();
+            return true;
+        }
+
+        // ADD, SUB, AND, OR, CMP Dy,Dx
+        if (sized && (op & 0x0138) == 0x0000) {
+
+            u8 opcode;
+            switch (op & 0xF000) {
+
+                case 0xD000: opcode = 0x03; break;
+                case 0x9000: opcode = 0x2B; break;
+                case 0xC000: opcode = 0x23; break;
+                case 0x8000: opcode = 0x0B; break;
+                case 0xB000: opcode = 0x3B; break;
+                default: return false;
+            }
+
+            x.load(S, eax, d(rx));
+            x.alu(S, opcode, eax, d(ry));
+
+            if (opcode == 0x3B) {
+
+                setNZVC();
+                prefetch();
+                if (S == Long) advance(2);
+                return true;
+            }
+
+            if (opcode == 0x03 || opcode == 0x2B) setXNZVC(); else setNZVC();
+            x.regs(Long, 0x89, eax, r13);
+            prefetch();
+            if (S == Long) advance(4);
+            x.store(S, r13, d(rx));
+            return true;
+        }
+
+        // EOR Dx,Dy
+        if (sized && (op & 0xF138) == 0xB100) {
+
+            x.load(S, eax, d(ry));
+            x.alu(S, 0x33, eax, d(rx));
+            setNZVC();
+            x.regs(Long, 0x89, eax, r13);
+            prefetch();
+            if (S == Long) advance(4);
+            x.store(S, r13, d(ry));
+            return true;
+        }
+
+        // ADDQ, SUBQ #<data>,Dy
+        if (sized && (op & 0xF038) == 0x5000) {
+
+            x.load(S, eax, d(ry));
+            x.aluImm(S, (op & 0x100) ? 5 : 0, rx ? rx : 8);
+            setXNZVC();
+            x.regs(Long, 0x89, eax, r13);
+            prefetch();
+            if (S == Long) advance(4);
+            x.store(S, r13, d(ry));
+            return true;
+        }
+
+        // ADDQ, SUBQ #<data>,Ay
+        if (sized && S != Byte && (op & 0xF038) == 0x5008) {
+
+            x.load(Long, eax, a(ry));
+            x.aluImm(Long, (op & 0x100) ? 5 : 0, rx ? rx : 8);
+            x.regs(Long, 0x89, eax, r13);
+            prefetch();
+            advance(4);
+            x.store(Long, r13, a(ry));
+            return true;
+        }
+
+        // TST Dy
+        if (sized && (op & 0xFF38) == 0x4A00) {
+
+            x.load(S, eax, d(ry));
+            x.regs(S, 0x85, eax, eax);
+            setNZ();
+            clearVC();
+            prefetch();
+            return true;
+        }
+
+        // NEG, NOT Dy
+        if (sized && ((op & 0xFF38) == 0x4400 || (op & 0xFF38) == 0x4600)) {
+
+            bool neg = (op & 0xFF38) == 0x4400;
+
+            x.load(S, eax, d(ry));
+            x.unary(S, neg ? 3 : 2);
+            if (neg) {
+                setXNZVC();
+            } else {
+                x.regs(S, 0x85, eax, eax);
+                setNZ();
+                clearVC();
+            }
+            x.regs(Long, 0x89, eax, r13);
+            prefetch();
+            if (S == Long) advance(2);
+            x.store(S, r13, d(ry));
+            return true;
+        }
+
+        // CLR Dy
+        if (sized && (op & 0xFF38) == 0x4200) {
+
+            prefetch();
+            if (S == Long) advance(2);
+            x.storeImm(S, d(ry), 0);
+            x.storeImm(Byte, offset(&reg.sr.n), 0);
+            x.storeImm(Byte, offset(&reg.sr.z), 1);
+            clearVC();
+            return true;
+        }
+
+        // SWAP Dy
+        if ((op & 0xFFF8) == 0x4840) {
+
+            x.load(Long, eax, d(ry));
+            x.swap();
+            x.regs(Long, 0x89, eax, r13);
+            prefetch();
+            x.store(Long, r13, d(ry));
+            x.regs(Long, 0x85, r13, r13);
+            setNZ();
+            clearVC();
+            return true;
+        }
+
+        // EXT Dy
+        if ((op & 0xFFB8) == 0x4880) {
+
+            Size s = (op & 0x40) ? Long : Word;
+            x.load(Long, eax, d(ry));
+            x.extend(s);
+            x.store(s, eax, d(ry));
+            x.regs(s, 0x85, eax, eax);
+            setNZ();
+            clearVC();
+            prefetch();
+            return true;
+        }
+
+        // EXG Dx,Dy / EXG Ax,Ay / EXG Dx,Ay
+        if ((op & 0xF1F8) == 0xC140 || (op & 0xF1F8) == 0xC148 || (op & 0xF1F8) == 0xC188) {
+
+            i32 src = (op & 0xF1F8) == 0xC140 ? d(ry) : a(ry);
+            i32 dst = (op & 0xF1F8) == 0xC148 ? a(rx) : d(rx);
+            x.load(Long, eax, src);
+            x.load(Long, ecx, dst);
+            x.store(Long, eax, dst);
+            x.store(Long, ecx, src);
+            prefetch();
+            advance(2);
+            return true;
+        }
+
+        return false;
+    };
+
+    size_t start = x.label();
+    x.storeImm(Long, offset(&reg.pc), pc + 2);
+    if (translate()) return true;
+
+    x.rewind(start);
+    return false;
+}
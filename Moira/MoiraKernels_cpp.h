@@ -0,0 +1,191 @@
+// -----------------------------------------------------------------------------
+// This file is part of Moira - A Motorola 68k emulator
+//
+// Copyright (C) Dirk W. Hoffmann. www.dirkwhoffmann.de
+// Licensed under the GNU General Public License v3
+//
+// See https://www.gnu.org for license information
+// -----------------------------------------------------------------------------
+
+template <class H, class C> void
+MoiraT<H, C>::mapRam(u32 addr, u32 size, u8 *mem)
+{
+    ram.push_back(RamRegion { addr, addr + size, mem });
+}
+
+template <class H, class C> u8 *
+MoiraT<H, C>::ramPtr(u32 addr, u32 size)
+{
+    for (auto &r : ram) {
+        if (addr >= r.start && addr + size <= r.end && addr + size >= addr) {
+            return r.mem + (addr - r.start);
+        }
+    }
+    return nullptr;
+}
+
+template <class H, class C> void
+MoiraT<H, C>::trackDirtyPages(int pageBits)
+{
+    if (pageBits && !C::dirtyTracking) {
+
+        printf("This feature requires TRACK_DIRTY_PAGES = true\n");
+        assert(false);
+        return;
+    }
+
+    dirty.clear();
+    dirtyBits = std::clamp(pageBits, 4, 24);
+    if (pageBits) dirty.resize(((1 << (24 - dirtyBits)) + 63) / 64);
+}
+
+template <class H, class C> void
+MoiraT<H, C>::markDirty(u32 addr, u32 size)
+{
+    u32 first = (addr & 0xFFFFFF) >> dirtyBits;
+    u32 last = ((addr + size - 1) & 0xFFFFFF) >> dirtyBits;
+
+    for (u32 page = first; ; page = (page + 1) & ((1 << (24 - dirtyBits)) - 1)) {
+
+        dirty[page >> 6] |= 1ULL << (page & 63);
+        if (page == last) break;
+    }
+}
+
+template <class H, class C> template <Instr I> void
+MoiraT<H, C>::execLoopKernel(int dn)
+{
+    /* This function is called when DBcc branches back to the instruction
+     * right in front of it. At this point, the loop counter has already been
+     * decremented and every remaining iteration consists of the loop body
+     * followed by a taken branch.
+     */
+    if constexpr (I == DBF || I == DBNE) {
+
+        // Only proceed if nothing can interfere until the next event
+        if (nextEvent == NEVER) return;
+        if (flags & (CPU_CHECK_IRQ | CPU_TRACE_FLAG | CPU_LOG_INSTRUCTION |
+                     CPU_CHECK_BP | CPU_CHECK_WP | CPU_CHECK_MAILBOX)) return;
+        if (hooked(reg.pc0 - 2) || hooked(reg.pc0)) return;
+
+        // Fetch the loop body
+        u8 *code = ramPtr(reg.pc0 - 2, 2);
+        if (!code) return;
+        u16 op = (u16)(code[0] << 8 | code[1]);
+
+        // Decode the loop body
+        enum { MOVE_LOOP, CLR_LOOP, CMPM_LOOP } kind;
+        int ax = ____xxx_________(op);
+        int ay = _____________xxx(op);
+        int size;
+
+        if ((op & 0xC1F8) == 0x00D8 && (op & 0x3000) && I == DBF && ax != ay) {
+
+            // MOVE.x (Ay)+,(Ax)+
+            kind = MOVE_LOOP;
+            size = (op & 0x3000) == 0x1000 ? 1 : (op & 0x3000) == 0x2000 ? 4 : 2;
+
+        } else if ((op & 0xFF38) == 0x4218 && (op & 0xC0) != 0xC0 && I == DBF) {
+
+            // CLR.x (Ax)+
+            kind = CLR_LOOP;
+            size = 1 << ((op >> 6) & 3);
+            ax = ay;
+
+        } else if ((op & 0xF138) == 0xB108 && (op & 0xC0) != 0xC0 && I == DBNE) {
+
+            // CMPM.x (Ay)+,(Ax)+
+            kind = CMPM_LOOP;
+            size = 1 << ((op >> 6) & 3);
+
+        } else {
+
+            return;
+        }
+
+        // A7 is always incremented by 2 in byte mode
+        if (size == 1 && (ax == 7 || (kind != CLR_LOOP && ay == 7))) return;
+
+        // Determine the duration of a single iteration by observing one
+        bool observed = loop.pc == reg.pc0 && loop.counter == (u16)(reg.d[dn] + 1);
+        i64 period = clock - loop.clock;
+        loop = KernelLoop { reg.pc0, (u16)reg.d[dn], clock };
+        if (!observed || period <= 0) return;
+
+        // Determine the number of iterations to execute in bulk
+        i64 count = (u16)reg.d[dn];
+        count = std::min(count, std::min(nextEvent - clock, (i64)INT32_MAX) / period - 1);
+        if (count <= 0) return;
+
+        u32 bytes = (u32)count * size;
+        u32 dst = reg.a[ax] & 0xFFFFFF;
+        u32 src = reg.a[ay] & 0xFFFFFF;
+
+        // Only operate on aligned memory inside a single RAM region
+        if (size > 1 && ((dst | src) & 1)) return;
+        u8 *dstPtr = ramPtr(dst, bytes);
+        u8 *srcPtr = kind == CLR_LOOP ? dstPtr : ramPtr(src, bytes);
+        if (!dstPtr || !srcPtr) return;
+
+        // Don't modify the loop itself
+        if (kind != CMPM_LOOP && dst < reg.pc0 + 4 && dst + bytes > reg.pc0 - 2) return;
+
+        u32 last = 0;
+
+        switch (kind) {
+
+            case MOVE_LOOP:
+
+                // Overlapping areas would be copied differently
+                if (dst > src && dst < src + bytes) return;
+
+                memmove(dstPtr, srcPtr, bytes);
+                for (int i = 0; i < size; i++) last = last << 8 | dstPtr[bytes - size + i];
+
+                reg.a[ay] += bytes;
+                reg.a[ax] += bytes;
+                reg.sr.n = (last >> (8 * size - 1)) & 1;
+                reg.sr.z = last == 0;
+                reg.sr.v = 0;
+                reg.sr.c = 0;
+                break;
+
+            case CLR_LOOP:
+
+                memset(dstPtr, 0, bytes);
+
+                reg.a[ax] += bytes;
+                reg.sr.n = 0;
+                reg.sr.z = 1;
+                reg.sr.v = 0;
+                reg.sr.c = 0;
+                break;
+
+            case CMPM_LOOP:
+            {
+                // Find the first element that differs
+                u32 i = 0;
+                while (i + 64 <= bytes && !memcmp(dstPtr + i, srcPtr + i, 64)) i += 64;
+                while (i < bytes && dstPtr[i] == srcPtr[i]) i++;
+
+                // Only skip the iterations that compare equal
+                count = i / size;
+                if (count == 0) return;
+                bytes = (u32)count * size;
+
+                reg.a[ay] += bytes;
+                reg.a[ax] += bytes;
+                reg.sr.n = 0;
+                reg.sr.z = 1;
+                reg.sr.v = 0;
+                reg.sr.c = 0;
+                break;
+            }
+        }
+
+        if (C::dirtyTracking && !dirty.empty() && kind != CMPM_LOOP) markDirty(dst, bytes);
+
+        writeD<Word>(dn, (u32)(readD<Word>(dn) - count));
+        advance((int)(count * period));
+    }
+}
@@ -0,0 +1,150 @@
+// -----------------------------------------------------------------------------
+// This file is part of Moira - A Motorola 68k emulator
+//
+// Copyright (C) Dirk W. Hoffmann. www.dirkwhoffmann.de
+// Licensed under the GNU General Public License v3
+//
+// See https://www.gnu.org for license information
+// -----------------------------------------------------------------------------
+
+#include "Moira.h"
+
+#include <algorithm>
+
+namespace moira {
+
+Scheduler::Scheduler(int threads)
+{
+    if (threads <= 0) threads = std::max(1, (int)std::thread::hardware_concurrency());
+
+    for (int i = 0; i < threads; i++) workers.push_back(std::make_unique<Worker>());
+    for (int i = 0; i < threads; i++) workers[i]->thread = std::thread(&Scheduler::work, this, i);
+}
+
+Scheduler::~Scheduler()
+{
+    { std::lock_guard<std::mutex> lock(mutex); shutdown = true; }
+    wakeup.notify_all();
+
+    for (auto &w : workers) w->thread.join();
+}
+
+void
+Scheduler::add(Moira *cpu, int affinity)
+{
+    tasks.push_back(std::make_unique<Task>(Task { cpu, 0, affinity }));
+}
+
+void
+Scheduler::run(i64 cycles)
+{
+    if (tasks.empty()) return;
+
+    // Distribute the CPUs among the workers
+    size_t nr = 0;
+    for (auto &t : tasks) {
+
+        t->target = t->cpu->getClock() + cycles;
+
+        if (t->affinity >= 0) {
+
+            auto &w = *workers[t->affinity % workers.size()];
+            std::lock_guard<std::mutex> lock(w.mutex);
+            w.pinned.push_back(t.get());
+
+        } else {
+
+            auto &w = *workers[nr++ % workers.size()];
+            std::lock_guard<std::mutex> lock(w.mutex);
+            w.shared.push_back(t.get());
+        }
+    }
+
+    // Wake up the workers and wait for them to finish
+    std::unique_lock<std::mutex> lock(mutex);
+    remaining = (long)tasks.size();
+    epoch++;
+    wakeup.notify_all();
+    finished.wait(lock, [&]() { return remaining == 0; });
+}
+
+void
+Scheduler::slice(Moira &cpu, i64 until)
+{
+    while (cpu.getClock() < until) cpu.execute();
+}
+
+void
+Scheduler::work(int nr)
+{
+    auto &self = *workers[nr];
+    long seen = 0;
+
+    while (true) {
+
+        // Wait for new work
+        {   std::unique_lock<std::mutex> lock(mutex);
+            wakeup.wait(lock, [&]() { return shutdown || epoch != seen; });
+            if (shutdown) return;
+            seen = epoch;
+        }
+
+        while (remaining > 0) {
+
+            auto t = next(nr);
+            if (!t) { std::this_thread::yield(); continue; }
+
+            slice(*t->cpu, std::min(t->target, t->cpu->getClock() + quantum));
+
+            if (t->cpu->getClock() >= t->target) {
+
+                // Notify run() if this has been the last unfinished CPU
+                if (--remaining == 0) {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    finished.notify_all();
+                }
+
+            } else {
+
+                // Put the CPU back at the end of the queue
+                std::lock_guard<std::mutex> lock(self.mutex);
+                (t->affinity >= 0 ? self.pinned : self.shared).push_back(t);
+            }
+        }
+    }
+}
+
+Scheduler::Task *
+Scheduler::next(int nr)
+{
+    Task *result = nullptr;
+
+    // Try to grab a task from the own queues
+    {   auto &w = *workers[nr];
+        std::lock_guard<std::mutex> lock(w.mutex);
+
+        auto &queue = !w.pinned.empty() ? w.pinned : w.shared;
+        if (!queue.empty()) {
+            result = queue.front();
+            queue.pop_front();
+            return result;
+        }
+    }
+
+    // Try to steal an unbound task from another worker
+    for (size_t i = 1; i < workers.size(); i++) {
+
+        auto &w = *workers[(nr + i) % workers.size()];
+        std::lock_guard<std::mutex> lock(w.mutex);
+
+        if (!w.shared.empty()) {
+            result = w.shared.back();
+            w.shared.pop_back();
+            return result;
+        }
+    }
+
+    return result;
+}
+
+}
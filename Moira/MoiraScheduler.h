@@ -0,0 +1,131 @@
+// -----------------------------------------------------------------------------
+// This file is part of Moira - A Motorola 68k emulator
+//
+// Copyright (C) Dirk W. Hoffmann. www.dirkwhoffmann.de
+// Licensed under the GNU General Public License v3
+//
+// See https://www.gnu.org for license information
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+#include "MoiraConfig.h"
+#include "MoiraTypes.h"
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace moira {
+
+//
+// Running many independent CPUs on a thread pool
+//
+
+class Scheduler {
+
+    // A CPU managed by the scheduler
+    struct Task {
+
+        class Moira *cpu;
+
+        // Clock value to run the CPU up to
+        i64 target;
+
+        // Worker this task is bound to (-1 = any worker)
+        int affinity;
+    };
+
+    // A thread of the pool
+    struct Worker {
+
+        std::thread thread;
+        std::mutex mutex;
+
+        // Tasks waiting to be run (may be stolen by other workers)
+        std::deque<Task *> shared;
+
+        // Tasks waiting to be run (bound to this worker)
+        std::deque<Task *> pinned;
+    };
+
+    std::vector<std::unique_ptr<Worker>> workers;
+    std::vector<std::unique_ptr<Task>> tasks;
+
+    // Synchronization between run() and the workers
+    std::mutex mutex;
+    std::condition_variable wakeup;
+    std::condition_variable finished;
+
+    // Incremented whenever run() hands out new work
+    long epoch = 0;
+
+    // Number of tasks that haven't reached their target yet
+    std::atomic<long> remaining = 0;
+
+    // Set when the scheduler is destroyed
+    bool shutdown = false;
+
+public:
+
+    // Number of cycles a CPU runs before the next one is scheduled
+    i64 quantum = 10000;
+
+
+    //
+    // Constructing
+    //
+
+public:
+
+    // Creates a pool with the specified number of threads (0 = hardware threads)
+    Scheduler(int threads = 0);
+    virtual ~Scheduler();
+
+    // Returns the number of worker threads
+    int threads() const { return (int)workers.size(); }
+
+
+    //
+    // Managing CPUs
+    //
+
+public:
+
+    // Adds a CPU, optionally bound to a specific worker thread
+    void add(class Moira *cpu, int affinity = -1);
+
+    // Removes all CPUs
+    void clear() { tasks.clear(); }
+
+
+    //
+    // Running
+    //
+
+public:
+
+    /* Advances all CPUs by the specified number of cycles and returns when
+     * all of them have reached their target. Each CPU is run in time slices
+     * of 'quantum' cycles. Idle workers steal unbound CPUs from busy ones.
+     */
+    void run(i64 cycles);
+
+protected:
+
+    // Runs a single CPU until its clock has reached the specified value
+    virtual void slice(class Moira &cpu, i64 until);
+
+private:
+
+    // The main loop of a worker thread
+    void work(int nr);
+
+    // Grabs the next task for a worker (own tasks first, then stolen ones)
+    Task *next(int nr);
+};
+
+}
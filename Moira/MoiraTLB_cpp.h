@@ -0,0 +1,76 @@
+// -----------------------------------------------------------------------------
+// This file is part of Moira - A Motorola 68k emulator
+//
+// Copyright (C) Dirk W. Hoffmann. www.dirkwhoffmann.de
+// Licensed under the GNU General Public License v3
+//
+// See https://www.gnu.org for license information
+// -----------------------------------------------------------------------------
+
+template <class H, class C> void
+MoiraT<H, C>::enableTLB(bool value)
+{
+    if (value && !C::softwareTLB) {
+
+        printf("This feature requires ENABLE_TLB = true\n");
+        assert(false);
+        return;
+    }
+
+    tlb.clear();
+    if (value) tlb.resize(TLB_SIZE);
+    flushTLB();
+}
+
+template <class H, class C> void
+MoiraT<H, C>::flushTLB()
+{
+    for (auto &e : tlb) e = TLBEntry { UINT32_MAX, UINT32_MAX, nullptr, nullptr };
+}
+
+template <class H, class C> void
+MoiraT<H, C>::flushTLB(u32 addr)
+{
+    u32 page = (addr & 0xFFFFFF) >> TLB_PAGE_BITS;
+
+    for (auto &e : tlb) {
+
+        if ((e.readTag & 0xFFF) == page) { e.readTag = UINT32_MAX; e.read = nullptr; }
+        if ((e.writeTag & 0xFFF) == page) { e.writeTag = UINT32_MAX; e.write = nullptr; }
+    }
+}
+
+template <class H, class C> template <MemSpace MS, bool write, Size S> u8 *
+MoiraT<H, C>::lookupTLB(u32 addr)
+{
+    if (!C::softwareTLB || tlb.empty()) return nullptr;
+
+    // Odd word accesses are left to the host
+    if (S != Byte && (addr & 1)) return nullptr;
+
+    // The function code is the one set up by readMS() or writeMS()
+    u32 fc = (reg.sr.s ? 4 : 0) | (MS == MEM_DATA ? FC_USER_DATA : FC_USER_PROG);
+    u32 page = (addr & 0xFFFFFF) >> TLB_PAGE_BITS;
+    u32 tag = fc << 12 | page;
+
+    auto &e = tlb[(page ^ fc << 5) & (TLB_SIZE - 1)];
+    if ((write ? e.writeTag : e.readTag) != tag) refillTLB(e, tag, write);
+
+    u8 *mem = write ? e.write : e.read;
+    return mem ? mem + (addr & ((1 << TLB_PAGE_BITS) - 1)) : nullptr;
+}
+
+template <class H, class C> void
+MoiraT<H, C>::refillTLB(TLBEntry &entry, u32 tag, bool write)
+{
+    auto fc = (FunctionCode)(tag >> 12);
+    u32 addr = (tag & 0xFFF) << TLB_PAGE_BITS;
+
+    if (write) {
+        entry.writeTag = tag;
+        entry.write = host().translate(addr, fc, true);
+    } else {
+        entry.readTag = tag;
+        entry.read = host().translate(addr, fc, false);
+    }
+}
@@ -0,0 +1,119 @@
+// -----------------------------------------------------------------------------
+// This file is part of Moira - A Motorola 68k emulator
+//
+// Copyright (C) Dirk W. Hoffmann. www.dirkwhoffmann.de
+// Licensed under the GNU General Public License v3
+//
+// See https://www.gnu.org for license information
+// -----------------------------------------------------------------------------
+
+#include "Moira.h"
+
+#include <mutex>
+
+namespace moira {
+
+/* The timing table is not maintained by hand. It is derived by running the
+ * instruction handlers on a private CPU instance that replaces the memory by a
+ * constant bit pattern and counts all bus accesses. Each opcode is executed
+ * with different operands and condition codes to uncover operand dependent
+ * execution times (e.g., MULU, DIVU, LSL Dx,Dy, MOVEM, or Bcc). The table
+ * reflects the default host behaviour, i.e., it assumes that all memory
+ * accesses complete without wait states. The probe is an ordinary instance of
+ * class Moira. Hence, it runs the handlers of the default core and doesn't add
+ * a second copy of them to the binary.
+ */
+class TimingProbe : public Moira {
+
+    // Value returned by all memory reads
+    u16 pattern = 0;
+
+public:
+
+    // Number of bus accesses performed by the probed instruction
+    int reads = 0;
+    int writes = 0;
+
+    u8 read8(u32 addr) override { reads++; return (u8)pattern; }
+    u16 read16(u32 addr) override { reads++; return pattern; }
+    void write8 (u32 addr, u8 val) override { writes++; }
+    void write16 (u32 addr, u16 val) override { writes++; }
+
+    // Executes a single instruction in supervisor mode and returns its timing
+    InstrTiming measure(u16 op, u8 ccr, u32 value, u16 data);
+};
+
+InstrTiming
+TimingProbe::measure(u16 op, u8 ccr, u32 value, u16 data)
+{
+    flags = 0;
+    ipl = reg.ipl = 0;
+
+    // Address registers are kept even to avoid address errors
+    for (int i = 0; i < 8; i++) { reg.d[i] = value; reg.a[i] = value & ~1; }
+    reg.usp = reg.ssp = value & ~1;
+    setSR(0x2700 | ccr);
+
+    reg.pc = reg.pc0 = 0x1000;
+    queue.ird = op;
+    queue.irc = data;
+
+    pattern = data;
+    reads = writes = 0;
+    clock = 0;
+
+    execute();
+
+    return InstrTiming { (u16)clock, (u16)clock, (u8)reads, (u8)writes };
+}
+
+static void
+buildTimingTable(InstrTiming *table)
+{
+    // Condition codes, register contents, and memory contents to probe with
+    static const struct { u8 ccr; u32 value; u16 data; } probes[] = {
+
+        { 0x00, 0x00000000, 0x0000 },
+        { 0x00, 0x00000000, 0x0002 },
+        { 0x1F, 0x00000000, 0x0002 },
+        { 0x08, 0x00000000, 0x0002 },
+        { 0x00, 0x0000FFFF, 0xFFFE },
+        { 0x1F, 0x0000FFFF, 0xFFFE },
+        { 0x08, 0x0000FFFF, 0xFFFE },
+        { 0x00, 0x0000FFFF, 0xFFFF }
+    };
+
+    auto probe = new TimingProbe();
+
+    for (int op = 0; op < 65536; op++) {
+
+        auto &entry = table[op];
+
+        for (size_t i = 0; i < sizeof(probes) / sizeof(probes[0]); i++) {
+
+            auto t = probe->measure((u16)op, probes[i].ccr, probes[i].value, probes[i].data);
+
+            if (i == 0) {
+                entry = t;
+            } else if (t.cycles < entry.cycles) {
+                entry = InstrTiming { t.cycles, entry.maxCycles, t.reads, t.writes };
+            } else if (t.cycles > entry.maxCycles) {
+                entry.maxCycles = t.cycles;
+            }
+        }
+    }
+
+    delete probe;
+}
+
+const InstrTiming *
+timingTable()
+{
+    static InstrTiming *table = new InstrTiming[65536];
+    static std::once_flag flag;
+
+    std::call_once(flag, buildTimingTable, table);
+    return table;
+}
+
+}
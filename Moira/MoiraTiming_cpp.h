@@ -0,0 +1,59 @@
+// -----------------------------------------------------------------------------
+// This file is part of Moira - A Motorola 68k emulator
+//
+// Copyright (C) Dirk W. Hoffmann. www.dirkwhoffmann.de
+// Licensed under the GNU General Public License v3
+//
+// See https://www.gnu.org for license information
+// -----------------------------------------------------------------------------
+
+template <class H, class C> InstrTiming
+MoiraT<H, C>::getTiming(u16 op)
+{
+    return timingTable()[op];
+}
+
+template <class H, class C> CycleEstimate
+MoiraT<H, C>::estimateCycles(u32 addr, u32 end)
+{
+    if (C::enableDasm == false) {
+
+        printf("This feature requires ENABLE_DASM = true\n");
+        assert(false);
+        return CycleEstimate { };
+    }
+
+    CycleEstimate result { };
+    char str[128];
+
+    while (addr < end) {
+
+        auto timing = getTiming(host().read16Dasm(addr));
+
+        result.cycles += timing.cycles;
+        result.maxCycles += timing.maxCycles;
+        result.reads += timing.reads;
+        result.writes += timing.writes;
+        result.count++;
+
+        addr += disassemble(addr, str);
+    }
+
+    return result;
+}
+
+template <class H, class C> void
+MoiraT<H, C>::exportTimings(FILE *file)
+{
+    fprintf(file, "opcode,instruction,mode,size,cycles,max_cycles,reads,writes\n");
+
+    for (int op = 0; op < 65536; op++) {
+
+        auto timing = getTiming((u16)op);
+        auto i = C::buildInstrInfoTable ? getInfo((u16)op) : InstrInfo { ILLEGAL, MODE_IP, (Size)0 };
+
+        fprintf(file, "%04x,%s,%d,%d,%d,%d,%d,%d\n",
+                op, instrLower[i.I], i.M, i.S,
+                timing.cycles, timing.maxCycles, timing.reads, timing.writes);
+    }
+}
@@ -207,6 +207,25 @@ typedef struct
 }
 InstrInfo;
 
+typedef struct
+{
+    u16 cycles;       // Execution time with the most favorable operands
+    u16 maxCycles;    // Execution time with the least favorable operands
+    u8  reads;        // Number of read accesses (including prefetches)
+    u8  writes;       // Number of write accesses
+}
+InstrTiming;
+
+typedef struct
+{
+    i64 cycles;       // Sum of all minimum execution times
+    i64 maxCycles;    // Sum of all maximum execution times
+    i64 reads;        // Sum of all read accesses
+    i64 writes;       // Sum of all write accesses
+    int count;        // Number of instructions
+}
+CycleEstimate;
+
 typedef enum
 {
     IRQ_AUTO,
@@ -287,6 +306,48 @@ struct PrefetchQueue {    // http://pasti.fxatari.com/68kdocs/68kPrefetch.html
     u16 ird;              // The instruction currently being executed
 };
 
+struct RamRegion {        // Memory that is directly accessible by the CPU
+
+    u32 start;            // First address of the region
+    u32 end;              // Address following the last byte of the region
+    u8 *mem;              // Region contents (in 68000 byte order)
+};
+
+struct TLBEntry {         // Cached address translations of a single page
+
+    u32 readTag;          // Function code and page of the read translation
+    u32 writeTag;         // Function code and page of the write translation
+    u8 *read;             // Page contents for reads (nullptr = use the bus)
+    u8 *write;            // Page contents for writes (nullptr = use the bus)
+};
+
+struct DasmCacheEntry {   // A cached disassembler result
+
+    u32 addr;             // Address of the instruction (UINT32_MAX = empty)
+    u16 words[8];         // Instruction words the result was derived from
+    u8 size;              // Instruction size in bytes
+    char str[107];        // Disassembled instruction
+};
+
+struct IdleLoop {         // Observed by the idle loop detector
+
+    u32 pc;               // Address of the branch instruction closing the loop
+    i64 clock;            // Clock at the time the branch was taken
+    u32 r[16];            // D0 ... D7, A0 ... A7 at the time the branch was taken
+    u32 usp;              // User Stack Pointer at the time the branch was taken
+    u32 ssp;              // Supervisor Stack Pointer at the time the branch was taken
+    u16 sr;               // Status register at the time the branch was taken
+    long reads;           // Number of data reads in the current iteration
+    bool clean;           // True if the current iteration has no side effects
+};
+
+struct KernelLoop {       // Observed by the loop kernels
+
+    u32 pc;               // Address of the DBcc instruction closing the loop
+    u16 counter;          // Loop counter at the time the branch was taken
+    i64 clock;            // Clock at the time the branch was taken
+};
+
 /* Execution flags
  *
  * The Motorola 68000 is a well organized processor that utilizes the same
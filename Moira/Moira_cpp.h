@@ -0,0 +1,642 @@
+// -----------------------------------------------------------------------------
+// This file is part of Moira - A Motorola 68k emulator
+//
+// Copyright (C) Dirk W. Hoffmann. www.dirkwhoffmann.de
+// Licensed under the GNU General Public License v3
+//
+// See https://www.gnu.org for license information
+// -----------------------------------------------------------------------------
+
+template <class H, class C> typename MoiraT<H, C>::ExecPtr MoiraT<H, C>::exec[65536];
+template <class H, class C> typename MoiraT<H, C>::DasmPtr *MoiraT<H, C>::dasm = nullptr;
+template <class H, class C> InstrInfo *MoiraT<H, C>::info = nullptr;
+
+template <class H, class C>
+MoiraT<H, C>::MoiraT()
+{
+    // The tables are read-only after creation and shared by all instances
+    static std::once_flag once;
+
+    std::call_once(once, []() {
+
+        if (C::buildInstrInfoTable || C::enableDasm) info = new InstrInfo[65536];
+        if (C::enableDasm) dasm = new DasmPtr[dasmEntries];
+
+        createJumpTables();
+    });
+}
+
+template <class H, class C>
+MoiraT<H, C>::~MoiraT()
+{
+}
+
+template <class H, class C> void
+MoiraT<H, C>::reset()
+{
+    i64 start = clock;
+
+    flags = CPU_CHECK_IRQ | (useMailbox ? CPU_CHECK_MAILBOX : 0);
+
+    for(int i = 0; i < 8; i++) reg.d[i] = reg.a[i] = 0;
+    reg.usp = 0;
+    reg.ipl = 0;
+    ipl = 0;
+    fcl = 0;
+    
+    reg.sr.t = 0;
+    reg.sr.s = 1;
+    reg.sr.x = 0;
+    reg.sr.n = 0;
+    reg.sr.z = 0;
+    reg.sr.v = 0;
+    reg.sr.c = 0;
+    reg.sr.ipl = 7;
+
+    advance(16);
+
+    // Read the initial (supervisor) stack pointer from memory
+    advance(2);
+    reg.sp = host().read16OnReset(0);
+    advance(4);
+    reg.ssp = reg.sp = (host().read16OnReset(2) & ~0x1) | reg.sp << 16;
+    advance(4);
+    reg.pc = host().read16OnReset(4);
+    advance(4);
+    reg.pc = (host().read16OnReset(6) & ~0x1) | reg.pc << 16;
+
+    // Fill the prefetch queue
+    advance(4);
+    queue.irc = host().read16OnReset(reg.pc & 0xFFFFFF);
+    advance(2);
+    prefetch();
+    
+    if constexpr (C::enableDebugger) debugger.reset();
+
+    if (!preciseTiming) chargeCycles(start);
+}
+
+template <class H, class C> void
+MoiraT<H, C>::execute()
+{
+    if (preciseTiming) {
+
+        executeNext();
+
+    } else {
+
+        i64 start = clock;
+        executeNext();
+        chargeCycles(start);
+    }
+}
+
+template <class H, class C> void
+MoiraT<H, C>::chargeCycles(i64 start)
+{
+    i64 elapsed = clock - start;
+    clock = start;
+
+    // Report all cycles in a single call (or a few if the CPU has skipped ahead)
+    for (; elapsed > INT32_MAX; elapsed -= INT32_MAX) host().sync(INT32_MAX);
+    host().sync((int)elapsed);
+}
+
+template <class H, class C> inline void
+MoiraT<H, C>::executeNext()
+{
+    // Check the integrity of the CPU flags
+    if (reg.ipl > reg.sr.ipl || reg.ipl == 7) assert(flags & CPU_CHECK_IRQ);
+    assert(!!(flags & CPU_TRACE_FLAG) == reg.sr.t);
+
+    // Check the integrity of the program counter
+    assert(reg.pc0 == reg.pc);
+    
+    //
+    // The quick execution path: Call the instruction handler and return
+    //
+
+    if (!flags) {
+
+        if (hooked(reg.pc) && execHook()) return;
+
+        reg.pc += 2;
+        (this->*exec[queue.ird])(queue.ird);
+        assert(reg.pc0 == reg.pc);
+        return;
+    }
+
+    //
+    // The slow execution path: Process flags one by one
+    //
+
+    // Only continue if the CPU is not halted
+    if (flags & CPU_IS_HALTED) {
+        advance(2);
+        return;
+    }
+
+    // Stop observing loops that are too long to be idle loops
+    if ((flags & CPU_TRACK_IDLE) && clock - idle.clock > 512) {
+        flags &= ~CPU_TRACK_IDLE;
+    }
+
+    // Take over the interrupt levels asserted by other threads
+    if (flags & CPU_CHECK_MAILBOX) {
+        setIPL((u8)std::bit_width((unsigned)(mailbox.load(std::memory_order_acquire) >> 1)));
+    }
+        
+    // Process pending trace exception (if any)
+    if (flags & CPU_TRACE_EXCEPTION) {
+        execTraceException();
+        goto done;
+    }
+
+    // Check if the T flag is set inside the status register
+    if ((flags & CPU_TRACE_FLAG) && !(flags & CPU_IS_STOPPED)) {
+        flags |= CPU_TRACE_EXCEPTION;
+    }
+
+    // Process pending interrupt (if any)
+    if (flags & CPU_CHECK_IRQ) {
+        if (checkForIrq()) goto done;
+    }
+
+    // If the CPU is stopped, poll the IPL lines and return
+    if (flags & CPU_IS_STOPPED) {
+        
+        // Initiate a privilege exception if the supervisor bit is cleared
+        if (!reg.sr.s) {
+            advance(4);
+            reg.pc -= 2;
+            flags &= ~CPU_IS_STOPPED;
+            execPrivilegeException();
+            return;
+        }
+        
+        pollIpl();
+
+        /* If the IPL pins are stable until the next event, all polls up to the
+         * event produce the same result. In this case, the clock is advanced
+         * to the first poll at or after the event in one step.
+         */
+        i64 step = C::mimicMusashi ? 1 : 2;
+        if (nextEvent != NEVER && clock + step < nextEvent && !(flags & (CPU_CHECK_IRQ | CPU_CHECK_MAILBOX))) {
+
+            i64 cycles = (nextEvent - clock + step - 1) / step * step;
+            advance((int)std::min(cycles, (i64)(INT32_MAX - 1)));
+
+        } else {
+
+            advance((int)step);
+        }
+        return;
+    }
+
+    // If logging is enabled, record the executed instruction
+    if constexpr (C::enableDebugger) {
+        if (flags & CPU_LOG_INSTRUCTION) debugger.logInstruction();
+    }
+
+    // Call the PC hook (if any)
+    if (hooked(reg.pc) && execHook()) goto done;
+
+    // Execute the instruction
+    reg.pc += 2;
+    (this->*exec[queue.ird])(queue.ird);
+    assert(reg.pc0 == reg.pc);
+
+done:
+    
+    // Check if a breakpoint has been reached
+    if constexpr (C::enableDebugger) if (flags & CPU_CHECK_BP) {
+        
+        // Don't break if the instruction won't be executed due to tracing
+        if (flags & CPU_TRACE_EXCEPTION) return;
+        
+        // Check if a softstop has been reached
+        if (debugger.softstopMatches(reg.pc0)) host().softstopReached(reg.pc0);
+            
+        // Check if a breakpoint has been reached
+        if (debugger.breakpointMatches(reg.pc0)) host().breakpointReached(reg.pc0);
+    }
+}
+
+template <class H, class C> bool
+MoiraT<H, C>::checkForIrq()
+{
+    if (reg.ipl > reg.sr.ipl || reg.ipl == 7) {
+
+        // Trigger interrupt
+        execIrqException(reg.ipl);
+        return true;
+
+    } else {
+
+        // If the polled IPL is up to date, we disable interrupt checking for
+        // the time being, because no interrupt can occur as long as the
+        // external IPL or the IPL mask inside the status register keep the
+        // same. If one of these variables changes, we reenable interrupt
+        // checking.
+        if (reg.ipl == ipl) flags &= ~CPU_CHECK_IRQ;
+        return false;
+    }
+}
+
+template <class H, class C> void
+MoiraT<H, C>::halt()
+{    
+    // Halt the CPU
+    flags |= CPU_IS_HALTED;
+    reg.pc = reg.pc0;
+
+    // Inform the delegate
+    host().signalHalt();
+}
+
+template <class H, class C> void
+MoiraT<H, C>::jump(u32 addr)
+{
+    reg.pc = addr;
+    fullPrefetch<POLLIPL>();
+}
+
+template <class H, class C> template<Size S> u32
+MoiraT<H, C>::readD(int n) const
+{
+    return CLIP<S>(reg.d[n]);
+}
+
+template <class H, class C> template<Size S> u32
+MoiraT<H, C>::readA(int n) const
+{
+    return CLIP<S>(reg.a[n]);
+}
+
+template <class H, class C> template<Size S> u32
+MoiraT<H, C>::readR(int n) const
+{
+    return CLIP<S>(reg.r[n]);
+}
+
+template <class H, class C> template<Size S> void
+MoiraT<H, C>::writeD(int n, u32 v)
+{
+    reg.d[n] = WRITE<S>(reg.d[n], v);
+}
+
+template <class H, class C> template<Size S> void
+MoiraT<H, C>::writeA(int n, u32 v)
+{
+    reg.a[n] = WRITE<S>(reg.a[n], v);
+}
+
+template <class H, class C> template<Size S> void
+MoiraT<H, C>::writeR(int n, u32 v)
+{
+    reg.r[n] = WRITE<S>(reg.r[n], v);
+}
+
+template <class H, class C> u8
+MoiraT<H, C>::getCCR(const StatusRegister &sr) const
+{
+    return (u8)(sr.c << 0 | sr.v << 1 | sr.z << 2 | sr.n << 3 | sr.x << 4);
+}
+
+template <class H, class C> void
+MoiraT<H, C>::setCCR(u8 val)
+{
+    reg.sr.c = (val >> 0) & 1;
+    reg.sr.v = (val >> 1) & 1;
+    reg.sr.z = (val >> 2) & 1;
+    reg.sr.n = (val >> 3) & 1;
+    reg.sr.x = (val >> 4) & 1;
+}
+
+template <class H, class C> u16
+MoiraT<H, C>::getSR(const StatusRegister &sr) const
+{
+    return (u16)(sr.t << 15 | sr.s << 13 | sr.ipl << 8 | getCCR());
+}
+
+template <class H, class C> void
+MoiraT<H, C>::setSR(u16 val)
+{
+    bool t = (val >> 15) & 1;
+    bool s = (val >> 13) & 1;
+    u8 ipl = (val >>  8) & 7;
+
+    reg.sr.ipl = ipl;
+    flags |= CPU_CHECK_IRQ;
+    t ? setTraceFlag() : clearTraceFlag();
+
+    setCCR((u8)val);
+    setSupervisorMode(s);
+}
+
+template <class H, class C> void
+MoiraT<H, C>::setSupervisorMode(bool enable)
+{
+    if (reg.sr.s == enable) return;
+
+    if (enable) {
+        reg.sr.s = 1;
+        reg.usp = reg.a[7];
+        reg.a[7] = reg.ssp;
+    } else {
+        reg.sr.s = 0;
+        reg.ssp = reg.a[7];
+        reg.a[7] = reg.usp;
+    }
+}
+
+template <class H, class C> void
+MoiraT<H, C>::setFC(FunctionCode value)
+{
+    if (!C::emulateFC) return;
+    fcl = (u8)value;
+}
+
+template <class H, class C> template<Mode M> void
+MoiraT<H, C>::setFC()
+{
+    if (!C::emulateFC) return;
+    fcl = (M == MODE_DIPC || M == MODE_IXPC) ? FC_USER_PROG : FC_USER_DATA;
+}
+
+template <class H, class C> void
+MoiraT<H, C>::setIPL(u8 val)
+{
+    if (ipl != val) {
+        ipl = val;
+        flags |= CPU_CHECK_IRQ;
+    }
+}
+
+template <class H, class C> void
+MoiraT<H, C>::enableMailbox(bool value)
+{
+    useMailbox = value;
+
+    if (value) {
+        flags |= CPU_CHECK_MAILBOX;
+    } else {
+        flags &= ~CPU_CHECK_MAILBOX;
+    }
+}
+
+template <class H, class C> void
+MoiraT<H, C>::enableFusion(bool value)
+{
+    if (value && !C::fusion) {
+
+        printf("This feature requires ENABLE_FUSION = true\n");
+        assert(false);
+        return;
+    }
+
+    fusion = value;
+}
+
+template <class H, class C> void
+MoiraT<H, C>::enableIdleDetection(bool value)
+{
+    detectIdle = value;
+    flags &= ~CPU_TRACK_IDLE;
+}
+
+template <class H, class C> void
+MoiraT<H, C>::detectIdleLoop(int counter)
+{
+    // Only skip loops if nothing can happen until the next event
+    if (nextEvent == NEVER) return;
+    if (flags & (CPU_CHECK_IRQ | CPU_LOG_INSTRUCTION | CPU_CHECK_BP | CPU_CHECK_WP | CPU_CHECK_MAILBOX)) {
+        flags &= ~CPU_TRACK_IDLE;
+        return;
+    }
+
+    // Check if a full iteration of this loop has been observed
+    if ((flags & CPU_TRACK_IDLE) && idle.pc == reg.pc0 && idle.clean) {
+
+        bool same =
+        reg.usp == idle.usp && reg.ssp == idle.ssp && getSR() == idle.sr;
+
+        for (int i = 0; i < 16 && same; i++) {
+
+            if (i == counter) {
+
+                // The loop counter must have been decremented by one
+                same =
+                (reg.r[i] & 0xFFFF0000) == (idle.r[i] & 0xFFFF0000) &&
+                (u16)reg.r[i] == (u16)(idle.r[i] - 1) && idle.reads == 0;
+
+            } else {
+
+                same = reg.r[i] == idle.r[i];
+            }
+        }
+
+        if (same) {
+
+            // Skip all iterations but the one right before the next event
+            i64 period = clock - idle.clock;
+            i64 skip = std::min(nextEvent - clock, (i64)INT32_MAX) / period - 1;
+
+            // Don't skip beyond the end of a DBcc loop
+            if (counter >= 0) skip = std::min(skip, (i64)(u16)reg.r[counter] - 1);
+
+            if (skip > 0) {
+
+                advance((int)(skip * period));
+                if (counter >= 0) writeD<Word>(counter, (u32)(readD<Word>(counter) - skip));
+            }
+        }
+    }
+
+    // Start observing the next iteration
+    idle.pc = reg.pc0;
+    idle.clock = clock;
+    for (int i = 0; i < 16; i++) idle.r[i] = reg.r[i];
+    idle.usp = reg.usp;
+    idle.ssp = reg.ssp;
+    idle.sr = getSR();
+    idle.reads = 0;
+    idle.clean = true;
+    flags |= CPU_TRACK_IDLE;
+}
+
+template <class H, class C> u16
+MoiraT<H, C>::getIrqVector(u8 level) const {
+
+    assert(level < 8);
+
+    switch (irqMode) {
+
+        case IRQ_AUTO:          return 24 + level;
+        case IRQ_USER:          return host().readIrqUserVector(level) & 0xFF;
+        case IRQ_SPURIOUS:      return 24;
+        case IRQ_UNINITIALIZED: return 15;
+    }
+
+    assert(false);
+    return 0;
+}
+
+template <class H, class C> int
+MoiraT<H, C>::disassemble(u32 addr, char *str)
+{
+    if constexpr (!C::enableDasm) {
+
+        printf("This feature requires ENABLE_DASM = true\n");
+        assert(false);
+        return 0;
+    }
+
+    // Check if the instruction is cached
+    if (!dasmCache.empty()) {
+
+        if (auto entry = lookupDasmCache(addr)) {
+
+            strcpy(str, entry->str);
+            return entry->size;
+        }
+    }
+
+    u32 pc     = addr;
+    u16 opcode = host().read16Dasm(pc);
+    auto &i    = info[opcode];
+
+    StrWriter writer(str, hex, upper);
+
+    (this->*dasm[dasmIndex(i.I, i.M, i.S)])(writer, pc, opcode);
+    writer << Finish{};
+
+    int size = pc - addr + 2;
+    if (!dasmCache.empty()) updateDasmCache(addr, size, str);
+
+    return size;
+}
+
+template <class H, class C> void
+MoiraT<H, C>::enableDasmCache(bool value)
+{
+    dasmCache.clear();
+    if (value) dasmCache.resize(DASM_CACHE_SIZE);
+    flushDasmCache();
+}
+
+template <class H, class C> void
+MoiraT<H, C>::flushDasmCache()
+{
+    for (auto &e : dasmCache) { e.addr = UINT32_MAX; e.size = 0; }
+}
+
+template <class H, class C> const DasmCacheEntry *
+MoiraT<H, C>::lookupDasmCache(u32 addr)
+{
+    auto &e = dasmCache[(addr >> 1) & (DASM_CACHE_SIZE - 1)];
+    if (e.addr != addr) return nullptr;
+
+    // Make sure that the instruction hasn't been modified
+    for (int i = 0; i < e.size / 2; i++) {
+        if (host().read16Dasm(U32_ADD(addr, 2 * i)) != e.words[i]) return nullptr;
+    }
+    return &e;
+}
+
+template <class H, class C> void
+MoiraT<H, C>::updateDasmCache(u32 addr, int size, const char *str)
+{
+    auto &e = dasmCache[(addr >> 1) & (DASM_CACHE_SIZE - 1)];
+    auto len = strlen(str);
+
+    // Skip results that don't fit into an entry
+    if (size > (int)sizeof(e.words) || len >= sizeof(e.str)) return;
+
+    for (int i = 0; i < size / 2; i++) e.words[i] = host().read16Dasm(U32_ADD(addr, 2 * i));
+    memcpy(e.str, str, len + 1);
+    e.size = (u8)size;
+    e.addr = addr;
+}
+
+template <class H, class C> void
+MoiraT<H, C>::disassembleWord(u32 value, char *str)
+{
+    sprintx(str, value, true, 0, 4); // Upper case, no '$' prefix, 4 digits
+}
+
+template <class H, class C> void
+MoiraT<H, C>::disassembleMemory(u32 addr, int cnt, char *str)
+{
+    U32_DEC(addr, 2); // Because dasmRead increases addr first
+    for (int i = 0; i < cnt; i++) {
+        u32 value = dasmRead<Word>(addr);
+        sprintx(str, value, true, 0, 4);
+        *str++ = (i == cnt - 1) ? 0 : ' ';
+    }
+}
+
+template <class H, class C> void
+MoiraT<H, C>::disassemblePC(u32 pc, char *str)
+{
+    sprintx(str, pc, true, 0, 6); // Upper case, no '$' prefix, 6 digits
+}
+
+template <class H, class C> void
+MoiraT<H, C>::disassembleSR(const StatusRegister &sr, char *str)
+{
+    str[0]  = sr.t ? 'T' : 't';
+    str[1]  = '-';
+    str[2]  = sr.s ? 'S' : 's';
+    str[3]  = '-';
+    str[4]  = '-';
+    str[5]  = (sr.ipl & 0b100) ? '1' : '0';
+    str[6]  = (sr.ipl & 0b010) ? '1' : '0';
+    str[7]  = (sr.ipl & 0b001) ? '1' : '0';
+    str[8]  = '-';
+    str[9]  = '-';
+    str[10] = '-';
+    str[11] = sr.x ? 'X' : 'x';
+    str[12] = sr.n ? 'N' : 'n';
+    str[13] = sr.z ? 'Z' : 'z';
+    str[14] = sr.v ? 'V' : 'v';
+    str[15] = sr.c ? 'C' : 'c';
+    str[16] = 0;
+}
+
+/*
+template <class H, class C> void
+MoiraT<H, C>::disassembleSR(u16 sr, char *str)
+{
+    str[0]  = (sr & 0b1000000000000000) ? 'T' : 't';
+    str[1]  = '-';
+    str[2]  = (sr & 0b0010000000000000) ? 'S' : 's';
+    str[3]  = '-';
+    str[4]  = '-';
+    str[5]  = (sr & 0b0000010000000000) ? '1' : '0';
+    str[6]  = (sr & 0b0000001000000000) ? '1' : '0';
+    str[7]  = (sr & 0b0000000100000000) ? '1' : '0';
+    str[8]  = '-';
+    str[9]  = '-';
+    str[10] = '-';
+    str[11] = (sr & 0b0000000000010000) ? 'X' : 'x';
+    str[12] = (sr & 0b0000000000001000) ? 'N' : 'n';
+    str[13] = (sr & 0b0000000000000100) ? 'Z' : 'z';
+    str[14] = (sr & 0b0000000000000010) ? 'V' : 'v';
+    str[15] = (sr & 0b0000000000000001) ? 'C' : 'c';
+    str[16] = 0;
+}
+*/
+
+template <class H, class C> InstrInfo
+MoiraT<H, C>::getInfo(u16 op)
+{
+    if (C::buildInstrInfoTable == false) {
+
+        printf("This feature requires BUILD_INSTR_INFO_TABLE = true\n");
+        assert(false);
+        return InstrInfo { ILLEGAL, MODE_IP, (Size)0 };
+    }
+        
+    return info[op];    
+}
@@ -9,7 +9,7 @@
 
 #pragma once
 
-#include <cmath>
+#include <bit>
 
 namespace moira {
 
@@ -7,8 +7,6 @@
 // See https://www.gnu.org for license information
 // -----------------------------------------------------------------------------
 
-#include <cmath>
-
 static const char *instrLower[]
 {
     "???",   "???",   "???",
@@ -63,17 +61,63 @@ static const char *instrUpper[]
     "TAS",   "TRAP",  "TRAPV", "TST",   "UNLK"
 };
 
-static int decDigits(u64 value) { return value ? 1 + (int)log10(value) : 1; }
-static int binDigits(u64 value) { return value ? 1 + (int)log2(value) : 1; }
+static const char *hexLower = "0123456789abcdef";
+static const char *hexUpper = "0123456789ABCDEF";
+
+// Two-digit decimal table ("00", "01", ..., "99")
+static const char decPairs[] =
+"0001020304050607080910111213141516171819"
+"2021222324252627282930313233343536373839"
+"4041424344454647484950515253545556575859"
+"6061626364656667686970717273747576777879"
+"8081828384858687888990919293949596979899";
+
+// Powers of ten (used by decDigits to correct the estimated digit count)
+static const u64 pow10[]
+{
+    1ULL,
+    10ULL,
+    100ULL,
+    1000ULL,
+    10000ULL,
+    100000ULL,
+    1000000ULL,
+    10000000ULL,
+    100000000ULL,
+    1000000000ULL,
+    10000000000ULL,
+    100000000000ULL,
+    1000000000000ULL,
+    10000000000000ULL,
+    100000000000000ULL,
+    1000000000000000ULL,
+    10000000000000000ULL,
+    100000000000000000ULL,
+    1000000000000000000ULL,
+    10000000000000000000ULL
+};
+
+static int binDigits(u64 value) { return value ? 64 - std::countl_zero(value) : 1; }
 static int hexDigits(u64 value) { return (binDigits(value) + 3) / 4; }
+static int decDigits(u64 value)
+{
+    // Estimate the number of digits via log10(2) ~ 1233 / 4096
+    int digits = (binDigits(value) * 1233) >> 12;
+    return value >= pow10[digits] ? digits + 1 : (digits ? digits : 1);
+}
 
 static void sprintd(char *&s, u64 value, int digits)
 {
-    for (int i = digits - 1; i >= 0; i--) {
-        u8 digit = value % 10;
-        s[i] = '0' + digit;
-        value /= 10;
+    int i = digits;
+
+    // Emit two digits at a time
+    for (; i >= 2; i -= 2) {
+        const char *pair = decPairs + 2 * (value % 100);
+        s[i - 1] = pair[1];
+        s[i - 2] = pair[0];
+        value /= 100;
     }
+    if (i) s[0] = '0' + (char)(value % 10);
     s += digits;
 }
 
@@ -90,13 +134,12 @@ static void sprintd_signed(char *&s, i64 value)
 
 static void sprintx(char *&s, u64 value, bool upper, char prefix, int digits)
 {
-    char a = (upper ? 'A' : 'a') - 10;
+    const char *table = upper ? hexUpper : hexLower;
 
     if (prefix) *s++ = prefix;
     for (int i = digits - 1; i >= 0; i--) {
-        char digit = (char)(value % 16);
-        s[i] = (digit <= 9) ? ('0' + digit) : (a + digit);
-        value /= 16;
+        s[i] = table[value & 0xF];
+        value >>= 4;
     }
     s += digits;
 }
@@ -112,56 +155,56 @@ static void sprintx_signed(char *&s, i64 value, bool upper, char prefix)
     sprintx(s, value, upper, prefix, hexDigits(value));
 }
 
-StrWriter&
+inline StrWriter&
 StrWriter::operator<<(const char *str)
 {
     while (*str) { *ptr++ = *str++; };
     return *this;
 }
 
-StrWriter&
+inline StrWriter&
 StrWriter::operator<<(int value)
 {
     sprintd(ptr, value);
     return *this;
 }
 
-StrWriter&
+inline StrWriter&
 StrWriter::operator<<(Int i)
 {
     hex ? sprintx_signed(ptr, i.raw, upper, '$') : sprintd_signed(ptr, i.raw);
     return *this;
 }
 
-StrWriter&
+inline StrWriter&
 StrWriter::operator<<(UInt u)
 {
     hex ? sprintx(ptr, u.raw, upper, '$') : sprintd(ptr, u.raw);
     return *this;
 }
 
-StrWriter&
+inline StrWriter&
 StrWriter::operator<<(UInt8 u)
 {
     hex ? sprintx(ptr, u.raw, upper, '$', 2) : sprintd(ptr, u.raw, 3);
     return *this;
 }
 
-StrWriter&
+inline StrWriter&
 StrWriter::operator<<(UInt16 u)
 {
     hex ? sprintx(ptr, u.raw, upper, '$', 4) : sprintd(ptr, u.raw, 5);
     return *this;
 }
 
-StrWriter&
+inline StrWriter&
 StrWriter::operator<<(UInt32 u)
 {
     hex ? sprintx(ptr, u.raw, upper, '$', 8) : sprintd(ptr, u.raw, 10);
     return *this;
 }
 
-StrWriter&
+inline StrWriter&
 StrWriter::operator<<(Dn dn)
 {
     *ptr++ = 'D';
@@ -169,7 +212,7 @@ StrWriter::operator<<(Dn dn)
     return *this;
 }
 
-StrWriter&
+inline StrWriter&
 StrWriter::operator<<(An an)
 {
     *ptr++ = 'A';
@@ -177,7 +220,7 @@ StrWriter::operator<<(An an)
     return *this;
 }
 
-StrWriter&
+inline StrWriter&
 StrWriter::operator<<(Rn rn)
 {
     if (rn.raw < 8) {
@@ -188,7 +231,7 @@ StrWriter::operator<<(Rn rn)
     return *this;
 }
 
-StrWriter&
+inline StrWriter&
 StrWriter::operator<<(Imu im)
 {
     *ptr++ = '#';
@@ -196,7 +239,7 @@ StrWriter::operator<<(Imu im)
     return *this;
 }
 
-StrWriter&
+inline StrWriter&
 StrWriter::operator<<(Ims im)
 {
     *ptr++ = '#';
@@ -204,7 +247,7 @@ StrWriter::operator<<(Ims im)
     return *this;
 }
 
-StrWriter&
+inline StrWriter&
 StrWriter::operator<<(Imd im)
 {
     *ptr++ = '#';
@@ -212,7 +255,7 @@ StrWriter::operator<<(Imd im)
     return *this;
 }
 
-StrWriter&
+inline StrWriter&
 StrWriter::operator<<(Scale s)
 {
     if (s.raw) {
@@ -222,14 +265,14 @@ StrWriter::operator<<(Scale s)
     return *this;
 }
 
-StrWriter&
+inline StrWriter&
 StrWriter::operator<<(Align align)
 {
     while (ptr < base + align.raw) *ptr++ = ' ';
     return *this;
 }
 
-StrWriter&
+inline StrWriter&
 StrWriter::operator<<(RegList l)
 {
     int r[16];
@@ -261,7 +304,7 @@ StrWriter::operator<<(RegList l)
     return *this;
 }
 
-StrWriter&
+inline StrWriter&
 StrWriter::operator<<(RegRegList l)
 {
     u16 regsD = l.raw & 0x00FF;
@@ -366,7 +409,7 @@ StrWriter::operator<<(const Ea<M,S> &ea)
     return *this;
 }
 
-StrWriter&
+inline StrWriter&
 StrWriter::operator<<(Finish)
 {
     for (int i = 0; comment[i] != 0; i++) *ptr++ = comment[i];
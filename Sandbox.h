@@ -52,6 +52,7 @@ public:
     Sandbox(); 
     void prepare();
     long getErrors() { return errors; }
+    int getRecords() { return recordCnt; }
     void record(AccessType type, u32 addr, u64 cycle, u32 fc, u16 value);
     void recordPoll(u64 cycle, u32 fc, u8 value);
     u32  replayPeek(AccessType type, u32 addr, u64 cycle, u32 fc);
@@ -117,3 +117,11 @@ TestCPU::breakpointReached(moira::u32 addr) { }
  */
 void
 TestCPU::watchpointReached(moira::u32 addr) { }
+
+/* Exception handler
+ *
+ * Moira calls this function when the CPU jumps to an exception vector. The
+ * vector number is recorded as a coverage feature of the tested instruction.
+ */
+void
+TestCPU::signalJumpToVector(int nr, u32 addr) { coverage.recordVector(nr); }
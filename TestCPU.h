@@ -26,6 +26,7 @@ class TestCPU : public Moira {
     u16 readIrqUserVector(u8 level) const override;
     void breakpointReached(u32 addr) override;
     void watchpointReached(u32 addr) override;
+    void signalJumpToVector(int nr, u32 addr) override;
 };
 
 #endif
@@ -0,0 +1,26 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/Coverage.cpp" "CMakeFiles/testRunner.dir/Coverage.cpp.o" "gcc" "CMakeFiles/testRunner.dir/Coverage.cpp.o.d"
+  "/root/repo/Sandbox.cpp" "CMakeFiles/testRunner.dir/Sandbox.cpp.o" "gcc" "CMakeFiles/testRunner.dir/Sandbox.cpp.o.d"
+  "/root/repo/TestCPU.cpp" "CMakeFiles/testRunner.dir/TestCPU.cpp.o" "gcc" "CMakeFiles/testRunner.dir/TestCPU.cpp.o.d"
+  "/root/repo/main.cpp" "CMakeFiles/testRunner.dir/main.cpp.o" "gcc" "CMakeFiles/testRunner.dir/main.cpp.o.d"
+  "/root/repo/musashi.cpp" "CMakeFiles/testRunner.dir/musashi.cpp.o" "gcc" "CMakeFiles/testRunner.dir/musashi.cpp.o.d"
+  "/root/repo/testrunner.cpp" "CMakeFiles/testRunner.dir/testrunner.cpp.o" "gcc" "CMakeFiles/testRunner.dir/testrunner.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_fast/Moira/CMakeFiles/moira.dir/DependInfo.cmake"
+  "/root/repo/_fast/Musashi/CMakeFiles/musashi.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,21 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testRunner.dir/Coverage.cpp.o"
+  "CMakeFiles/testRunner.dir/Coverage.cpp.o.d"
+  "CMakeFiles/testRunner.dir/Sandbox.cpp.o"
+  "CMakeFiles/testRunner.dir/Sandbox.cpp.o.d"
+  "CMakeFiles/testRunner.dir/TestCPU.cpp.o"
+  "CMakeFiles/testRunner.dir/TestCPU.cpp.o.d"
+  "CMakeFiles/testRunner.dir/main.cpp.o"
+  "CMakeFiles/testRunner.dir/main.cpp.o.d"
+  "CMakeFiles/testRunner.dir/musashi.cpp.o"
+  "CMakeFiles/testRunner.dir/musashi.cpp.o.d"
+  "CMakeFiles/testRunner.dir/testrunner.cpp.o"
+  "CMakeFiles/testRunner.dir/testrunner.cpp.o.d"
+  "testRunner"
+  "testRunner.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testRunner.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,32 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/Moira/Moira.cpp" "Moira/CMakeFiles/moira.dir/Moira.cpp.o" "gcc" "Moira/CMakeFiles/moira.dir/Moira.cpp.o.d"
+  "/root/repo/Moira/MoiraAnalyzer.cpp" "Moira/CMakeFiles/moira.dir/MoiraAnalyzer.cpp.o" "gcc" "Moira/CMakeFiles/moira.dir/MoiraAnalyzer.cpp.o.d"
+  "/root/repo/Moira/MoiraDebugger.cpp" "Moira/CMakeFiles/moira.dir/MoiraDebugger.cpp.o" "gcc" "Moira/CMakeFiles/moira.dir/MoiraDebugger.cpp.o.d"
+  "/root/repo/Moira/MoiraGroup0.cpp" "Moira/CMakeFiles/moira.dir/MoiraGroup0.cpp.o" "gcc" "Moira/CMakeFiles/moira.dir/MoiraGroup0.cpp.o.d"
+  "/root/repo/Moira/MoiraGroup1.cpp" "Moira/CMakeFiles/moira.dir/MoiraGroup1.cpp.o" "gcc" "Moira/CMakeFiles/moira.dir/MoiraGroup1.cpp.o.d"
+  "/root/repo/Moira/MoiraGroup2.cpp" "Moira/CMakeFiles/moira.dir/MoiraGroup2.cpp.o" "gcc" "Moira/CMakeFiles/moira.dir/MoiraGroup2.cpp.o.d"
+  "/root/repo/Moira/MoiraGroup3.cpp" "Moira/CMakeFiles/moira.dir/MoiraGroup3.cpp.o" "gcc" "Moira/CMakeFiles/moira.dir/MoiraGroup3.cpp.o.d"
+  "/root/repo/Moira/MoiraGroup4.cpp" "Moira/CMakeFiles/moira.dir/MoiraGroup4.cpp.o" "gcc" "Moira/CMakeFiles/moira.dir/MoiraGroup4.cpp.o.d"
+  "/root/repo/Moira/MoiraGroup5.cpp" "Moira/CMakeFiles/moira.dir/MoiraGroup5.cpp.o" "gcc" "Moira/CMakeFiles/moira.dir/MoiraGroup5.cpp.o.d"
+  "/root/repo/Moira/MoiraGroup6.cpp" "Moira/CMakeFiles/moira.dir/MoiraGroup6.cpp.o" "gcc" "Moira/CMakeFiles/moira.dir/MoiraGroup6.cpp.o.d"
+  "/root/repo/Moira/MoiraGroup7.cpp" "Moira/CMakeFiles/moira.dir/MoiraGroup7.cpp.o" "gcc" "Moira/CMakeFiles/moira.dir/MoiraGroup7.cpp.o.d"
+  "/root/repo/Moira/MoiraJit.cpp" "Moira/CMakeFiles/moira.dir/MoiraJit.cpp.o" "gcc" "Moira/CMakeFiles/moira.dir/MoiraJit.cpp.o.d"
+  "/root/repo/Moira/MoiraScheduler.cpp" "Moira/CMakeFiles/moira.dir/MoiraScheduler.cpp.o" "gcc" "Moira/CMakeFiles/moira.dir/MoiraScheduler.cpp.o.d"
+  "/root/repo/Moira/MoiraTiming.cpp" "Moira/CMakeFiles/moira.dir/MoiraTiming.cpp.o" "gcc" "Moira/CMakeFiles/moira.dir/MoiraTiming.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
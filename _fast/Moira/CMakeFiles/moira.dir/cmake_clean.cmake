@@ -0,0 +1,37 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/moira.dir/Moira.cpp.o"
+  "CMakeFiles/moira.dir/Moira.cpp.o.d"
+  "CMakeFiles/moira.dir/MoiraAnalyzer.cpp.o"
+  "CMakeFiles/moira.dir/MoiraAnalyzer.cpp.o.d"
+  "CMakeFiles/moira.dir/MoiraDebugger.cpp.o"
+  "CMakeFiles/moira.dir/MoiraDebugger.cpp.o.d"
+  "CMakeFiles/moira.dir/MoiraGroup0.cpp.o"
+  "CMakeFiles/moira.dir/MoiraGroup0.cpp.o.d"
+  "CMakeFiles/moira.dir/MoiraGroup1.cpp.o"
+  "CMakeFiles/moira.dir/MoiraGroup1.cpp.o.d"
+  "CMakeFiles/moira.dir/MoiraGroup2.cpp.o"
+  "CMakeFiles/moira.dir/MoiraGroup2.cpp.o.d"
+  "CMakeFiles/moira.dir/MoiraGroup3.cpp.o"
+  "CMakeFiles/moira.dir/MoiraGroup3.cpp.o.d"
+  "CMakeFiles/moira.dir/MoiraGroup4.cpp.o"
+  "CMakeFiles/moira.dir/MoiraGroup4.cpp.o.d"
+  "CMakeFiles/moira.dir/MoiraGroup5.cpp.o"
+  "CMakeFiles/moira.dir/MoiraGroup5.cpp.o.d"
+  "CMakeFiles/moira.dir/MoiraGroup6.cpp.o"
+  "CMakeFiles/moira.dir/MoiraGroup6.cpp.o.d"
+  "CMakeFiles/moira.dir/MoiraGroup7.cpp.o"
+  "CMakeFiles/moira.dir/MoiraGroup7.cpp.o.d"
+  "CMakeFiles/moira.dir/MoiraJit.cpp.o"
+  "CMakeFiles/moira.dir/MoiraJit.cpp.o.d"
+  "CMakeFiles/moira.dir/MoiraScheduler.cpp.o"
+  "CMakeFiles/moira.dir/MoiraScheduler.cpp.o.d"
+  "CMakeFiles/moira.dir/MoiraTiming.cpp.o"
+  "CMakeFiles/moira.dir/MoiraTiming.cpp.o.d"
+  "libmoira.a"
+  "libmoira.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/moira.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,22 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/Musashi/m68kcpu.c" "Musashi/CMakeFiles/musashi.dir/m68kcpu.c.o" "gcc" "Musashi/CMakeFiles/musashi.dir/m68kcpu.c.o.d"
+  "/root/repo/Musashi/m68kdasm.c" "Musashi/CMakeFiles/musashi.dir/m68kdasm.c.o" "gcc" "Musashi/CMakeFiles/musashi.dir/m68kdasm.c.o.d"
+  "/root/repo/Musashi/m68kfpu.c" "Musashi/CMakeFiles/musashi.dir/m68kfpu.c.o" "gcc" "Musashi/CMakeFiles/musashi.dir/m68kfpu.c.o.d"
+  "/root/repo/Musashi/m68kops.c" "Musashi/CMakeFiles/musashi.dir/m68kops.c.o" "gcc" "Musashi/CMakeFiles/musashi.dir/m68kops.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
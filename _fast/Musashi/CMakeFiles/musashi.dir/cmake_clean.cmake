@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/musashi.dir/m68kcpu.c.o"
+  "CMakeFiles/musashi.dir/m68kcpu.c.o.d"
+  "CMakeFiles/musashi.dir/m68kdasm.c.o"
+  "CMakeFiles/musashi.dir/m68kdasm.c.o.d"
+  "CMakeFiles/musashi.dir/m68kfpu.c.o"
+  "CMakeFiles/musashi.dir/m68kfpu.c.o.d"
+  "CMakeFiles/musashi.dir/m68kops.c.o"
+  "CMakeFiles/musashi.dir/m68kops.c.o.d"
+  "libmusashi.a"
+  "libmusashi.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/musashi.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,1970 @@
+// -----------------------------------------------------------------------------
+// This file is part of Moira - A Motorola 68k emulator
+//
+// Copyright (C) Dirk W. Hoffmann. www.dirkwhoffmann.de
+// Licensed under the GNU General Public License v3
+//
+// See https://www.gnu.org for license information
+// -----------------------------------------------------------------------------
+
+#include "benchmark.h"
+
+// Simple pseudo random number generator (xorshift)
+static u32 rnd(u32 &state)
+{
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    return state;
+}
+
+// Computes a checksum over a string (FNV-1a)
+static u64 fnv(u64 hash, const char *str)
+{
+    while (*str) { hash ^= (u8)*str++; hash *= 0x100000001b3; }
+    return hash;
+}
+
+//
+// Disassembler
+//
+
+// A CPU that rebuilds the shared tables on request
+class TableCPU : public BenchCPU {
+
+public:
+
+    static void rebuild() { createJumpTables(); }
+};
+
+static void dasmAllOpcodes()
+{
+    const int rounds = 50;
+    char str[128];
+    u32 state = 0x12345678;
+
+    BenchCPU *cpu = new BenchCPU();
+    for (int i = 0; i < 0x10000; i++) cpu->mem[i] = (u8)rnd(state);
+
+    // Measure the time needed to build the jump tables
+    {
+        Stopwatch watch;
+        for (int r = 0; r < rounds; r++) TableCPU::rebuild();
+        printf("  tables %8.2f ms\n", watch.elapsed() / rounds);
+    }
+
+    // Format all opcodes in hexadecimal, decimal, and upper case notation
+    for (int style = 0; style < 3; style++) {
+
+        cpu->configDasm(style != 1, style == 2);
+
+        u64 checksum = 0xcbf29ce484222325;
+        size_t bytes = 0;
+        Stopwatch watch;
+
+        for (int r = 0; r < rounds; r++) {
+            for (u32 op = 0; op < 0x10000; op++) {
+
+                cpu->poke16(0x1000, (u16)op);
+                cpu->disassemble(0x1000, str);
+                if (r == 0) { checksum = fnv(checksum, str); bytes += strlen(str); }
+            }
+        }
+
+        double ms = watch.elapsed();
+        printf("  %-6s %8.2f ms  %6.1f ns/instr  %zu bytes  checksum %016llx\n",
+               style == 0 ? "hex" : style == 1 ? "dec" : "HEX",
+               ms, ms * 1e6 / (rounds * 0x10000), bytes,
+               (unsigned long long)checksum);
+    }
+
+    delete cpu;
+}
+
+// Redraws a debugger window that follows the PC with and without the cache
+static void dasmWindow()
+{
+    const int frames = 20000, lines = 40;
+    char str[128];
+
+    BenchCPU *cpu = new BenchCPU();
+
+    for (int cached = 0; cached < 2; cached++) {
+
+        u32 state = 0x13579bdf;
+        for (int i = 0; i < 0x10000; i++) cpu->mem[i] = (u8)rnd(state);
+        cpu->enableDasmCache(cached);
+
+        u64 checksum = 0xcbf29ce484222325;
+        u32 pc = 0x1000;
+        Stopwatch watch;
+
+        for (int f = 0; f < frames; f++) {
+
+            // Modify the code from time to time to check invalidation
+            if (f % 64 == 0) cpu->poke16(pc + 2 * (rnd(state) % lines), (u16)rnd(state));
+
+            // Step the PC every few frames as if the user single-stepped
+            if (f % 8 == 0) pc = (pc + cpu->disassemble(pc, str)) & 0xFFFF;
+
+            u32 addr = pc;
+            for (int l = 0; l < lines; l++) {
+
+                addr = (addr + cpu->disassemble(addr, str)) & 0xFFFF;
+                checksum = fnv(checksum, str);
+            }
+        }
+
+        double ms = watch.elapsed();
+        printf("  %-8s %8.2f ms  %6.1f ns/line  checksum %016llx\n",
+               cached ? "cached" : "uncached", ms, ms * 1e6 / (frames * lines),
+               (unsigned long long)checksum);
+    }
+
+    delete cpu;
+}
+
+//
+// Control-flow analysis
+//
+
+static void analyzeMemory()
+{
+    const int rounds = 10;
+    u32 state = 0x87654321;
+
+    BenchCPU *cpu = new BenchCPU();
+    memset(cpu->mem, 0, sizeof(cpu->mem));
+
+    // Create a synthetic ROM consisting of small subroutines
+    std::vector<u32> funcs;
+    for (u32 addr = 0x400; addr < 0xFF00; addr += 32 + 2 * (rnd(state) % 96)) {
+        funcs.push_back(addr);
+    }
+    funcs.push_back(0xFFFE);
+
+    for (size_t i = 0; i + 1 < funcs.size(); i++) {
+
+        u32 addr = funcs[i], end = funcs[i + 1] - 2;
+
+        while (addr + 8 < end) {
+
+            switch (rnd(state) % 8) {
+
+                case 0: // JSR <random subroutine>
+                {
+                    u32 target = funcs[rnd(state) % (funcs.size() - 1)];
+                    cpu->poke16(addr, 0x4EB9);
+                    cpu->poke16(addr + 2, 0);
+                    cpu->poke16(addr + 4, (u16)target);
+                    addr += 6;
+                    break;
+                }
+                case 1: // BEQ.S *+4
+                {
+                    cpu->poke16(addr, 0x6702);
+                    addr += 2;
+                    break;
+                }
+                default: // MOVEQ #<random>,D0
+                {
+                    cpu->poke16(addr, 0x7000 | (rnd(state) & 0xFF));
+                    addr += 2;
+                }
+            }
+        }
+        for (; addr < end; addr += 2) cpu->poke16(addr, 0x4E71); // NOP
+        cpu->poke16(end, 0x4E75); // RTS
+    }
+
+    // Let the reset vector point to the first subroutine
+    cpu->poke16(4, 0);
+    cpu->poke16(6, 0x400);
+
+    Analyzer analyzer(*cpu);
+    analyzer.setRange(0, 0xFFFF);
+    analyzer.addVectors();
+
+    for (int threads = 1; threads <= 4; threads *= 2) {
+
+        Stopwatch watch;
+        for (int r = 0; r < rounds; r++) analyzer.analyze(threads);
+
+        double ms = watch.elapsed() / rounds;
+        long instrs = 0;
+        for (auto &b : analyzer.blocks) instrs += b.second.count;
+
+        printf("  %d thread(s) %8.2f ms  %6.1f ns/instr  %zu blocks  %zu functions\n",
+               threads, ms, ms * 1e6 / instrs,
+               analyzer.blocks.size(), analyzer.functions.size());
+    }
+
+    delete cpu;
+}
+
+//
+// Instruction timing
+//
+
+// A CPU that counts all bus accesses
+class CountingCPU : public BenchCPU {
+
+public:
+
+    long reads = 0;
+    long writes = 0;
+
+    u8 read8(u32 addr) override { reads++; return BenchCPU::read8(addr); }
+    u16 read16(u32 addr) override { reads++; return BenchCPU::read16(addr); }
+    void write8 (u32 addr, u8 val) override { writes++; BenchCPU::write8(addr, val); }
+    void write16 (u32 addr, u16 val) override { writes++; BenchCPU::write16(addr, val); }
+};
+
+static void validateTimings()
+{
+    const int steps = 1000000;
+    u32 state = 0x13579BDF;
+
+    CountingCPU *cpu = new CountingCPU();
+    for (int i = 0; i < 0x10000; i++) cpu->mem[i] = (u8)rnd(state);
+
+    // Derive the timing table
+    Stopwatch watch;
+    cpu->getTiming(0);
+    printf("  table    %8.2f ms\n", watch.elapsed());
+
+    // Compare the table with the timing of random instructions
+    long checked = 0, variable = 0, violations = 0;
+    for (int i = 0; i < steps; i++) {
+
+        cpu->reset();
+        for (int r = 0; r < 8; r++) cpu->setD(r, rnd(state));
+        for (int r = 0; r < 8; r++) cpu->setA(r, rnd(state));
+        cpu->setSR(0x2700 | (rnd(state) & 0x1F));
+
+        u32 pc = rnd(state) & 0xFFFE;
+        cpu->setPC(pc);
+        cpu->setPC0(pc);
+        cpu->setIRD(cpu->BenchCPU::read16(pc));
+        cpu->setIRC(cpu->BenchCPU::read16(pc + 2));
+
+        u16 op = cpu->getIRD();
+        auto timing = cpu->getTiming(op);
+        i64 clock = cpu->getClock();
+        cpu->reads = cpu->writes = 0;
+
+        cpu->execute();
+
+        i64 cycles = cpu->getClock() - clock;
+        bool exact = timing.cycles == timing.maxCycles;
+        bool valid = exact ?
+        cycles == timing.cycles && cpu->reads == timing.reads && cpu->writes == timing.writes :
+        cycles >= timing.cycles && cycles <= timing.maxCycles;
+
+        if (!valid && violations++ < 10) {
+
+            char str[128];
+            cpu->disassemble(pc, str);
+            printf("  mismatch %04x %-24s %lld cycles (%d..%d) %ld/%ld accesses (%d/%d)\n",
+                   op, str, (long long)cycles, timing.cycles, timing.maxCycles,
+                   cpu->reads, cpu->writes, timing.reads, timing.writes);
+        }
+        checked++;
+        if (!exact) variable++;
+    }
+
+    printf("  %ld instructions checked (%ld variable)  %ld violations\n",
+           checked, variable, violations);
+
+    // Estimate a straight-line code block
+    CycleEstimate estimate = cpu->estimateCycles(0x1000, 0x1100);
+    printf("  estimate %d instructions  %lld..%lld cycles  %lld reads  %lld writes\n",
+           estimate.count, (long long)estimate.cycles, (long long)estimate.maxCycles,
+           (long long)estimate.reads, (long long)estimate.writes);
+
+    delete cpu;
+}
+
+//
+// Multi-core scheduling
+//
+
+static void runScheduler()
+{
+    const int cpus = 256;
+    const i64 cycles = 2000000;
+
+    // Create a farm of CPUs, each running a small arithmetic loop
+    std::vector<BenchCPU *> farm;
+    for (int i = 0; i < cpus; i++) {
+
+        BenchCPU *cpu = new BenchCPU();
+        memset(cpu->mem, 0, sizeof(cpu->mem));
+
+        cpu->poke16(0x0000, 0x0000);    // Initial SP: $8000
+        cpu->poke16(0x0002, 0x8000);
+        cpu->poke16(0x0004, 0x0000);    // Initial PC: $1000
+        cpu->poke16(0x0006, 0x1000);
+        cpu->poke16(0x1000, 0x5281);    // ADDQ.L  #1,D1
+        cpu->poke16(0x1002, 0xD481);    // ADD.L   D1,D2
+        cpu->poke16(0x1004, 0x51C8);    // DBF     D0,$1000
+        cpu->poke16(0x1006, 0xFFFA);
+        cpu->poke16(0x1008, 0x60F6);    // BRA.S   $1000
+
+        farm.push_back(cpu);
+    }
+
+    int max = std::max(1, (int)std::thread::hardware_concurrency());
+    for (int threads = 1;; threads = std::min(2 * threads, max)) {
+
+        Scheduler scheduler(threads);
+        for (auto &cpu : farm) { cpu->reset(); scheduler.add(cpu); }
+
+        Stopwatch watch;
+        scheduler.run(cycles);
+        double ms = watch.elapsed();
+
+        u64 checksum = 0;
+        for (auto &cpu : farm) checksum = checksum * 31 + cpu->getD(2);
+
+        printf("  %2d thread(s) %8.2f ms  %8.1f Mcycles/s  checksum %016llx\n",
+               threads, ms, cpus * cycles / (ms * 1e3), (unsigned long long)checksum);
+
+        if (threads == max) break;
+    }
+
+    for (auto &cpu : farm) delete cpu;
+}
+
+//
+// Idle loop detection
+//
+
+// A CPU with a vertical blank interrupt and a polled status register
+class IdleCPU : public BenchCPU {
+
+public:
+
+    // Acknowledges the interrupt
+    void write16 (u32 addr, u16 val) override {
+        BenchCPU::write16(addr, val); if ((addr & 0xFFFF) == 0xF000) setIPL(0); }
+
+    // The status register doesn't change between two interrupts
+    bool isPollingAddress(u32 addr) override { return (addr & 0xFFFF) == 0xF002; }
+};
+
+static void skipIdleLoops()
+{
+    const int frames = 2000;
+    const i64 frameCycles = 20000;
+
+    for (int detect = 0; detect < 2; detect++) {
+
+        IdleCPU *cpu = new IdleCPU();
+        memset(cpu->mem, 0, sizeof(cpu->mem));
+
+        cpu->poke16(0x0000, 0x0000);    // Initial SP: $8000
+        cpu->poke16(0x0002, 0x8000);
+        cpu->poke16(0x0004, 0x0000);    // Initial PC: $1000
+        cpu->poke16(0x0006, 0x1000);
+        cpu->poke16(0x006C, 0x0000);    // Level 3 autovector: $2000
+        cpu->poke16(0x006E, 0x2000);
+        cpu->poke16(0x1000, 0x303C);    // MOVE.W  #$1FFF,D0
+        cpu->poke16(0x1002, 0x1FFF);
+        cpu->poke16(0x1004, 0x51C8);    // DBF     D0,$1004
+        cpu->poke16(0x1006, 0xFFFE);
+        cpu->poke16(0x1008, 0x4A78);    // TST.W   $F002.w
+        cpu->poke16(0x100A, 0xF002);
+        cpu->poke16(0x100C, 0x67FA);    // BEQ.S   $1008
+        cpu->poke16(0x100E, 0x60F0);    // BRA.S   $1000
+        cpu->poke16(0x2000, 0x5287);    // ADDQ.L  #1,D7
+        cpu->poke16(0x2002, 0x31C7);    // MOVE.W  D7,$F000.w
+        cpu->poke16(0x2004, 0xF000);
+        cpu->poke16(0x2006, 0x4E73);    // RTE
+
+        cpu->reset();
+        cpu->setSR(0x2000);
+        cpu->enableIdleDetection(detect);
+
+        Stopwatch watch;
+        long instrs = 0;
+
+        for (int f = 0; f < frames; f++) {
+
+            i64 next = (f + 1) * frameCycles;
+
+            cpu->setNextEventClock(next);
+            while (cpu->getClock() < next) { cpu->execute(); instrs++; }
+            cpu->setIPL(3);
+        }
+
+        double ms = watch.elapsed();
+        printf("  %-9s %8.2f ms  %9ld calls  clock %lld  irqs %d  pc %06x\n",
+               detect ? "detect" : "execute", ms, instrs,
+               (long long)cpu->getClock(), cpu->getD(7), cpu->getPC());
+
+        delete cpu;
+    }
+}
+
+static void skipStopState()
+{
+    const int frames = 2000;
+    const i64 frameCycles = 20000;
+
+    for (int announce = 0; announce < 2; announce++) {
+
+        IdleCPU *cpu = new IdleCPU();
+        memset(cpu->mem, 0, sizeof(cpu->mem));
+
+        cpu->poke16(0x0000, 0x0000);    // Initial SP: $8000
+        cpu->poke16(0x0002, 0x8000);
+        cpu->poke16(0x0004, 0x0000);    // Initial PC: $1000
+        cpu->poke16(0x0006, 0x1000);
+        cpu->poke16(0x006C, 0x0000);    // Level 3 autovector: $2000
+        cpu->poke16(0x006E, 0x2000);
+        cpu->poke16(0x1000, 0x4E72);    // STOP    #$2000
+        cpu->poke16(0x1002, 0x2000);
+        cpu->poke16(0x1004, 0x60FA);    // BRA.S   $1000
+        cpu->poke16(0x2000, 0x5287);    // ADDQ.L  #1,D7
+        cpu->poke16(0x2002, 0x31C7);    // MOVE.W  D7,$F000.w
+        cpu->poke16(0x2004, 0xF000);
+        cpu->poke16(0x2006, 0x4E73);    // RTE
+
+        cpu->reset();
+        cpu->setSR(0x2000);
+
+        Stopwatch watch;
+        long instrs = 0;
+
+        for (int f = 0; f < frames; f++) {
+
+            i64 next = (f + 1) * frameCycles;
+
+            if (announce) cpu->setNextEventClock(next);
+            while (cpu->getClock() < next) { cpu->execute(); instrs++; }
+            cpu->setIPL(3);
+        }
+
+        double ms = watch.elapsed();
+        printf("  %-9s %8.2f ms  %9ld calls  clock %lld  irqs %d  pc %06x\n",
+               announce ? "announce" : "execute", ms, instrs,
+               (long long)cpu->getClock(), cpu->getD(7), cpu->getPC());
+
+        delete cpu;
+    }
+}
+
+//
+// Loop kernels
+//
+
+static void runLoopKernels()
+{
+    const int frames = 500;
+    const i64 frameCycles = 20000;
+
+    for (int mapped = 0; mapped < 2; mapped++) {
+
+        u32 state = 0x2468ACE0;
+
+        IdleCPU *cpu = new IdleCPU();
+        for (int i = 0; i < 0x10000; i++) cpu->mem[i] = (u8)rnd(state);
+        memcpy(cpu->mem + 0x8000, cpu->mem + 0x4000, 0x1000);
+        cpu->mem[0x8A00]++;
+
+        static const u16 program[] = {
+
+            0x41F9, 0x0000, 0x4000,     // LEA     $4000,A0
+            0x43F9, 0x0000, 0x6000,     // LEA     $6000,A1
+            0x303C, 0x03FF,             // MOVE.W  #$3FF,D0
+            0x22D8,                     // MOVE.L  (A0)+,(A1)+
+            0x51C8, 0xFFFC,             // DBF     D0,*-2
+            0x41F9, 0x0000, 0x6000,     // LEA     $6000,A0
+            0x303C, 0x07FF,             // MOVE.W  #$7FF,D0
+            0x4258,                     // CLR.W   (A0)+
+            0x51C8, 0xFFFC,             // DBF     D0,*-2
+            0x41F9, 0x0000, 0x4000,     // LEA     $4000,A0
+            0x43F9, 0x0000, 0x8000,     // LEA     $8000,A1
+            0x303C, 0x0FFF,             // MOVE.W  #$FFF,D0
+            0xB308,                     // CMPM.B  (A0)+,(A1)+
+            0x56C8, 0xFFFC,             // DBNE    D0,*-2
+            0x5286,                     // ADDQ.L  #1,D6
+            0x6000, 0xFFC0              // BRA.W   $1000
+        };
+        for (size_t i = 0; i < sizeof(program) / 2; i++) cpu->poke16(0x1000 + 2 * (u32)i, program[i]);
+
+        cpu->poke16(0x0000, 0x0000);    // Initial SP: $E000
+        cpu->poke16(0x0002, 0xE000);
+        cpu->poke16(0x0004, 0x0000);    // Initial PC: $1000
+        cpu->poke16(0x0006, 0x1000);
+        cpu->poke16(0x006C, 0x0000);    // Level 3 autovector: $2000
+        cpu->poke16(0x006E, 0x2000);
+        cpu->poke16(0x2000, 0x5287);    // ADDQ.L  #1,D7
+        cpu->poke16(0x2002, 0x31C7);    // MOVE.W  D7,$F000.w
+        cpu->poke16(0x2004, 0xF000);
+        cpu->poke16(0x2006, 0x4E73);    // RTE
+
+        cpu->reset();
+        cpu->setSR(0x2000);
+        if (mapped) cpu->mapRam(0, 0x10000, cpu->mem);
+
+        Stopwatch watch;
+        long instrs = 0;
+
+        for (int f = 0; f < frames; f++) {
+
+            i64 next = (f + 1) * frameCycles;
+
+            cpu->setNextEventClock(next);
+            while (cpu->getClock() < next) { cpu->execute(); instrs++; }
+            cpu->setIPL(3);
+        }
+
+        double ms = watch.elapsed();
+
+        u64 checksum = 0xcbf29ce484222325;
+        for (int i = 0; i < 8; i++) checksum = (checksum ^ cpu->getD(i)) * 0x100000001b3;
+        for (int i = 0; i < 8; i++) checksum = (checksum ^ cpu->getA(i)) * 0x100000001b3;
+        for (int i = 0; i < 0x10000; i++) checksum = (checksum ^ cpu->mem[i]) * 0x100000001b3;
+
+        printf("  %-9s %8.2f ms  %9ld calls  clock %lld  loops %d  checksum %016llx\n",
+               mapped ? "mapped" : "execute", ms, instrs,
+               (long long)cpu->getClock(), cpu->getD(6), (unsigned long long)checksum);
+
+        delete cpu;
+    }
+}
+
+//
+// Instruction fusion
+//
+
+// A configuration with the fused handlers compiled in
+struct FusionConfig : DefaultConfig {
+
+    static constexpr bool fusion = true;
+};
+
+// Returns the lines of all instructions that can be fused with I (see enableFusion())
+static u16 fusableLines(Instr I)
+{
+    switch (I) {
+
+        case CMP: case CMPA: case CMPI: case TST: return 1 << 0x6;
+        case MOVEQ: return 1 << 0x8 | 1 << 0x9 | 0xF << 0xB;
+        case LEA: return 1 << 0x1 | 1 << 0x2 | 1 << 0x3;
+        default: return 0;
+    }
+}
+
+/* Runs instruction pairs on a fused and on an unfused core and compares the
+ * registers, the clock, and all bus accesses and calls to sync(). Each
+ * fusable instruction is paired with random successors, and each possible
+ * successor is paired with random fusable instructions.
+ */
+static void compareFusedPairs()
+{
+    auto fused = new TraceCPU<FusionConfig>();
+    auto plain = new TraceCPU<>();
+    fused->enableFusion(true);
+
+    u32 state = 0x2468ACE0;
+    for (int i = 0; i < 0x10000; i++) plain->mem[i] = (u8)rnd(state);
+    memcpy(fused->mem, plain->mem, sizeof(plain->mem));
+
+    // Collect all instructions with a fused handler
+    std::vector<u16> first;
+    for (int op = 0; op < 0x10000; op++) {
+        if (fusableLines(plain->getInfo((u16)op).I)) first.push_back((u16)op);
+    }
+
+    long runs = 0, pairs = 0, mismatches = 0;
+
+    auto run = [&](u16 op1, u16 op2) {
+
+        char str[128];
+        const u32 pc = 0x1000;
+
+        /* Place the second instruction behind the first one. Extension words
+         * are given the brief format, because the disassembler decodes the
+         * full format of the 68020 which would yield a different length.
+         */
+        plain->poke16(pc, op1);
+        for (u32 i = 2; i < 12; i += 2) plain->poke16(pc + i, (u16)rnd(state) & 0xFEFF);
+        plain->poke16(pc + plain->disassemble(pc, str), op2);
+        memcpy(fused->mem + pc, plain->mem + pc, 32);
+
+        u32 d[8], a[8];
+        for (int i = 0; i < 8; i++) { d[i] = rnd(state); a[i] = rnd(state); }
+        u16 sr = (u16)(0x2700 | (rnd(state) & 0x1F));
+
+        auto prepare = [&](auto *cpu) {
+
+            cpu->tracing = false;
+            cpu->setClock(0);
+            cpu->setSR(sr);
+            for (int i = 0; i < 8; i++) { cpu->setD(i, d[i]); cpu->setA(i, a[i]); }
+            cpu->setPC(pc);
+            cpu->setPC0(pc);
+            cpu->setIRD(cpu->read16(pc));
+            cpu->setIRC(cpu->read16(pc + 2));
+            cpu->trace = 0xcbf29ce484222325;
+            cpu->tracing = true;
+        };
+        prepare(fused);
+        prepare(plain);
+
+        // A fused instruction may be fused with its successor, too
+        i64 count = fused->getFusedPairs();
+        runs++;
+        fused->execute();
+        plain->execute();
+        if (fused->getFusedPairs() != count) pairs++;
+        for (; count < fused->getFusedPairs(); count++) plain->execute();
+
+        if (fused->checksum() != plain->checksum()) {
+
+            if (mismatches++ < 8) printf("  Mismatch: %04x %04x\n", op1, op2);
+            memcpy(fused->mem, plain->mem, sizeof(plain->mem));
+        }
+    };
+
+    // Pair each fusable instruction with random successors
+    for (auto op1 : first) {
+
+        u16 lines = fusableLines(plain->getInfo(op1).I);
+        for (int i = 0; i < 8; ) {
+
+            u16 op2 = (u16)rnd(state);
+            if ((lines >> (op2 >> 12)) & 1) { run(op1, op2); i++; }
+        }
+    }
+
+    // Pair each successor with random fusable instructions
+    u16 lines = 0;
+    for (auto op1 : first) lines |= fusableLines(plain->getInfo(op1).I);
+
+    for (int op2 = 0; op2 < 0x10000; op2++) {
+
+        if (!((lines >> (op2 >> 12)) & 1)) continue;
+
+        for (int i = 0; i < 4; ) {
+
+            u16 op1 = first[rnd(state) % first.size()];
+            if ((fusableLines(plain->getInfo(op1).I) >> (op2 >> 12)) & 1) { run(op1, (u16)op2); i++; }
+        }
+    }
+
+    printf("  compared  %zu fusable instructions  %ld pairs  %ld fused  %ld mismatches\n",
+           first.size(), runs, pairs, mismatches);
+
+    delete fused;
+    delete plain;
+}
+
+template <class CPU> static void runFusableGuest(const char *name, bool fuse)
+{
+    const int frames = 500;
+    const i64 frameCycles = 20000;
+
+    u32 state = 0x13579BDF;
+
+    auto cpu = new CPU();
+    for (int i = 0; i < 0x10000; i++) cpu->mem[i] = (u8)rnd(state);
+
+    static const u16 program[] = {
+
+        0x41F9, 0x0000, 0x4000,     // LEA     $4000,A0
+        0x303C, 0x0FFF,             // MOVE.W  #$FFF,D0
+        0x7200,                     // MOVEQ   #0,D1
+        0x7407,                     // MOVEQ   #7,D2
+        0xC458,                     // AND.W   (A0)+,D2
+        0xD242,                     // ADD.W   D2,D1
+        0x43E8, 0x0002,             // LEA     2(A0),A1
+        0x3811,                     // MOVE.W  (A1),D4
+        0xB444,                     // CMP.W   D4,D2
+        0x6202,                     // BHI.S   *+4
+        0x5243,                     // ADDQ.W  #1,D3
+        0x4A42,                     // TST.W   D2
+        0x6702,                     // BEQ.S   *+4
+        0x5245,                     // ADDQ.W  #1,D5
+        0x51C8, 0xFFE6,             // DBF     D0,$100A
+        0x5286,                     // ADDQ.L  #1,D6
+        0x60D6                      // BRA.S   $1000
+    };
+    for (size_t i = 0; i < sizeof(program) / 2; i++) cpu->poke16(0x1000 + 2 * (u32)i, program[i]);
+
+    cpu->poke16(0x0000, 0x0000);    // Initial SP: $E000
+    cpu->poke16(0x0002, 0xE000);
+    cpu->poke16(0x0004, 0x0000);    // Initial PC: $1000
+    cpu->poke16(0x0006, 0x1000);
+    cpu->poke16(0x006C, 0x0000);    // Level 3 autovector: $2000
+    cpu->poke16(0x006E, 0x2000);
+    cpu->poke16(0x2000, 0x5287);    // ADDQ.L  #1,D7
+    cpu->poke16(0x2002, 0x31C7);    // MOVE.W  D7,$F000.w
+    cpu->poke16(0x2004, 0xF000);
+    cpu->poke16(0x2006, 0x4E73);    // RTE
+
+    cpu->reset();
+    cpu->setSR(0x2000);
+    if (fuse) cpu->enableFusion(true);
+
+    Stopwatch watch;
+    long instrs = 0;
+
+    for (int f = 0; f < frames; f++) {
+
+        i64 next = (f + 1) * frameCycles;
+
+        cpu->setNextEventClock(next);
+        while (cpu->getClock() < next) { cpu->execute(); instrs++; }
+        cpu->setIPL(3);
+    }
+
+    double ms = watch.elapsed();
+
+    u64 checksum = 0xcbf29ce484222325;
+    for (int i = 0; i < 8; i++) checksum = (checksum ^ cpu->getD(i)) * 0x100000001b3;
+    for (int i = 0; i < 8; i++) checksum = (checksum ^ cpu->getA(i)) * 0x100000001b3;
+    for (int i = 0; i < 0x10000; i++) checksum = (checksum ^ cpu->mem[i]) * 0x100000001b3;
+
+    printf("  %-9s %8.2f ms  %9ld calls  %9lld fused  clock %lld  checksum %016llx\n",
+           name, ms, instrs, (long long)cpu->getFusedPairs(),
+           (long long)cpu->getClock(), (unsigned long long)checksum);
+
+    delete cpu;
+}
+
+static void fuseInstructions()
+{
+    compareFusedPairs();
+
+    runFusableGuest<TraceCPU<>>("default", false);
+    runFusableGuest<TraceCPU<FusionConfig>>("unfused", false);
+    runFusableGuest<TraceCPU<FusionConfig>>("fused", true);
+}
+
+//
+// Block cache
+//
+
+static void runBlockCache()
+{
+    const int frames = 500;
+    const i64 frameCycles = 20000;
+
+    for (int mode = 0; mode < 3; mode++) {
+
+        u32 state = 0x0F1E2D3C;
+
+        IdleCPU *cpu = new IdleCPU();
+        for (int i = 0; i < 0x10000; i++) cpu->mem[i] = (u8)rnd(state);
+
+        static const u16 program[] = {
+
+            0x41F9, 0x0000, 0x4000,     // LEA     $4000,A0
+            0x303C, 0x07FF,             // MOVE.W  #$7FF,D0
+            0x7200,                     // MOVEQ   #0,D1
+            0x3418,                     // MOVE.W  (A0)+,D2
+            0x0802, 0x0000,             // BTST    #0,D2
+            0x6704,                     // BEQ.S   *+6
+            0xD242,                     // ADD.W   D2,D1
+            0x6004,                     // BRA.S   *+6
+            0xB541,                     // EOR.W   D2,D1
+            0xE359,                     // ROL.W   #1,D1
+            0x51C8, 0xFFEE,             // DBF     D0,$100C
+            0xDC81,                     // ADD.L   D1,D6
+            0x60DC                      // BRA.S   $1000
+        };
+        for (size_t i = 0; i < sizeof(program) / 2; i++) cpu->poke16(0x1000 + 2 * (u32)i, program[i]);
+
+        cpu->poke16(0x0000, 0x0000);    // Initial SP: $E000
+        cpu->poke16(0x0002, 0xE000);
+        cpu->poke16(0x0004, 0x0000);    // Initial PC: $1000
+        cpu->poke16(0x0006, 0x1000);
+        cpu->poke16(0x006C, 0x0000);    // Level 3 autovector: $2000
+        cpu->poke16(0x006E, 0x2000);
+        cpu->poke16(0x2000, 0x5287);    // ADDQ.L  #1,D7
+        cpu->poke16(0x2002, 0x31C7);    // MOVE.W  D7,$F000.w
+        cpu->poke16(0x2004, 0xF000);
+        cpu->poke16(0x2006, 0x4E73);    // RTE
+
+        cpu->reset();
+        cpu->setSR(0x2000);
+        cpu->enableBlockCache(mode == 2);
+
+        Stopwatch watch;
+
+        for (int f = 0; f < frames; f++) {
+
+            i64 next = (f + 1) * frameCycles;
+
+            if (mode == 0) {
+                while (cpu->getClock() < next) cpu->execute();
+            } else {
+                cpu->executeUntil(next);
+            }
+            cpu->setIPL(3);
+        }
+
+        double ms = watch.elapsed();
+
+        u64 checksum = 0xcbf29ce484222325;
+        for (int i = 0; i < 8; i++) checksum = (checksum ^ cpu->getD(i)) * 0x100000001b3;
+        for (int i = 0; i < 8; i++) checksum = (checksum ^ cpu->getA(i)) * 0x100000001b3;
+        for (int i = 0; i < 0x10000; i++) checksum = (checksum ^ cpu->mem[i]) * 0x100000001b3;
+
+        printf("  %-9s %8.2f ms  clock %lld  checksum %016llx\n",
+               mode == 0 ? "execute" : mode == 1 ? "until" : "cached", ms,
+               (long long)cpu->getClock(), (unsigned long long)checksum);
+
+        delete cpu;
+    }
+}
+
+//
+// Block translator
+//
+
+// A configuration with the block translator compiled in
+struct JitConfig : DefaultConfig {
+
+    static constexpr bool enableJit = true;
+};
+
+// Sets up the vector table and an interrupt handler patching the code at $1005
+static void setupTranslatorGuest(TraceCPU<JitConfig> *cpu)
+{
+    cpu->poke16(0x0000, 0x0000);    // Initial SP: $E000
+    cpu->poke16(0x0002, 0xE000);
+    cpu->poke16(0x0004, 0x0000);    // Initial PC: $1000
+    cpu->poke16(0x0006, 0x1000);
+    cpu->poke16(0x006C, 0x0000);    // Level 3 autovector: $2000
+    cpu->poke16(0x006E, 0x2000);
+    cpu->poke16(0x2000, 0x31C7);    // MOVE.W  D7,$F000.w
+    cpu->poke16(0x2002, 0xF000);
+    cpu->poke16(0x2004, 0x5238);    // ADDQ.B  #1,$1005.w
+    cpu->poke16(0x2006, 0x1005);
+    cpu->poke16(0x2008, 0x4E73);    // RTE
+}
+
+// Returns a random single-word instruction that leaves D7, A4 - A7 untouched
+static u16 randomInstr(u32 &state)
+{
+    u16 rx = rnd(state) % 7, ry = rnd(state) % 7, ss = rnd(state) % 3;
+    u16 ax = rnd(state) % 4, ay = rnd(state) % 4;
+
+    static const u16 alu[] = { 0xD000, 0x9000, 0xC000, 0x8000, 0xB000 };
+    static const u16 unary[] = { 0x4A00, 0x4400, 0x4600, 0x4200 };
+    static const u16 move[] = { 0x1000, 0x3000, 0x2000 };
+
+    switch (rnd(state) % 16) {
+
+        case 0:  return (u16)(0x7000 | rx << 9 | (rnd(state) & 0xFF));       // MOVEQ
+        case 1:  return (u16)(move[ss] | rx << 9 | ry);                      // MOVE
+        case 2:
+        case 3:  return (u16)(alu[rnd(state) % 5] | rx << 9 | ss << 6 | ry); // ADD, SUB, ...
+        case 4:  return (u16)(0xB100 | rx << 9 | ss << 6 | ry);              // EOR
+        case 5:  return (u16)(0x5000 | (rnd(state) & 0xF) << 8 | ss << 6 | ry); // ADDQ, SUBQ
+        case 6:  return (u16)(0x5008 | (rnd(state) & 0xF) << 8 | (ss ? ss : 1) << 6 | ay);
+        case 7:  return (u16)(unary[rnd(state) % 4] | ss << 6 | ry);         // TST, NEG, ...
+        case 8:  return (u16)(0x4840 | ry);                                  // SWAP
+        case 9:  return (u16)(0x4880 | (rnd(state) & 1) << 6 | ry);          // EXT
+        case 10: return (u16)(rnd(state) % 3 == 0 ? 0xC140 | rx << 9 | ry :  // EXG
+                              rnd(state) % 2 ? 0xC148 | ax << 9 | ay : 0xC188 | rx << 9 | ay);
+        case 11: return (u16)(0xD140 | rx << 9 | ry);                        // ADDX.W
+        case 12: return (u16)(0xE348 | ry);                                  // LSL.W #1
+        case 13: return 0x3A82;                                              // MOVE.W D2,(A5)
+        case 14: return 0xD656;                                              // ADD.W (A6),D3
+        default: return (u16)(0x6002 | (2 + rnd(state) % 14) << 8);          // Bcc.S *+4
+    }
+}
+
+static void runTranslator()
+{
+    const int programs = 200;
+    const int frames = 50;
+    const i64 frameCycles = 4000;
+
+    if (!JIT_AVAILABLE) printf("  The translator is not available on this host\n");
+
+    // Run random programs on the interpreter and the translator side by side
+    long mismatches = 0, blocks = 0;
+    u32 state = 0x4D5E6F70;
+
+    auto ref = new TraceCPU<JitConfig>();
+    auto cpu = new TraceCPU<JitConfig>();
+
+    for (int p = 0; p < programs; p++) {
+
+        for (int i = 0; i < 0x10000; i++) ref->mem[i] = (u8)rnd(state);
+        setupTranslatorGuest(ref);
+
+        ref->poke16(0x1000, 0x3E3C);                    // MOVE.W  #$3F,D7
+        ref->poke16(0x1002, 0x003F);
+        ref->poke16(0x1004, 0x7000);                    // MOVEQ   #0,D0
+
+        u32 addr = 0x1006;
+        for (int i = 0; i < 24; i++, addr += 2) {
+            ref->poke16(addr, i == 23 ? 0x4E71 : randomInstr(state));
+        }
+        ref->poke16(addr, 0x51CF);                      // DBF     D7,$1004
+        ref->poke16(addr + 2, (u16)(0x1004 - (addr + 2)));
+        ref->poke16(addr + 4, (u16)(0x6000 | (u8)(0x1000 - (addr + 6))));  // BRA.S $1000
+
+        memcpy(cpu->mem, ref->mem, sizeof(ref->mem));
+
+        for (auto c : { ref, cpu }) {
+
+            c->trace = 0xcbf29ce484222325;
+            c->tracing = true;
+            c->setClock(0);
+            c->reset();
+            c->setSR(0x2000);
+            for (int i = 0; i < 7; i++) c->setD(i, (u32)(p * 0x9E3779B9 + i * 0x01234567));
+            for (int i = 0; i < 4; i++) c->setA(i, (u32)(p * 0x7F4A7C15 + i * 0x00FEDCBA));
+            c->setA(5, 0x8000);
+            c->setA(6, 0x9000);
+
+            // With approximate timing, the reference runs on the block cache
+            c->setPreciseTiming(p % 2 == 0);
+        }
+        ref->enableBlockCache(p % 2 == 1);
+        cpu->enableJit(true);
+
+        for (int f = 0; f < frames; f++) {
+
+            i64 next = (f + 1) * frameCycles;
+
+            if (p % 2 == 0) {
+                while (ref->getClock() < next) ref->execute();
+            } else {
+                ref->executeUntil(next);
+            }
+            cpu->executeUntil(next);
+
+            if (ref->checksum() != cpu->checksum()) {
+
+                printf("  Mismatch in program %d, frame %d (PC %x vs %x)\n",
+                       p, f, ref->getPC(), cpu->getPC());
+                mismatches++;
+                break;
+            }
+            ref->setIPL(3);
+            cpu->setIPL(3);
+        }
+        blocks++;
+    }
+
+    printf("  verified  %ld programs  %ld mismatches\n", blocks, mismatches);
+
+    delete ref;
+    delete cpu;
+
+    // Measure the speed of the interpreter, the block cache, and the translator
+    for (int mode = 0; mode < 6; mode++) {
+
+        u32 seed = 0x0F1E2D3C;
+
+        auto cpu = new StaticBenchCPU<JitConfig>();
+        for (int i = 0; i < 0x10000; i++) cpu->mem[i] = (u8)rnd(seed);
+
+        static const u16 program[] = {
+
+            0x41F9, 0x0000, 0x4000,     // LEA     $4000,A0
+            0x303C, 0x07FF,             // MOVE.W  #$7FF,D0
+            0x7200,                     // MOVEQ   #0,D1
+            0x3418,                     // MOVE.W  (A0)+,D2
+            0xD242,                     // ADD.W   D2,D1
+            0xB343,                     // EOR.W   D1,D3
+            0x4843,                     // SWAP    D3
+            0x5684,                     // ADDQ.L  #3,D4
+            0x9A84,                     // SUB.L   D4,D5
+            0xC445,                     // AND.W   D5,D2
+            0x8C82,                     // OR.L    D2,D6
+            0xB441,                     // CMP.W   D1,D2
+            0x51C8, 0xFFEC,             // DBF     D0,$100C
+            0x60DC                      // BRA.S   $1000
+        };
+        for (size_t i = 0; i < sizeof(program) / 2; i++) cpu->poke16(0x1000 + 2 * (u32)i, program[i]);
+
+        cpu->poke16(0x0000, 0x0000);    // Initial SP: $E000
+        cpu->poke16(0x0002, 0xE000);
+        cpu->poke16(0x0004, 0x0000);    // Initial PC: $1000
+        cpu->poke16(0x0006, 0x1000);
+
+        cpu->reset();
+        cpu->setPreciseTiming(mode < 3);
+        if (mode % 3 == 1) cpu->enableBlockCache(true);
+        if (mode % 3 == 2) cpu->enableJit(true);
+
+        Stopwatch watch;
+
+        for (int f = 0; f < 500; f++) {
+
+            i64 next = (f + 1) * 20000;
+
+            if (mode % 3 == 0) {
+                while (cpu->getClock() < next) cpu->execute();
+            } else {
+                cpu->executeUntil(next);
+            }
+        }
+
+        double ms = watch.elapsed();
+
+        u64 checksum = 0xcbf29ce484222325;
+        for (int i = 0; i < 8; i++) checksum = (checksum ^ cpu->getD(i)) * 0x100000001b3;
+        for (int i = 0; i < 8; i++) checksum = (checksum ^ cpu->getA(i)) * 0x100000001b3;
+
+        static const char *names[] = { "execute", "cached", "jit" };
+        printf("  %-7s %-7s %8.2f ms  clock %lld  checksum %016llx\n",
+               names[mode % 3], mode < 3 ? "precise" : "approx", ms,
+               (long long)cpu->getClock(), (unsigned long long)checksum);
+
+        delete cpu;
+    }
+}
+
+//
+// Approximate timing
+//
+
+// A CPU that counts the calls to sync()
+class SyncCPU : public IdleCPU {
+
+public:
+
+    long syncs = 0;
+
+    void sync(int cycles) override { syncs++; clock += cycles; }
+};
+
+static void runApproximateTiming()
+{
+    const int frames = 500;
+    const i64 frameCycles = 20000;
+
+    for (int precise = 1; precise >= 0; precise--) {
+
+        u32 state = 0x1F2E3D4C;
+
+        SyncCPU *cpu = new SyncCPU();
+        for (int i = 0; i < 0x10000; i++) cpu->mem[i] = (u8)rnd(state);
+
+        static const u16 program[] = {
+
+            0x41F9, 0x0000, 0x4000,     // LEA     $4000,A0
+            0x43F9, 0x0000, 0x6000,     // LEA     $6000,A1
+            0x303C, 0x03FF,             // MOVE.W  #$3FF,D0
+            0x2218,                     // MOVE.L  (A0)+,D1
+            0xD481,                     // ADD.L   D1,D2
+            0x22C2,                     // MOVE.L  D2,(A1)+
+            0xB391,                     // EOR.L   D1,(A1)
+            0x51C8, 0xFFF6,             // DBF     D0,$1010
+            0x5286,                     // ADDQ.L  #1,D6
+            0x60E0                      // BRA.S   $1000
+        };
+        for (size_t i = 0; i < sizeof(program) / 2; i++) cpu->poke16(0x1000 + 2 * (u32)i, program[i]);
+
+        cpu->poke16(0x0000, 0x0000);    // Initial SP: $E000
+        cpu->poke16(0x0002, 0xE000);
+        cpu->poke16(0x0004, 0x0000);    // Initial PC: $1000
+        cpu->poke16(0x0006, 0x1000);
+        cpu->poke16(0x006C, 0x0000);    // Level 3 autovector: $2000
+        cpu->poke16(0x006E, 0x2000);
+        cpu->poke16(0x2000, 0x5287);    // ADDQ.L  #1,D7
+        cpu->poke16(0x2002, 0x31C7);    // MOVE.W  D7,$F000.w
+        cpu->poke16(0x2004, 0xF000);
+        cpu->poke16(0x2006, 0x4E73);    // RTE
+
+        cpu->setPreciseTiming(precise);
+        cpu->reset();
+        cpu->setSR(0x2000);
+
+        Stopwatch watch;
+        long instrs = 0;
+
+        for (int f = 0; f < frames; f++) {
+
+            i64 next = (f + 1) * frameCycles;
+
+            while (cpu->getClock() < next) { cpu->execute(); instrs++; }
+            cpu->setIPL(3);
+        }
+
+        double ms = watch.elapsed();
+
+        u64 checksum = 0xcbf29ce484222325;
+        for (int i = 0; i < 8; i++) checksum = (checksum ^ cpu->getD(i)) * 0x100000001b3;
+        for (int i = 0; i < 8; i++) checksum = (checksum ^ cpu->getA(i)) * 0x100000001b3;
+        for (int i = 0; i < 0x10000; i++) checksum = (checksum ^ cpu->mem[i]) * 0x100000001b3;
+
+        printf("  %-9s %8.2f ms  %9ld calls  %9ld syncs  clock %lld  checksum %016llx\n",
+               precise ? "precise" : "approx", ms, instrs, cpu->syncs,
+               (long long)cpu->getClock(), (unsigned long long)checksum);
+
+        delete cpu;
+    }
+}
+
+//
+// Static host interface and configuration policies
+//
+
+// A configuration that trades all optional features for speed
+struct FastConfig {
+
+    static constexpr bool emulateAddressError = false;
+    static constexpr bool emulateFC = false;
+    static constexpr bool enableDasm = false;
+    static constexpr bool enableDebugger = false;
+    static constexpr bool buildInstrInfoTable = false;
+    static constexpr bool softwareTLB = false;
+    static constexpr bool dirtyTracking = false;
+    static constexpr bool enableJit = false;
+    static constexpr bool fusion = false;
+    static constexpr bool compactHandlers = false;
+    static constexpr bool mimicMusashi = false;
+};
+
+template <class CPU> static void runGuest(const char *name)
+{
+    const int rounds = 200;
+    u32 state = 0x2B3C4D5E;
+
+    auto cpu = new CPU();
+    for (int i = 0; i < 0x10000; i++) cpu->mem[i] = (u8)rnd(state);
+
+    static const u16 program[] = {
+
+        0x41F9, 0x0000, 0x4000,     // LEA     $4000,A0
+        0x43F9, 0x0000, 0x6000,     // LEA     $6000,A1
+        0x303C, 0x03FF,             // MOVE.W  #$3FF,D0
+        0x2218,                     // MOVE.L  (A0)+,D1
+        0xD481,                     // ADD.L   D1,D2
+        0xE39A,                     // ROL.L   #1,D2
+        0x22C2,                     // MOVE.L  D2,(A1)+
+        0xB391,                     // EOR.L   D1,(A1)
+        0x51C8, 0xFFF4,             // DBF     D0,$1010
+        0x5286,                     // ADDQ.L  #1,D6
+        0x60DE                      // BRA.S   $1000
+    };
+    for (size_t i = 0; i < sizeof(program) / 2; i++) cpu->poke16(0x1000 + 2 * (u32)i, program[i]);
+
+    cpu->poke16(0x0000, 0x0000);    // Initial SP: $E000
+    cpu->poke16(0x0002, 0xE000);
+    cpu->poke16(0x0004, 0x0000);    // Initial PC: $1000
+    cpu->poke16(0x0006, 0x1000);
+    cpu->reset();
+
+    Stopwatch watch;
+    long instrs = 0;
+
+    for (int r = 0; r < rounds; r++) {
+
+        i64 next = (r + 1) * 100000;
+        while (cpu->getClock() < next) { cpu->execute(); instrs++; }
+    }
+
+    double ms = watch.elapsed();
+
+    u64 checksum = 0xcbf29ce484222325;
+    for (int i = 0; i < 8; i++) checksum = (checksum ^ cpu->getD(i)) * 0x100000001b3;
+    for (int i = 0; i < 8; i++) checksum = (checksum ^ cpu->getA(i)) * 0x100000001b3;
+    for (int i = 0; i < 0x10000; i++) checksum = (checksum ^ cpu->mem[i]) * 0x100000001b3;
+
+    printf("  %-9s %8.2f ms  %6.1f ns/instr  clock %lld  checksum %016llx\n",
+           name, ms, ms * 1e6 / instrs,
+           (long long)cpu->getClock(), (unsigned long long)checksum);
+
+    delete cpu;
+}
+
+static void compareHostInterfaces()
+{
+    runGuest<BenchCPU>("virtual");
+    runGuest<StaticBenchCPU<>>("static");
+}
+
+static void compareConfigurations()
+{
+    runGuest<StaticBenchCPU<>>("default");
+    runGuest<StaticBenchCPU<FastConfig>>("fast");
+}
+
+//
+// Software TLB
+//
+
+// A configuration with the software TLB compiled in
+struct TLBConfig : DefaultConfig {
+
+    static constexpr bool softwareTLB = true;
+};
+
+/* A CPU with a two-level MMU. Supervisor and user accesses use different
+ * root tables. All pages are mapped to physical memory in reverse order.
+ */
+class MMUCPU : public MoiraT<MMUCPU, TLBConfig> {
+
+public:
+
+    u8 mem[0x10000];
+
+    // Root tables (one per privilege level) and page tables
+    u32 root[2][256];
+    u32 pages[2][16];
+
+    MMUCPU() {
+
+        for (int i = 0; i < 256; i++) root[0][i] = root[1][i] = i & 1;
+        for (int i = 0; i < 16; i++) pages[0][i] = pages[1][i] = (15 - i) << 12 | 1;
+        setClock(0);
+    }
+
+    u8 *phys(u32 addr, FunctionCode fc) {
+
+        u32 table = root[(fc & 4) ? 1 : 0][(addr >> 16) & 0xFF];
+        u32 desc = pages[table][(addr >> 12) & 0xF];
+        return (desc & 1) ? mem + ((desc & 0xF000) | (addr & 0xFFF)) : nullptr;
+    }
+
+    u8 read8(u32 addr) {
+        return *phys(addr, readFC()); }
+    u16 read16(u32 addr) {
+        return (u16)(*phys(addr, readFC()) << 8 | *phys(addr + 1, readFC())); }
+    void write8 (u32 addr, u8  val) {
+        *phys(addr, readFC()) = val; }
+    void write16 (u32 addr, u16 val) {
+        *phys(addr, readFC()) = val >> 8; *phys(addr + 1, readFC()) = val & 0xFF; }
+
+    u8 *translate(u32 addr, FunctionCode fc, bool write) { return phys(addr, fc); }
+
+    void poke16(u32 addr, u16 val) { write16(addr, val); }
+};
+
+// The same CPU with the software TLB enabled
+class TLBCPU : public MMUCPU {
+
+public:
+
+    TLBCPU() { enableTLB(true); }
+};
+
+static void runSoftwareTLB()
+{
+    runGuest<MMUCPU>("mmu");
+    runGuest<TLBCPU>("tlb");
+}
+
+//
+// Dirty page tracking
+//
+
+// A configuration with the dirty page tracker compiled in
+struct DirtyConfig : DefaultConfig {
+
+    static constexpr bool dirtyTracking = true;
+};
+
+static void takeSnapshots()
+{
+    const int frames = 500;
+    const i64 frameCycles = 20000;
+    const u32 pageSize = 256;
+
+    for (int tracked = 0; tracked < 2; tracked++) {
+
+        u32 state = 0x3C4D5E6F;
+
+        auto cpu = new StaticBenchCPU<DirtyConfig>();
+        for (int i = 0; i < 0x10000; i++) cpu->mem[i] = (u8)rnd(state);
+
+        static const u16 program[] = {
+
+            0x41F9, 0x0000, 0x4000,     // LEA     $4000,A0
+            0x43F9, 0x0000, 0x6000,     // LEA     $6000,A1
+            0x303C, 0x03FF,             // MOVE.W  #$3FF,D0
+            0x2218,                     // MOVE.L  (A0)+,D1
+            0xD481,                     // ADD.L   D1,D2
+            0xE39A,                     // ROL.L   #1,D2
+            0x22C2,                     // MOVE.L  D2,(A1)+
+            0xB391,                     // EOR.L   D1,(A1)
+            0x51C8, 0xFFF4,             // DBF     D0,$1010
+            0x5286,                     // ADDQ.L  #1,D6
+            0x60DE                      // BRA.S   $1000
+        };
+        for (size_t i = 0; i < sizeof(program) / 2; i++) cpu->poke16(0x1000 + 2 * (u32)i, program[i]);
+
+        cpu->poke16(0x0000, 0x0000);    // Initial SP: $E000
+        cpu->poke16(0x0002, 0xE000);
+        cpu->poke16(0x0004, 0x0000);    // Initial PC: $1000
+        cpu->poke16(0x0006, 0x1000);
+        cpu->reset();
+
+        if (tracked) cpu->trackDirtyPages(std::countr_zero(pageSize));
+
+        // The snapshot is updated incrementally at the end of each frame
+        std::vector<u8> snapshot(cpu->mem, cpu->mem + 0x10000);
+        long copied = 0;
+        double snapshotMs = 0;
+
+        Stopwatch watch;
+
+        for (int f = 0; f < frames; f++) {
+
+            i64 next = (f + 1) * frameCycles;
+            while (cpu->getClock() < next) cpu->execute();
+
+            Stopwatch snapshotWatch;
+
+            if (tracked) {
+
+                cpu->collectDirty([&](u32 addr, u32 size) {
+
+                    addr &= 0xFFFF;
+                    memcpy(&snapshot[addr], cpu->mem + addr, size);
+                    copied++;
+                });
+                cpu->clearDirty();
+
+            } else {
+
+                for (u32 addr = 0; addr < 0x10000; addr += pageSize) {
+
+                    if (memcmp(&snapshot[addr], cpu->mem + addr, pageSize)) {
+                        memcpy(&snapshot[addr], cpu->mem + addr, pageSize);
+                        copied++;
+                    }
+                }
+            }
+
+            snapshotMs += snapshotWatch.elapsed();
+        }
+
+        double ms = watch.elapsed();
+
+        u64 checksum = 0xcbf29ce484222325;
+        for (int i = 0; i < 0x10000; i++) checksum = (checksum ^ snapshot[i]) * 0x100000001b3;
+
+        printf("  %-9s %8.2f ms  snapshots %7.2f ms  %6ld pages copied  checksum %016llx\n",
+               tracked ? "dirty" : "scan", ms, snapshotMs, copied,
+               (unsigned long long)checksum);
+
+        delete cpu;
+    }
+}
+
+//
+// Native trap handlers
+//
+
+static void runNativeHandlers()
+{
+    const long calls = 200000;
+
+    for (int native = 0; native < 2; native++) {
+
+        BenchCPU *cpu = new BenchCPU();
+        memset(cpu->mem, 0, sizeof(cpu->mem));
+
+        static const u16 program[] = {
+
+            0x7001,                     // MOVEQ   #1,D0
+            0x4E41,                     // TRAP    #1
+            0xA123,                     // DC.W    $A123
+            0x5287,                     // ADDQ.L  #1,D7
+            0x60F6                      // BRA.S   $1000
+        };
+        for (size_t i = 0; i < sizeof(program) / 2; i++) cpu->poke16(0x1000 + 2 * (u32)i, program[i]);
+
+        cpu->poke16(0x0000, 0x0000);    // Initial SP: $E000
+        cpu->poke16(0x0002, 0xE000);
+        cpu->poke16(0x0004, 0x0000);    // Initial PC: $1000
+        cpu->poke16(0x0006, 0x1000);
+        cpu->poke16(0x0028, 0x0000);    // Line A vector: $2100
+        cpu->poke16(0x002A, 0x2100);
+        cpu->poke16(0x0084, 0x0000);    // Trap 1 vector: $2000
+        cpu->poke16(0x0086, 0x2000);
+        cpu->poke16(0x2000, 0xD680);    // ADD.L   D0,D3
+        cpu->poke16(0x2002, 0x4E73);    // RTE
+        cpu->poke16(0x2100, 0x5284);    // ADDQ.L  #1,D4
+        cpu->poke16(0x2102, 0x54AF);    // ADDQ.L  #2,2(A7)
+        cpu->poke16(0x2104, 0x0002);
+        cpu->poke16(0x2106, 0x4E73);    // RTE
+
+        if (native) {
+
+            cpu->setNativeHandler(0x4E41, [cpu](u16 op) {
+                cpu->setD(3, cpu->getD(3) + cpu->getD(0)); return 0; });
+            cpu->setNativeHandler(0xA123, [cpu](u16 op) {
+                cpu->setD(4, cpu->getD(4) + 1); return 0; });
+        }
+
+        cpu->reset();
+
+        Stopwatch watch;
+        long instrs = 0;
+
+        while (cpu->getD(7) < calls) { cpu->execute(); instrs++; }
+
+        double ms = watch.elapsed();
+
+        u64 checksum = 0xcbf29ce484222325;
+        for (int i = 0; i < 8; i++) checksum = (checksum ^ cpu->getD(i)) * 0x100000001b3;
+
+        printf("  %-9s %8.2f ms  %6.1f ns/call  %9ld instrs  clock %lld  checksum %016llx\n",
+               native ? "native" : "emulated", ms, ms * 1e6 / calls, instrs,
+               (long long)cpu->getClock(), (unsigned long long)checksum);
+
+        delete cpu;
+    }
+}
+
+//
+// PC hooks
+//
+
+static void runPCHooks()
+{
+    const long calls = 50000;
+    const char *modes[] = { "emulated", "far hook", "hooked" };
+
+    for (int mode = 0; mode < 3; mode++) {
+
+        BenchCPU *cpu = new BenchCPU();
+        memset(cpu->mem, 0, sizeof(cpu->mem));
+
+        static const u16 program[] = {
+
+            0x41F8, 0x3000,             // LEA     $3000.W,A0
+            0x4EB8, 0x2000,             // JSR     $2000.W
+            0x5287,                     // ADDQ.L  #1,D7
+            0x60F4                      // BRA.S   $1000
+        };
+        for (size_t i = 0; i < sizeof(program) / 2; i++) cpu->poke16(0x1000 + 2 * (u32)i, program[i]);
+
+        cpu->poke16(0x0000, 0x0000);    // Initial SP: $E000
+        cpu->poke16(0x0002, 0xE000);
+        cpu->poke16(0x0004, 0x0000);    // Initial PC: $1000
+        cpu->poke16(0x0006, 0x1000);
+        cpu->poke16(0x2000, 0x701F);    // MOVEQ   #31,D0
+        cpu->poke16(0x2002, 0xD258);    // ADD.W   (A0)+,D1
+        cpu->poke16(0x2004, 0x51C8);    // DBF     D0,$2002
+        cpu->poke16(0x2006, 0xFFFC);
+        cpu->poke16(0x2008, 0x4E75);    // RTS
+        for (u32 i = 0; i < 32; i++) cpu->poke16(0x3000 + 2 * i, (u16)(i * 0x1357));
+
+        // Replace the checksum routine by native code
+        auto routine = [cpu](u32 addr) {
+
+            u32 a0 = cpu->getA(0);
+            u16 sum = (u16)cpu->getD(1);
+            for (u32 i = 0; i < 32; i++, a0 += 2) sum += cpu->read16(a0);
+
+            cpu->setD(0, 0xFFFF);
+            cpu->setD(1, (cpu->getD(1) & 0xFFFF0000) | sum);
+            cpu->setA(0, a0);
+            cpu->returnFromHook();
+
+            // MOVEQ, 32 x ADD, 31 taken DBFs, one expired DBF (the RTS is charged by the CPU)
+            return 4 + 32 * 8 + 31 * 10 + 14;
+        };
+
+        if (mode == 1) cpu->setPCHook(0x8000, routine);
+        if (mode == 2) cpu->setPCHook(0x2000, routine);
+
+        cpu->reset();
+
+        Stopwatch watch;
+        long instrs = 0;
+
+        while (cpu->getD(7) < calls) { cpu->execute(); instrs++; }
+
+        double ms = watch.elapsed();
+
+        u64 checksum = 0xcbf29ce484222325;
+        for (int i = 0; i < 8; i++) checksum = (checksum ^ cpu->getD(i)) * 0x100000001b3;
+
+        printf("  %-9s %8.2f ms  %6.1f ns/call  %9ld instrs  clock %lld  checksum %016llx\n",
+               modes[mode], ms, ms * 1e6 / calls, instrs,
+               (long long)cpu->getClock(), (unsigned long long)checksum);
+
+        delete cpu;
+    }
+}
+
+//
+// Object layout
+//
+
+// A CPU executing code from memory shared with other instances
+class SharedCPU : public Moira {
+
+public:
+
+    u8 *mem;
+
+    u8 read8(u32 addr) override {
+        return mem[addr & 0xFFFF]; }
+    u16 read16(u32 addr) override {
+        return (u16)(mem[addr & 0xFFFF] << 8 | mem[(addr + 1) & 0xFFFF]); }
+    void write8 (u32 addr, u8  val) override {
+        mem[addr & 0xFFFF] = val; }
+    void write16 (u32 addr, u16 val) override {
+        mem[addr & 0xFFFF] = val >> 8; mem[(addr + 1) & 0xFFFF] = val & 0xFF; }
+
+    // Counts the cache lines holding the state accessed by an ordinary instruction
+    long hotLines() const {
+
+        std::vector<uintptr_t> lines;
+        auto add = [&](const void *p, size_t size) {
+            for (size_t i = 0; i < size; i++) lines.push_back(((uintptr_t)p + i) / 64);
+        };
+
+        add(this, sizeof(void *));
+        add(&flags, sizeof(flags));
+        add(&clock, sizeof(clock));
+        add(&reg, sizeof(reg));
+        add(&queue, sizeof(queue));
+        add(&ipl, sizeof(ipl));
+        add(&fcl, sizeof(fcl));
+        add(&preciseTiming, sizeof(preciseTiming));
+        add(&detectIdle, sizeof(detectIdle));
+        add(&hookPages, sizeof(hookPages));
+
+        std::sort(lines.begin(), lines.end());
+        return std::unique(lines.begin(), lines.end()) - lines.begin();
+    }
+};
+
+static void measureLayout()
+{
+    const long instrs = 4000000;
+    const long quantum = 1;
+
+    static u8 mem[0x10000];
+    memset(mem, 0, sizeof(mem));
+
+    static const u16 program[] = {
+
+        0x303C, 0x00FF,             // MOVE.W  #$FF,D0
+        0xD282,                     // ADD.L   D2,D1
+        0xE39A,                     // ROL.L   #1,D2
+        0xB382,                     // EOR.L   D1,D2
+        0x51C8, 0xFFF8,             // DBF     D0,$1004
+        0x5286,                     // ADDQ.L  #1,D6
+        0x60EE                      // BRA.S   $1000
+    };
+    for (size_t i = 0; i < sizeof(program) / 2; i++) {
+        mem[0x1000 + 2 * i] = program[i] >> 8; mem[0x1001 + 2 * i] = program[i] & 0xFF;
+    }
+    mem[0x0002] = 0xE0;                 // Initial SP: $E000
+    mem[0x0006] = 0x10;                 // Initial PC: $1000
+
+    // Run a single CPU and many CPUs in turns of a single instruction each
+    for (int count : { 1, 256, 8192 }) {
+
+        std::vector<SharedCPU *> cpus;
+        for (int i = 0; i < count; i++) {
+
+            auto cpu = new SharedCPU();
+            cpu->mem = mem;
+            cpu->reset();
+            cpu->setD(2, i);
+            cpus.push_back(cpu);
+        }
+
+        long rounds = instrs / (count * quantum);
+
+        CacheCounter counter;
+        Stopwatch watch;
+
+        for (long r = 0; r < rounds; r++) {
+            for (auto cpu : cpus) {
+                for (long i = 0; i < quantum; i++) cpu->execute();
+            }
+        }
+
+        double ms = watch.elapsed();
+        long long misses = counter.misses();
+        long executed = rounds * count * quantum;
+
+        u64 checksum = 0xcbf29ce484222325;
+        for (auto cpu : cpus) {
+            for (int i = 0; i < 8; i++) checksum = (checksum ^ cpu->getD(i)) * 0x100000001b3;
+        }
+
+        char l1[32];
+        if (misses >= 0) {
+            snprintf(l1, sizeof(l1), "%6.3f", (double)misses / executed);
+        } else {
+            snprintf(l1, sizeof(l1), "   n/a");
+        }
+
+        printf("  %4d CPUs %8.2f ms  %6.1f ns/instr  %s L1 misses/instr  %zu bytes  %ld hot lines  checksum %016llx\n",
+               count, ms, ms * 1e6 / executed, l1, sizeof(SharedCPU), cpus[0]->hotLines(),
+               (unsigned long long)checksum);
+
+        for (auto cpu : cpus) delete cpu;
+    }
+}
+
+//
+// ALU kernels
+//
+
+// Executes a single instruction with the given operands in D0 and D1
+static u64 execAlu(BenchCPU *cpu, u16 op, u32 d0, u32 d1, u8 ccr, u64 hash)
+{
+    cpu->setD(0, d0);
+    cpu->setD(1, d1);
+    cpu->setSR(0x2700 | ccr);
+    cpu->setPC(0x1000);
+    cpu->setPC0(0x1000);
+    cpu->setIRD(op);
+    cpu->setIRC(0x4E71);
+
+    i64 clock = cpu->getClock();
+    cpu->execute();
+
+    hash = (hash ^ cpu->getD(1)) * 0x100000001b3;
+    hash = (hash ^ cpu->getSR()) * 0x100000001b3;
+    return (hash ^ (u64)(cpu->getClock() - clock)) * 0x100000001b3;
+}
+
+static void runAluKernels()
+{
+    BenchCPU *cpu = new BenchCPU();
+    for (int i = 0; i < 0x10000; i += 2) cpu->poke16(i, 0x4E71);
+    cpu->reset();
+
+    // Run all families with operands covering their interesting ranges
+    for (int family = 0; family < 4; family++) {
+
+        u32 state = 0x1F2E3D4C;
+        u64 checksum = 0xcbf29ce484222325;
+        long instrs = 0;
+        Stopwatch watch;
+
+        switch (family) {
+
+            case 0: // ABCD D0,D1  SBCD D0,D1  NBCD D1
+            {
+                for (u16 op : { 0xC300, 0x8300, 0x4801 }) {
+                    for (u8 ccr = 0; ccr < 0x20; ccr += 0x04) {
+                        for (u32 a = 0; a < 256; a++) {
+                            for (u32 b = 0; b < 256; b++, instrs++) {
+                                checksum = execAlu(cpu, op, a, b, ccr | (ccr & 0x10 ? 0x01 : 0), checksum);
+                            }
+                        }
+                    }
+                }
+                break;
+            }
+            case 1: // ASx, LSx, ROXx, ROx with a register count (all sizes and directions)
+            {
+                for (u16 type = 0; type < 4; type++) {
+                    for (u16 dir = 0; dir < 2; dir++) {
+                        for (u16 size = 0; size < 3; size++) {
+
+                            u16 op = (u16)(0xE021 | dir << 8 | size << 6 | type << 3);
+                            for (u32 cnt = 0; cnt < 64; cnt++) {
+                                for (u32 i = 0; i < 2048; i++, instrs++) {
+                                    u32 data = i < 256 ? i << (8 * size) | i : rnd(state);
+                                    checksum = execAlu(cpu, op, cnt, data, (i & 1) ? 0x10 : 0, checksum);
+                                }
+                            }
+                        }
+                    }
+                }
+                break;
+            }
+            case 2: // MULU D0,D1  MULS D0,D1
+            {
+                for (u16 op : { 0xC2C0, 0xC3C0 }) {
+                    for (u32 a = 0; a < 0x10000; a++) {
+                        for (int i = 0; i < 8; i++, instrs++) {
+                            checksum = execAlu(cpu, op, a, rnd(state), 0, checksum);
+                        }
+                    }
+                }
+                break;
+            }
+            case 3: // DIVU D0,D1  DIVS D0,D1
+            {
+                for (u16 op : { 0x82C0, 0x83C0 }) {
+                    for (int i = 0; i < 1000000; i++, instrs++) {
+
+                        u32 divisor = rnd(state) >> (rnd(state) % 16);
+                        u32 dividend = rnd(state) >> (rnd(state) % 32);
+                        if ((u16)divisor == 0) divisor |= 1;
+                        checksum = execAlu(cpu, op, divisor, dividend, 0, checksum);
+                    }
+                }
+                break;
+            }
+        }
+
+        double ms = watch.elapsed();
+        static const char *names[] = { "bcd", "shift", "mul", "div" };
+        printf("  %-6s %8.2f ms  %6.1f ns/instr  %9ld instrs  checksum %016llx\n",
+               names[family], ms, ms * 1e6 / instrs, instrs, (unsigned long long)checksum);
+    }
+
+    delete cpu;
+}
+
+//
+// Handler footprint
+//
+
+// A configuration sharing the handlers of all condition codes
+struct CompactConfig : DefaultConfig {
+
+    static constexpr bool compactHandlers = true;
+};
+
+template <class C> class HandlerCPU : public StaticBenchCPU<C> {
+
+public:
+
+    // Counts the distinct handlers of all instructions accepted by the filter
+    template <class F> size_t countHandlers(F filter) {
+
+        typedef std::array<u8, sizeof(this->exec[0])> Key;
+        std::set<Key> handlers;
+
+        for (int op = 0; op < 0x10000; op++) {
+
+            if (!filter((u16)op, this->getInfo((u16)op).I)) continue;
+
+            Key key;
+            memcpy(key.data(), &this->exec[op], sizeof(key));
+            handlers.insert(key);
+        }
+        return handlers.size();
+    }
+};
+
+template <class C> static void runBranchyGuest(const char *name)
+{
+    const int rounds = 200;
+    u32 state = 0x5A5A1234;
+
+    auto cpu = new HandlerCPU<C>();
+    memset(cpu->mem, 0, sizeof(cpu->mem));
+
+    // Count the handlers of all condition code families and of the whole core
+    auto isBcc = [](u16 op, Instr I) { return (op & 0xF000) == 0x6000 && I != BSR; };
+    auto isDbcc = [](u16 op, Instr I) { return (op & 0xF0F8) == 0x50C8 && I != ILLEGAL; };
+    auto isScc = [](u16 op, Instr I) { return (op & 0xF0C0) == 0x50C0 && (op & 0xF0F8) != 0x50C8 && I != ILLEGAL; };
+    auto isAny = [](u16 op, Instr I) { return I != ILLEGAL; };
+
+    printf("  %-9s handlers  Bcc %zu  DBcc %zu  Scc %zu  all %zu\n", name,
+           cpu->countHandlers(isBcc), cpu->countHandlers(isDbcc),
+           cpu->countHandlers(isScc), cpu->countHandlers(isAny));
+
+    // Create a long loop of arithmetic, compare, Bcc, and Scc instructions
+    u32 addr = 0x1000;
+    while (addr < 0x9000) {
+
+        u16 x = rnd(state) % 7, y = rnd(state) % 7, cc = 2 + rnd(state) % 14;
+
+        switch (rnd(state) % 8) {
+
+            case 0: cpu->poke16(addr, 0x7000 | y << 9 | (rnd(state) & 0xFF)); break;  // MOVEQ
+            case 1: cpu->poke16(addr, 0xD080 | y << 9 | x); break;                   // ADD.L
+            case 2: cpu->poke16(addr, 0xB180 | x << 9 | y); break;                   // EOR.L
+            case 3: cpu->poke16(addr, 0x9040 | y << 9 | x); break;                   // SUB.W
+            case 4: cpu->poke16(addr, 0xE198 | (1 + x) << 9 | y); break;             // ROL.L
+            case 5: cpu->poke16(addr, 0xB080 | y << 9 | x); break;                   // CMP.L
+            case 6: cpu->poke16(addr, 0x6002 | cc << 8); break;                      // Bcc.S *+4
+            case 7: cpu->poke16(addr, 0x50C0 | cc << 8 | y); break;                  // Scc
+        }
+        addr += 2;
+    }
+    cpu->poke16(addr, 0x6000);          // BRA.W $1000
+    cpu->poke16(addr + 2, (u16)(0x1000 - (addr + 2)));
+
+    cpu->poke16(0x0000, 0x0000);        // Initial SP: $F000
+    cpu->poke16(0x0002, 0xF000);
+    cpu->poke16(0x0004, 0x0000);        // Initial PC: $1000
+    cpu->poke16(0x0006, 0x1000);
+    cpu->reset();
+
+    CacheCounter counter(true);
+    Stopwatch watch;
+    long instrs = 0;
+
+    for (int r = 0; r < rounds; r++) {
+
+        i64 next = (r + 1) * 100000;
+        while (cpu->getClock() < next) { cpu->execute(); instrs++; }
+    }
+
+    double ms = watch.elapsed();
+    long long misses = counter.misses();
+
+    u64 checksum = 0xcbf29ce484222325;
+    for (int i = 0; i < 8; i++) checksum = (checksum ^ cpu->getD(i)) * 0x100000001b3;
+
+    char l1[32];
+    if (misses >= 0) {
+        snprintf(l1, sizeof(l1), "%6.3f", (double)misses / instrs);
+    } else {
+        snprintf(l1, sizeof(l1), "   n/a");
+    }
+
+    printf("  %-9s %8.2f ms  %6.1f ns/instr  %s L1i misses/instr  clock %lld  checksum %016llx\n",
+           name, ms, ms * 1e6 / instrs, l1,
+           (long long)cpu->getClock(), (unsigned long long)checksum);
+
+    delete cpu;
+}
+
+static void compareHandlerSets()
+{
+    runBranchyGuest<DefaultConfig>("default");
+    runBranchyGuest<CompactConfig>("compact");
+}
+
+//
+// Memory footprint
+//
+
+// Number of bytes allocated on the heap so far
+static std::atomic<size_t> heapBytes = 0;
+
+// The replacements are not inlined. Otherwise, GCC pairs the calls to malloc()
+// and free() with the calls to new and delete and reports a mismatch.
+__attribute__((noinline)) void *operator new(size_t size)
+{
+    heapBytes += size;
+    if (void *p = malloc(size ? size : 1)) return p;
+    throw std::bad_alloc();
+}
+
+__attribute__((noinline)) void operator delete(void *p) noexcept { free(p); }
+__attribute__((noinline)) void operator delete(void *p, size_t) noexcept { free(p); }
+
+template <class C> class FootprintCPU : public StaticBenchCPU<C> {
+
+public:
+
+    // Returns the size of the CPU state (excluding the memory of the host)
+    static size_t stateBytes() { return sizeof(MoiraT<FootprintCPU<C>, C>); }
+
+    // Returns the size of the tables shared by all instances
+    static size_t sharedBytes() {
+
+        size_t result = sizeof(FootprintCPU::exec);
+        if (C::enableDasm) result += FootprintCPU::dasmEntries * sizeof(typename FootprintCPU::DasmPtr);
+        if (C::enableDasm || C::buildInstrInfoTable) result += 65536 * sizeof(InstrInfo);
+        return result;
+    }
+};
+
+template <class C> static void measureFootprint(const char *name)
+{
+    const int count = 256;
+
+    // Create the shared tables before counting
+    delete new FootprintCPU<C>();
+
+    static const u16 program[] = {
+
+        0x303C, 0x00FF,             // MOVE.W  #$FF,D0
+        0xD282,                     // ADD.L   D2,D1
+        0xE39A,                     // ROL.L   #1,D2
+        0xB382,                     // EOR.L   D1,D2
+        0x51C8, 0xFFF8,             // DBF     D0,$1004
+        0x5286,                     // ADDQ.L  #1,D6
+        0x60EE                      // BRA.S   $1000
+    };
+
+    std::vector<FootprintCPU<C> *> cpus;
+    cpus.reserve(count);
+
+    size_t heap = heapBytes;
+
+    Stopwatch watch;
+
+    for (int i = 0; i < count; i++) {
+
+        auto cpu = new FootprintCPU<C>();
+        memset(cpu->mem, 0, sizeof(cpu->mem));
+        for (size_t j = 0; j < sizeof(program) / 2; j++) cpu->poke16(0x1000 + 2 * (u32)j, program[j]);
+        cpu->poke16(0x0002, 0xE000);    // Initial SP: $E000
+        cpu->poke16(0x0006, 0x1000);    // Initial PC: $1000
+        cpu->reset();
+        cpu->setD(2, i);
+
+        while (cpu->getClock() < 100000) cpu->execute();
+        cpus.push_back(cpu);
+    }
+
+    double ms = watch.elapsed();
+    heap = heapBytes - heap;
+
+    u64 checksum = 0xcbf29ce484222325;
+    for (auto cpu : cpus) {
+        for (int i = 0; i < 8; i++) checksum = (checksum ^ cpu->getD(i)) * 0x100000001b3;
+    }
+
+    printf("  %-9s %8.2f ms  %5zu bytes state  %5zu bytes heap  %5zu KB shared  checksum %016llx\n",
+           name, ms, FootprintCPU<C>::stateBytes(), heap / count,
+           FootprintCPU<C>::sharedBytes() / 1024, (unsigned long long)checksum);
+
+    for (auto cpu : cpus) delete cpu;
+}
+
+static void compareFootprints()
+{
+    measureFootprint<DefaultConfig>("default");
+    measureFootprint<MinimalConfig>("minimal");
+}
+
+static Benchmark benchmarks[] = {
+
+    { "dasm", "Disassembles all 65536 opcodes", dasmAllOpcodes },
+    { "dcache", "Redraws a disassembler window with and without the cache", dasmWindow },
+    { "cfg", "Recovers the control-flow graph of a synthetic 64 KB ROM", analyzeMemory },
+    { "timing", "Validates the instruction timing table against execution", validateTimings },
+    { "sched", "Runs 256 CPUs on a thread pool with 1 to N threads", runScheduler },
+    { "idle", "Runs a guest that waits for interrupts in idle loops", skipIdleLoops },
+    { "stop", "Runs a guest that waits for interrupts in STOP state", skipStopState },
+    { "kernels", "Runs copy, fill, and compare loops with and without bulk execution", runLoopKernels },
+    { "fusion", "Runs a guest dominated by fusable instruction pairs", fuseInstructions },
+    { "blocks", "Runs a guest with and without the block cache", runBlockCache },
+    { "jit", "Checks the block translator against the interpreter and measures its speed", runTranslator },
+    { "approx", "Runs a guest with precise and approximate timing", runApproximateTiming },
+    { "host", "Runs a guest with a virtual and a statically bound host interface", compareHostInterfaces },
+    { "config", "Runs a guest on the default and a stripped-down configuration", compareConfigurations },
+    { "tlb", "Runs a guest behind an MMU with and without the software TLB", runSoftwareTLB },
+    { "dirty", "Takes incremental snapshots by scanning memory and by tracking dirty pages", takeSnapshots },
+    { "native", "Runs a guest calling TRAP and LINE-A routines with and without native handlers", runNativeHandlers },
+    { "hooks", "Runs a guest calling a checksum routine with and without a PC hook", runPCHooks },
+    { "layout", "Runs one and many CPUs to measure the cache footprint of the CPU state", measureLayout },
+    { "alu", "Executes BCD, shift, multiply, and divide instructions over a wide operand range", runAluKernels },
+    { "handlers", "Runs a branch-heavy guest with separate and shared condition code handlers", compareHandlerSets },
+    { "footprint", "Runs 256 CPUs in the default and the minimal configuration and reports their memory usage", compareFootprints },
+};
+
+int main(int argc, char *argv[])
+{
+    for (auto &b : benchmarks) {
+
+        // Only run the benchmarks specified on the command line (if any)
+        bool selected = argc == 1;
+        for (int i = 1; i < argc; i++) selected |= strcmp(argv[i], b.name) == 0;
+        if (!selected) continue;
+
+        printf("%s: %s\n", b.name, b.description);
+        b.run();
+    }
+
+    return 0;
+}
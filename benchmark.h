@@ -0,0 +1,193 @@
+// -----------------------------------------------------------------------------
+// This file is part of Moira - A Motorola 68k emulator
+//
+// Copyright (C) Dirk W. Hoffmann. www.dirkwhoffmann.de
+// Licensed under the GNU General Public License v3
+//
+// See https://www.gnu.org for license information
+// -----------------------------------------------------------------------------
+
+#ifndef BENCHMARK_H
+#define BENCHMARK_H
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <new>
+#include <set>
+#include <thread>
+#include <vector>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include "MoiraImpl.h"
+
+using namespace moira;
+
+// A minimal CPU with 64 KB of mirrored memory
+class BenchCPU : public Moira {
+
+public:
+
+    u8 mem[0x10000];
+
+    u8 read8(u32 addr) override {
+        return mem[addr & 0xFFFF]; }
+    u16 read16(u32 addr) override {
+        return (u16)(mem[addr & 0xFFFF] << 8 | mem[(addr + 1) & 0xFFFF]); }
+    void write8 (u32 addr, u8  val) override {
+        mem[addr & 0xFFFF] = val; }
+    void write16 (u32 addr, u16 val) override {
+        mem[addr & 0xFFFF] = val >> 8; mem[(addr + 1) & 0xFFFF] = val & 0xFF; }
+
+    void poke16(u32 addr, u16 val) { write16(addr, val); }
+};
+
+// The same CPU with a statically bound memory interface
+template <class C = DefaultConfig> class StaticBenchCPU : public MoiraT<StaticBenchCPU<C>, C> {
+
+public:
+
+    u8 mem[0x10000];
+
+    u8 read8(u32 addr) {
+        return mem[addr & 0xFFFF]; }
+    u16 read16(u32 addr) {
+        return (u16)(mem[addr & 0xFFFF] << 8 | mem[(addr + 1) & 0xFFFF]); }
+    void write8 (u32 addr, u8  val) {
+        mem[addr & 0xFFFF] = val; }
+    void write16 (u32 addr, u16 val) {
+        mem[addr & 0xFFFF] = val >> 8; mem[(addr + 1) & 0xFFFF] = val & 0xFF; }
+
+    void poke16(u32 addr, u16 val) { write16(addr, val); }
+};
+
+/* A statically bound CPU that can hash all bus accesses (address and value)
+ * and calls to sync() in the order they occur. Together with the registers
+ * recorded in each call to sync(), the hash reveals any difference in the
+ * observable behaviour of two cores. Writing to $F000 acknowledges the
+ * interrupt.
+ */
+template <class C = DefaultConfig> class TraceCPU : public MoiraT<TraceCPU<C>, C> {
+
+public:
+
+    u8 mem[0x10000];
+    u64 trace = 0xcbf29ce484222325;
+
+    // Indicates whether the hash is computed
+    bool tracing = false;
+
+    void record(u64 value) { if (tracing) trace = (trace ^ value) * 0x100000001b3; }
+
+    u8 read8(u32 addr) {
+        u8 val = mem[addr & 0xFFFF];
+        record((u64)addr << 32 | val); return val; }
+    u16 read16(u32 addr) {
+        u16 val = (u16)(mem[addr & 0xFFFF] << 8 | mem[(addr + 1) & 0xFFFF]);
+        record((u64)addr << 32 | val); return val; }
+    void write8 (u32 addr, u8  val) {
+        record((u64)addr << 32 | val); mem[addr & 0xFFFF] = val; }
+    void write16 (u32 addr, u16 val) {
+        record((u64)addr << 32 | val);
+        mem[addr & 0xFFFF] = val >> 8; mem[(addr + 1) & 0xFFFF] = val & 0xFF;
+        if ((addr & 0xFFFF) == 0xF000) this->setIPL(0);
+    }
+    void sync(int cycles) {
+
+        if (tracing) {
+
+            record((u64)this->clock << 8 | (u64)cycles);
+            for (int i = 0; i < 16; i++) record(this->reg.r[i]);
+            record(this->getCCR());
+        }
+        this->clock += cycles;
+    }
+
+    void poke16(u32 addr, u16 val) { mem[addr & 0xFFFF] = val >> 8; mem[(addr + 1) & 0xFFFF] = val & 0xFF; }
+
+    // Combines the hash with the registers and the clock
+    u64 checksum() {
+
+        u64 result = trace;
+        for (int i = 0; i < 8; i++) result = (result ^ this->getD(i)) * 0x100000001b3;
+        for (int i = 0; i < 8; i++) result = (result ^ this->getA(i)) * 0x100000001b3;
+        result = (result ^ this->getSR()) * 0x100000001b3;
+        result = (result ^ this->getPC()) * 0x100000001b3;
+        return (result ^ (u64)this->getClock()) * 0x100000001b3;
+    }
+};
+
+// Measures the wall-clock time of a code block in milliseconds
+class Stopwatch {
+
+    std::chrono::high_resolution_clock::time_point start;
+
+public:
+
+    Stopwatch() : start(std::chrono::high_resolution_clock::now()) { }
+
+    double elapsed() const {
+        auto now = std::chrono::high_resolution_clock::now();
+        return std::chrono::duration<double, std::milli>(now - start).count();
+    }
+};
+
+// Counts the L1 data or instruction cache misses of a code block (if supported by the host)
+class CacheCounter {
+
+    int fd = -1;
+
+public:
+
+    CacheCounter(bool instr = false) {
+
+#ifdef __linux__
+        perf_event_attr attr;
+        memset(&attr, 0, sizeof(attr));
+        attr.size = sizeof(attr);
+        attr.type = PERF_TYPE_HW_CACHE;
+        attr.config = (instr ? PERF_COUNT_HW_CACHE_L1I : PERF_COUNT_HW_CACHE_L1D) |
+        (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        fd = (int)syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+#endif
+    }
+
+    ~CacheCounter() {
+
+#ifdef __linux__
+        if (fd >= 0) close(fd);
+#endif
+    }
+
+    // Returns the number of misses since construction or -1 if not available
+    long long misses() const {
+
+        long long result = -1;
+#ifdef __linux__
+        if (fd < 0 || read(fd, &result, sizeof(result)) != sizeof(result)) result = -1;
+#endif
+        return result;
+    }
+};
+
+// A single benchmark
+struct Benchmark {
+
+    const char *name;
+    const char *description;
+    void (*run)();
+};
+
+#endif
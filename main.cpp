@@ -1,19 +1,28 @@
-// -----------------------------------------------------------------------------
-// This file is part of Moira - A Motorola 68k emulator
-//
-// Copyright (C) Dirk W. Hoffmann. www.dirkwhoffmann.de
-// Licensed under the GNU General Public License v3
-//
-// See https://www.gnu.org for license information
-// -----------------------------------------------------------------------------
-
-#include "testrunner.h"
-
-int main()
-{
-    moiracpu = new TestCPU();
-    run();
-
-    return 0;
-}
-
+// -----------------------------------------------------------------------------
+// This file is part of Moira - A Motorola 68k emulator
+//
+// Copyright (C) Dirk W. Hoffmann. www.dirkwhoffmann.de
+// Licensed under the GNU General Public License v3
+//
+// See https://www.gnu.org for license information
+// -----------------------------------------------------------------------------
+
+#include "testrunner.h"
+
+int main(int argc, char *argv[])
+{
+    const char *corpus = argc > 2 ? argv[2] : "corpus.bin";
+
+    moiracpu = new TestCPU();
+
+    if (argc > 1 && strcmp(argv[1], "fuzz") == 0) {
+        fuzz(corpus);
+    } else if (argc > 1 && strcmp(argv[1], "replay") == 0) {
+        replay(corpus);
+    } else {
+        run();
+    }
+
+    return 0;
+}
+
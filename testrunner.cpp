@@ -14,6 +14,10 @@ uint8_t musashiMem[0x10000];
 uint8_t moiraMem[0x10000];
 u32 musashiFC = 0;
 Sandbox sandbox;
+Coverage coverage;
+
+// Memory images corpus entries can choose from
+static uint8_t images[MEM_IMAGES][0x10000];
 
 uint32 smartRandom()
 {
@@ -63,6 +67,29 @@ void createTestCase(Setup &s)
     }
 }
 
+void createTestCase(Setup &s, const CorpusEntry &e)
+{
+    s.supervisor = e.supervisor;
+    s.ccr = e.ccr;
+    s.ext1 = e.ext1;
+    s.ext2 = e.ext2;
+    for (int i = 0; i < 8; i++) s.d[i] = e.d[i];
+    for (int i = 0; i < 8; i++) s.a[i] = e.a[i];
+
+    memcpy(s.mem, images[e.image % MEM_IMAGES], sizeof(s.mem));
+}
+
+void createImages()
+{
+    for (int i = 0; i < MEM_IMAGES; i++) {
+
+        srand(i);
+        for (unsigned j = 0; j < sizeof(images[i]); j++) {
+            images[i][j] = (uint8_t)smartRandom();
+        }
+    }
+}
+
 void setupInstruction(Setup &s, uint32_t pc, uint16_t opcode)
 {
     s.pc = pc;
@@ -76,6 +103,55 @@ void setupInstruction(Setup &s, uint32_t pc, uint16_t opcode)
     memcpy(moiraMem, s.mem, sizeof(moiraMem));
 }
 
+void setupInstructionPair(Setup &s, uint32_t pc, uint16_t opcode1, uint16_t opcode2)
+{
+    char str[128];
+
+    // Place the first instruction and determine its size
+    setupInstruction(s, pc, opcode1);
+    uint32_t next = pc + moiracpu->disassemble(pc, str);
+
+    // Place the second instruction behind
+    set16(s.mem, next, opcode2);
+    set16(s.mem, next + 2, (uint16_t)smartRandom());
+    set16(s.mem, next + 4, (uint16_t)smartRandom());
+
+    memcpy(musashiMem, s.mem, sizeof(musashiMem));
+    memcpy(moiraMem, s.mem, sizeof(moiraMem));
+}
+
+uint16_t pairPartner(uint16_t opcode)
+{
+    static const int bcc[] = { 0x6 };
+    static const int alu[] = { 0x8, 0x9, 0xB, 0xC, 0xD, 0xE };
+    static const int move[] = { 0x1, 0x2, 0x3 };
+
+    const int *lines;
+    int count;
+
+    switch (moiracpu->getInfo(opcode).I) {
+
+        case moira::CMP:
+        case moira::CMPA:
+        case moira::CMPI:
+        case moira::TST:    lines = bcc; count = 1; break;
+        case moira::MOVEQ:  lines = alu; count = 6; break;
+        case moira::LEA:    lines = move; count = 3; break;
+
+        default:
+            return 0;
+    }
+
+    while (true) {
+
+        uint16_t partner = (uint16_t)(lines[rand() % count] << 12 | (rand() & 0xFFF));
+
+        // Skip some instructions that are likely to be broken in Musashi
+        moira::Instr instr = moiracpu->getInfo(partner).I;
+        if (instr != moira::ABCD && instr != moira::SBCD) return partner;
+    }
+}
+
 void resetMusashi(Setup &s)
 {
     m68k_set_reg(M68K_REG_USP, 0);
@@ -108,6 +184,37 @@ void resetMoira(Setup &s)
     moiracpu->setSupervisorMode(s.supervisor);
 }
 
+void createEntry(CorpusEntry &e, uint16_t opcode)
+{
+    e.opcode = opcode;
+    e.supervisor = smartRandom() % 2;
+    e.ccr = (uint8_t)smartRandom();
+    e.ext1 = (uint16_t)smartRandom();
+    e.ext2 = (uint16_t)smartRandom();
+    for (int i = 0; i < 8; i++) e.d[i] = smartRandom();
+    for (int i = 0; i < 8; i++) e.a[i] = smartRandom();
+    e.image = rand() % MEM_IMAGES;
+}
+
+void mutate(CorpusEntry &e)
+{
+    switch (rand() % 12) {
+
+        case  0: e.d[rand() % 8] = smartRandom(); break;
+        case  1: e.d[rand() % 8] ^= 1u << (rand() % 32); break;
+        case  2: e.a[rand() % 7] = smartRandom(); break;
+        case  3: e.a[rand() % 7] ^= 1u << (rand() % 32); break;
+        case  4: e.ccr ^= 1 << (rand() % 5); break;
+        case  5: e.supervisor = !e.supervisor; break;
+        case  6: e.ext1 = (uint16_t)smartRandom(); break;
+        case  7: e.ext1 ^= 1 << (rand() % 16); break;
+        case  8: e.ext2 = (uint16_t)smartRandom(); break;
+        case  9: e.ext2 ^= 1 << (rand() % 16); break;
+        case 10: e.opcode ^= 1 << (rand() % 16); break;
+        case 11: e.image = rand() % MEM_IMAGES; break;
+    }
+}
+
 clock_t muclk = 0, moclk = 0;
 
 void run()
@@ -142,12 +249,118 @@ void run()
             runSingleTest(setup);
         }
 
-        printf(" PASSED (Musashi: %.2fs Moira: %.2fs)\n",
+        // Iterate through all opcodes that can be fused with their successor
+        for (int opcode = 0x0000; ENABLE_FUSION && opcode < 65536; opcode++) {
+
+            uint16_t partner = pairPartner((uint16_t)opcode);
+            if (!partner) continue;
+
+            // Prepare the test case with the selected instruction pair
+            setupInstructionPair(setup, pc, (uint16_t)opcode, partner);
+
+            // Reset the sandbox (memory accesses observer)
+            sandbox.prepare();
+
+            // Execute both CPU cores
+            runPairTest(setup);
+        }
+
+        printf(" PASSED (Musashi: %.2fs Moira: %.2fs Coverage: %ld)\n",
                muclk / double(CLOCKS_PER_SEC),
-               moclk / double(CLOCKS_PER_SEC));
+               moclk / double(CLOCKS_PER_SEC),
+               coverage.getFeatures());
+    }
+}
+
+void fuzz(const char *path)
+{
+    Setup setup;
+    CorpusEntry entry;
+    unsigned seed = (unsigned)time(nullptr);
+
+    printf("Moira CPU tester. (C) Dirk W. Hoffmann, 2019 - 2022\n\n");
+    printf("The test program runs Moira against Musashi with mutated test cases.\n");
+    printf("Test cases reaching new code paths are added to %s.\n", path);
+    printf("It runs until a bug has been found.\n\n");
+
+    setupMusashi();
+    setupMoira();
+    createImages();
+    srand(seed);
+
+    // Rerun the existing corpus to restore the coverage information
+    coverage.load(path);
+    for (auto &e : coverage.corpus) runEntry(setup, e);
+    coverage.attach(path);
+
+    printf("Seed %u: %zu corpus entries, %ld features\n",
+           seed, coverage.corpus.size(), coverage.getFeatures());
+
+    // Start with a random test case for each opcode if no corpus exists
+    if (coverage.corpus.empty()) {
+
+        for (int opcode = 0x0000; opcode < 65536; opcode++) {
+
+            createEntry(entry, (uint16_t)opcode);
+            if (runEntry(setup, entry)) coverage.add(entry);
+        }
+    }
+
+    for (long round = 1 ;; round++) {
+
+        // Pick a random corpus entry and modify it
+        entry = coverage.corpus[rand() % coverage.corpus.size()];
+        for (int i = 0, n = 1 + rand() % 4; i < n; i++) mutate(entry);
+
+        // Keep it if it has reached a new code path
+        if (runEntry(setup, entry)) coverage.add(entry);
+
+        if (round % 1000000 == 0) {
+
+            printf("Round %ld: %zu corpus entries, %ld features (Musashi: %.2fs Moira: %.2fs)\n",
+                   round, coverage.corpus.size(), coverage.getFeatures(),
+                   muclk / double(CLOCKS_PER_SEC),
+                   moclk / double(CLOCKS_PER_SEC));
+        }
     }
 }
 
+void replay(const char *path)
+{
+    Setup setup;
+
+    printf("Moira CPU tester. (C) Dirk W. Hoffmann, 2019 - 2022\n\n");
+    printf("The test program runs Moira against Musashi with the test cases in %s.\n\n", path);
+
+    if (!coverage.load(path)) {
+
+        printf("Cannot open %s\n", path);
+        return;
+    }
+
+    setupMusashi();
+    setupMoira();
+    createImages();
+
+    for (auto &e : coverage.corpus) runEntry(setup, e);
+
+    printf("%zu test cases PASSED (Coverage: %ld)\n",
+           coverage.corpus.size(), coverage.getFeatures());
+}
+
+int runEntry(Setup &s, const CorpusEntry &e)
+{
+    long features = coverage.getFeatures();
+
+    coverage.current = e;
+    createTestCase(s, e);
+    setupInstruction(s, pc, e.opcode);
+    sandbox.prepare();
+    runSingleTest(s);
+
+    return (int)(coverage.getFeatures() - features);
+}
+
 void runSingleTest(Setup &s)
 {
     Result mur, mor;
@@ -160,13 +373,55 @@ void runSingleTest(Setup &s)
 
         // Run
         muclk += runMusashi(i, s, mur);
+        coverage.prepare();
         moclk += runMoira(i, s, mor);
+        coverage.record(mor, sandbox.getRecords());
 
         // Compare
         compare(s, mur, mor);
     }
 }
 
+void runPairTest(Setup &s)
+{
+    Result mur, mor;
+    int cycles;
+
+    // Prepare
+    resetMusashi(s);
+    resetMoira(s);
+    moiracpu->enableFusion(true);
+
+    // Run both instructions in Musashi
+    muclk += runMusashi(0, s, mur);
+    cycles = mur.cycles;
+    muclk += runMusashi(1, s, mur);
+    mur.cycles += cycles;
+
+    // Run both instructions in Moira (with a single call if they are fused)
+    i64 fused = moiracpu->getFusedPairs();
+    moclk += runMoira(0, s, mor);
+
+    if (moiracpu->getFusedPairs() == fused) {
+
+        cycles = mor.cycles;
+        moclk += runMoira(1, s, mor);
+        mor.cycles += cycles;
+
+    } else {
+
+        // Describe the result by the second instruction as Musashi does
+        mor.oldpc = mur.oldpc;
+        mor.opcode = get16(moiraMem, mor.oldpc);
+        mor.dasmCnt = moiracpu->disassemble(mor.oldpc, mor.dasm);
+    }
+
+    moiracpu->enableFusion(false);
+
+    // Compare
+    compare(s, mur, mor);
+}
+
 clock_t runMusashi(int i, Setup &s, Result &r)
 {
     clock_t elapsed = 0;
@@ -444,6 +699,8 @@ bool compareCycles(Result &r1, Result &r2)
 
 void bugReport()
 {
+    coverage.saveCurrent();
+
     printf("Please send a bug report to: dirk.hoffmann@me.com\n");
     printf("Thanks you!\n\n");
     assert(false);
@@ -19,6 +19,7 @@
 
 #include "Sandbox.h"
 #include "TestCPU.h"
+#include "Coverage.h"
 
 // Musashi
 extern "C" {
@@ -38,6 +39,7 @@ extern "C" {
 
 extern class TestCPU *moiracpu;
 extern Sandbox sandbox;
+extern Coverage coverage;
 extern uint8_t musashiMem[0x10000];
 extern uint8_t moiraMem[0x10000];
 extern u32 musashiFC;
@@ -97,18 +99,36 @@ void setupMusashi();
 void setupMoira();
 
 void createTestCase(Setup &s);
+void createTestCase(Setup &s, const CorpusEntry &e);
+void createImages();
 void setupInstruction(Setup &s, uint32_t pc, uint16_t opcode);
+void setupInstructionPair(Setup &s, uint32_t pc, uint16_t opcode1, uint16_t opcode2);
+
+// Returns a random instruction that can be fused with opcode (or 0)
+uint16_t pairPartner(uint16_t opcode);
 
 void resetMusashi(Setup &s);
 void resetMoira(Setup &s);
 
+// Creates a random corpus entry for an opcode
+void createEntry(CorpusEntry &e, uint16_t opcode);
+
+// Randomly modifies a corpus entry
+void mutate(CorpusEntry &e);
+
 //
 // Performing a test
 //
 
 void run();
+void fuzz(const char *path);
+void replay(const char *path);
+
+// Runs a single corpus entry and returns the number of new coverage features
+int runEntry(Setup &s, const CorpusEntry &e);
 
 void runSingleTest(Setup &s);
+void runPairTest(Setup &s);
 
 clock_t runMusashi(int i, Setup &s, Result &r);
 clock_t runMoira(int i, Setup &s, Result &r);